@@ -206,6 +206,10 @@ let package = Package(
         "src/core/client_channel/load_balanced_call_destination.h",
         "src/core/client_channel/local_subchannel_pool.cc",
         "src/core/client_channel/local_subchannel_pool.h",
+        "src/core/client_channel/response_cache_interceptor.cc",
+        "src/core/client_channel/response_cache_interceptor.h",
+        "src/core/client_channel/response_cache_service_config.cc",
+        "src/core/client_channel/response_cache_service_config.h",
         "src/core/client_channel/retry_filter.cc",
         "src/core/client_channel/retry_filter.h",
         "src/core/client_channel/retry_filter_legacy_call_data.cc",
@@ -1400,6 +1404,8 @@ let package = Package(
         "src/core/handshaker/proxy_mapper.h",
         "src/core/handshaker/proxy_mapper_registry.cc",
         "src/core/handshaker/proxy_mapper_registry.h",
+        "src/core/handshaker/security/handshake_offload_pool.cc",
+        "src/core/handshaker/security/handshake_offload_pool.h",
         "src/core/handshaker/security/pipelined_secure_endpoint.cc",
         "src/core/handshaker/security/pipelining_heuristic_selector.h",
         "src/core/handshaker/security/secure_endpoint.cc",
@@ -1439,7 +1445,9 @@ let package = Package(
         "src/core/lib/debug/trace_impl.h",
         "src/core/lib/event_engine/ares_resolver.cc",
         "src/core/lib/event_engine/ares_resolver.h",
+        "src/core/lib/event_engine/caching_dns_resolver.cc",
         "src/core/lib/event_engine/cf_engine/cf_engine.cc",
+        "src/core/lib/event_engine/caching_dns_resolver.h",
         "src/core/lib/event_engine/cf_engine/cf_engine.h",
         "src/core/lib/event_engine/cf_engine/cfsocket_listener.cc",
         "src/core/lib/event_engine/cf_engine/cfsocket_listener.h",
@@ -1930,14 +1938,18 @@ let package = Package(
         "src/core/resolver/xds/xds_resolver.cc",
         "src/core/resolver/xds/xds_resolver_attributes.h",
         "src/core/server/add_port.cc",
+        "src/core/server/method_admission.cc",
+        "src/core/server/method_admission.h",
         "src/core/server/server.cc",
         "src/core/server/server.h",
+        "src/core/server/server_metrics.cc",
         "src/core/server/server_call_tracer_filter.cc",
         "src/core/server/server_call_tracer_filter.h",
         "src/core/server/server_config_selector.h",
         "src/core/server/server_config_selector_filter.cc",
         "src/core/server/server_config_selector_filter.h",
         "src/core/server/server_interface.h",
+        "src/core/server/server_metrics.h",
         "src/core/server/xds_channel_stack_modifier.cc",
         "src/core/server/xds_channel_stack_modifier.h",
         "src/core/server/xds_server_config_fetcher.cc",
@@ -2028,7 +2040,9 @@ let package = Package(
         "src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.h",
+        "src/core/tsi/ssl/session_cache/ssl_session_store.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_openssl.cc",
+        "src/core/tsi/ssl/session_cache/ssl_session_store.h",
         "src/core/tsi/ssl_telemetry_utils.cc",
         "src/core/tsi/ssl_telemetry_utils.h",
         "src/core/tsi/ssl_transport_security.cc",
@@ -2054,7 +2068,9 @@ let package = Package(
         "src/core/util/bitset.h",
         "src/core/util/check_class_size.h",
         "src/core/util/chunked_vector.h",
+        "src/core/util/controlled_delay.cc",
         "src/core/util/construct_destruct.h",
+        "src/core/util/controlled_delay.h",
         "src/core/util/cpp_impl_of.h",
         "src/core/util/crash.cc",
         "src/core/util/crash.h",
@@ -2299,9 +2315,11 @@ let package = Package(
         "src/core/xds/xds_client/xds_bootstrap.h",
         "src/core/xds/xds_client/xds_channel_args.h",
         "src/core/xds/xds_client/xds_client.cc",
+        "src/core/xds/xds_client/xds_resource_cache.cc",
         "src/core/xds/xds_client/xds_client.h",
         "src/core/xds/xds_client/xds_locality.h",
         "src/core/xds/xds_client/xds_metrics.h",
+        "src/core/xds/xds_client/xds_resource_cache.h",
         "src/core/xds/xds_client/xds_resource_type.h",
         "src/core/xds/xds_client/xds_resource_type_impl.h",
         "src/core/xds/xds_client/xds_transport.h",
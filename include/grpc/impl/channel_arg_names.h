@@ -136,6 +136,45 @@
  */
 #define GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT \
   "grpc.server.max_pending_requests_hard_limit"
+/** Target queueing delay, in milliseconds, for requests waiting in the
+ *  server's pending queue for the application to request a call. Int valued.
+ *  If set to a positive value, the server tracks the minimum time requests
+ *  spend queued over each interval (see
+ *  GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_INTERVAL_MS); once that exceeds the
+ *  target, queued requests older than twice the target are shed instead of
+ *  served. Disabled by default.
+ */
+#define GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_TARGET_MS \
+  "grpc.server.pending_queue_codel_target_ms"
+/** Interval, in milliseconds, over which the pending queue delay is measured
+ *  for GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_TARGET_MS. Int valued. Defaults to
+ *  100.
+ */
+#define GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_INTERVAL_MS \
+  "grpc.server.pending_queue_codel_interval_ms"
+/** If set to true, while the server's pending queue is overloaded, the most
+ *  recently queued request is served first rather than the oldest, so that
+ *  requests whose clients are still waiting are favoured over ones that have
+ *  likely timed out. Overload is detected as for
+ *  GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_TARGET_MS, with a 5ms target if that
+ *  is unset. Boolean valued. Defaults to false.
+ */
+#define GRPC_ARG_SERVER_PENDING_QUEUE_ADAPTIVE_LIFO \
+  "grpc.server.pending_queue_adaptive_lifo"
+/** Per-method concurrency limits and priority classes for a server, as a JSON
+ *  string of the form
+ *    {"methodConfig": [{"name": [{"service": "pkg.Service",
+ *                                 "method": "Method"}],
+ *                       "maxConcurrentCalls": 100,
+ *                       "priority": "CRITICAL" | "DEFAULT" | "SHEDDABLE"}]}
+ *  Names follow service config rules: omitting "method" matches every method
+ *  of the service, and omitting "name" every method of the server.  Calls
+ *  beyond a method's limit fail with RESOURCE_EXHAUSTED.  CRITICAL methods are
+ *  exempt from pending queue shedding below the hard limit, while SHEDDABLE
+ *  methods are rejected once the pending queue reaches its soft limit.  Only
+ *  applies to registered methods. */
+#define GRPC_ARG_SERVER_METHOD_ADMISSION_CONFIG \
+  "grpc.server.method_admission_config"
 /** Channel arg to override the http2 :scheme header. String valued. */
 #define GRPC_ARG_HTTP2_SCHEME "grpc.http2_scheme"
 /** How many pings can the client send before needing to send a data/header
@@ -223,6 +262,35 @@
  *  protector. Defaults to zero.
  */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** Heuristic deciding when the pipelined secure endpoint unprotects reads on
+    one thread while the next read proceeds on another: one of
+    "moving_average" (the default), "consecutive_small_reads", "cost_model",
+    "always_on" or "always_off". "cost_model" measures unprotect and thread
+    hop costs on each connection and pipelines only while that pays off. */
+#define GRPC_ARG_SECURE_ENDPOINT_PIPELINING_HEURISTIC \
+  "grpc.experimental.secure_endpoint_pipelining_heuristic"
+/** If positive, the CPU heavy steps of TLS and ALTS handshakes run on a
+    dedicated pool allowing this many of them at once, instead of inline on
+    EventEngine threads. The pool is shared by all channels and servers using
+    the same handshake offload settings. Defaults to 0 (disabled). */
+#define GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_CONCURRENT \
+  "grpc.experimental.handshake_offload_max_concurrent"
+/** Maximum number of handshake steps waiting for the handshake offload pool.
+    Handshakes arriving when the queue is full fail immediately. Defaults to
+    1024. */
+#define GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_QUEUED \
+  "grpc.experimental.handshake_offload_max_queued"
+/** Handshakes whose steps waited longer than this for the handshake offload
+    pool, in milliseconds, fail rather than proceed. Defaults to 5000. */
+#define GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_QUEUE_TIME_MS \
+  "grpc.experimental.handshake_offload_max_queue_time_ms"
+/** If non-zero, once a TLS 1.3 handshake negotiating AES-GCM completes, the
+    write keys are installed into the kernel (Linux kTLS) and outgoing records
+    are encrypted by the kernel instead of by gRPC. Falls back to userspace
+    encryption whenever the kernel, the TLS library or the cipher does not
+    support it. Ignored if GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED is set, since
+    kernel TLS sockets do not accept zero-copy sends. Defaults to 0. */
+#define GRPC_ARG_TLS_KERNEL_OFFLOAD "grpc.experimental.tls_kernel_offload"
 /** Maximum metadata size (soft limit), in bytes. Note this limit applies to the
    max sum of all metadata key-value entries in a batch of headers. Some random
    sample of requests between this limit and
@@ -244,6 +312,15 @@
 /** If non-zero, expand wildcard addresses to a list of local addresses. Boolean
  * valued. */
 #define GRPC_ARG_EXPAND_WILDCARD_ADDRS "grpc.expand_wildcard_addrs"
+/** Number of listening sockets a server opens for each TCP address it binds,
+ * sharing the port through SO_REUSEPORT, which makes the kernel spread
+ * incoming connections over them. Where SO_INCOMING_CPU is available, shard i
+ * is preferred for connections received on CPU i. This only chooses the
+ * listening socket that queues a connection: it does not pin threads, and
+ * accepted connections are still polled by the shared pollers. 0 opens one
+ * shard per CPU core. Int valued, defaults to 1. Ignored when SO_REUSEPORT is
+ * unavailable or disabled. */
+#define GRPC_ARG_TCP_LISTENER_SHARDS "grpc.experimental.tcp_listener_shards"
 /** Service config data in JSON form.
     This value will be ignored if the name resolver returns a service config. A
    string value. */
@@ -371,6 +448,12 @@
 #define GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING "grpc.experimental.enable_hedging"
 /** Per-RPC retry buffer size, in bytes. Default is 256 KiB. */
 #define GRPC_ARG_PER_RPC_RETRY_BUFFER_SIZE "grpc.per_rpc_retry_buffer_size"
+/** EXPERIMENTAL. Maximum size, in bytes, of the client-side response cache.
+    Only methods with a responseCachePolicy in the service config are cached,
+    and cached responses are charged to the channel's resource quota.  If
+    zero or unset, the cache is disabled. */
+#define GRPC_ARG_EXPERIMENTAL_RESPONSE_CACHE_SIZE \
+  "grpc.experimental.response_cache_size"
 /** Channel arg that carries the bridged objective c object for custom metrics
  * logging filter. */
 #define GRPC_ARG_MOBILE_LOG_CONTEXT "grpc.mobile_log_context"
@@ -421,6 +504,20 @@
  * timeouts/backoff/retry logic, and so the actual DNS resolution may time out
  * sooner than the value specified here. */
 #define GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS "grpc.dns_ares_query_timeout"
+/** If positive, the channel's DNS resolver answers lookups from a cache
+    shared by all channels in the process, and results are reused for this
+    many milliseconds. Concurrent lookups of the same name share one query.
+    Defaults to 0 (disabled). */
+#define GRPC_ARG_DNS_CACHE_TTL_MS "grpc.experimental.dns_cache_ttl_ms"
+/** How long the shared DNS cache remembers failed lookups, in milliseconds.
+    Only used if GRPC_ARG_DNS_CACHE_TTL_MS is set. Defaults to 0. */
+#define GRPC_ARG_DNS_CACHE_NEGATIVE_TTL_MS \
+  "grpc.experimental.dns_cache_negative_ttl_ms"
+/** How long past GRPC_ARG_DNS_CACHE_TTL_MS the shared DNS cache may return a
+    result while refreshing it in the background, in milliseconds. Defaults
+    to 0. */
+#define GRPC_ARG_DNS_CACHE_STALE_TTL_MS \
+  "grpc.experimental.dns_cache_stale_ttl_ms"
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. Boolean valued. Defaults to false. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
@@ -39,6 +39,12 @@
 
 namespace grpc {
 
+// Messages up to this size are serialized into a single right-sized slice
+// rather than through a ProtoBufferWriter. Larger messages go through the
+// writer, which keeps individual allocations bounded and lets cord fields be
+// shared with the byte buffer instead of copied.
+const int kProtoBufferMaxContiguousSerializeLength = 64 * 1024;
+
 // ProtoBufferWriter must be a subclass of ::protobuf::io::ZeroCopyOutputStream.
 template <class ProtoBufferWriter, class T>
 Status GenericSerialize(
@@ -65,6 +71,21 @@ Status GenericSerialize(
 
     return grpc::Status::OK;
   }
+  if (byte_size <= kProtoBufferMaxContiguousSerializeLength) {
+    // Serialize straight into one slice of exactly the right size, charged to
+    // the call's memory allocator if there is one. This avoids the
+    // ZeroCopyOutputStream round trips, and the transport gets a single
+    // contiguous buffer to write.
+    Slice slice(allocator == nullptr ? grpc_slice_malloc(byte_size)
+                                     : allocator->MakeSlice(byte_size),
+                Slice::STEAL_REF);
+    ABSL_CHECK(slice.end() == msg.SerializeWithCachedSizesToArray(
+                                  const_cast<uint8_t*>(slice.begin())));
+    ByteBuffer tmp(&slice, 1);
+    bb->Swap(&tmp);
+
+    return grpc::Status::OK;
+  }
   ProtoBufferWriter writer(bb, kProtoBufferWriterMaxBufferLength,
                            static_cast<int>(byte_size), allocator);
   protobuf::io::CodedOutputStream cs(&writer);
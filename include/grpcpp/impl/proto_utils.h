@@ -20,11 +20,13 @@
 #define GRPCPP_IMPL_PROTO_UTILS_H
 
 #include <grpc/byte_buffer_reader.h>
+#include <grpc/event_engine/memory_allocator.h>
 #include <grpc/impl/grpc_types.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
 #include <grpcpp/impl/generic_serialize.h>
 #include <grpcpp/impl/serialization_traits.h>
+#include <grpcpp/support/arena_message_allocator.h>
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/proto_buffer_reader.h>
 #include <grpcpp/support/proto_buffer_writer.h>
@@ -51,10 +53,33 @@ class SerializationTraits<
     return GenericSerialize<ProtoBufferWriter, T>(msg, bb, own_buffer);
   }
 
+  static Status Serialize(
+      grpc_event_engine::experimental::MemoryAllocator* allocator,
+      const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
+      bool* own_buffer) {
+    return GenericSerialize<ProtoBufferWriter, T>(msg, bb, own_buffer,
+                                                  allocator);
+  }
+
   static Status Deserialize(ByteBuffer* buffer,
                             grpc::protobuf::MessageLite* msg) {
     return GenericDeserialize<ProtoBufferReader, T>(buffer, msg);
   }
+
+  // Returns the allocator for callback unary methods with arena message
+  // allocation enabled; see grpc::internal::DefaultArenaMessageAllocator.
+  template <typename ResponseT>
+  static MessageAllocator<T, ResponseT>* DefaultArenaMessageAllocator() {
+    if constexpr (std::is_base_of<grpc::protobuf::MessageLite,
+                                  ResponseT>::value) {
+      // Shared by every server and deliberately never destroyed, so that it
+      // outlives them all.
+      static auto* allocator = new ArenaMessageAllocator<T, ResponseT>();
+      return allocator;
+    } else {
+      return nullptr;
+    }
+  }
 };
 
 }  // namespace grpc
@@ -80,6 +80,11 @@ class MethodHandler {
     ABSL_CHECK_EQ(req, nullptr);
     return nullptr;
   }
+
+  // Switches the handler to allocating its request and response messages on
+  // a pooled arena, for handlers and message types that support it and have
+  // no custom MessageAllocator set. Called before the server starts.
+  virtual void EnableArenaMessageAllocation() {}
 };
 
 /// Server side rpc method class
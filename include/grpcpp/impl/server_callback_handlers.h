@@ -48,6 +48,13 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
     allocator_ = allocator;
   }
 
+  void EnableArenaMessageAllocation() final {
+    if (allocator_ == nullptr) {
+      allocator_ = grpc::internal::DefaultArenaMessageAllocator<
+          RequestType, ResponseType>::Get();
+    }
+  }
+
   void RunHandler(const HandlerParameter& param) final {
     // Arena allocate a controller structure (that includes request/response)
     grpc_call_ref(param.call->call());
@@ -247,6 +247,8 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
     context_allocator_ = std::move(context_allocator);
   }
 
+  void EnableArenaMessageAllocation() { arena_message_allocation_ = true; }
+
   void ShutdownInternal(gpr_timespec deadline)
       ABSL_LOCKS_EXCLUDED(mu_) override;
 
@@ -317,6 +319,7 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   bool has_async_generic_service_ = false;
   bool has_callback_generic_service_ = false;
   bool has_callback_methods_ = false;
+  bool arena_message_allocation_ = false;
 
   // Pointer to the wrapped grpc_server.
   grpc_server* server_;
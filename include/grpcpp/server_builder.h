@@ -299,6 +299,21 @@ class ServerBuilder {
     void EnableCallMetricRecording(
         experimental::ServerMetricRecorder* server_metric_recorder = nullptr);
 
+    /// Allocates the request and response of callback unary methods that use
+    /// protobuf messages on pooled protobuf arenas (see
+    /// grpc::ArenaMessageAllocator), rather than individually on the heap.
+    /// Methods given their own allocator via SetMessageAllocatorFor_*() keep
+    /// it.
+    void EnableArenaMessageAllocation() {
+      builder_->arena_message_allocation_ = true;
+    }
+
+    /// Sets per-method concurrency limits and priority classes, in the JSON
+    /// format described for GRPC_ARG_SERVER_METHOD_ADMISSION_CONFIG. Calls
+    /// to a method at its limit fail with RESOURCE_EXHAUSTED without being
+    /// queued. BuildAndStart() returns nullptr if the config is invalid.
+    void SetMethodAdmissionConfig(const std::string& json_config);
+
     // Creates a passive listener for Server Endpoint injection.
     ///
     /// \a PassiveListener lets applications provide pre-established connections
@@ -447,6 +462,7 @@ class ServerBuilder {
   std::shared_ptr<experimental::AuthorizationPolicyProviderInterface>
       authorization_provider_;
   experimental::ServerMetricRecorder* server_metric_recorder_ = nullptr;
+  bool arena_message_allocation_ = false;
 };
 
 }  // namespace grpc
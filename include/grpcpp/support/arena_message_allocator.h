@@ -0,0 +1,139 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
+#define GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
+
+#include <grpcpp/impl/codegen/config_protobuf.h>
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/support/message_allocator.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace grpc {
+
+namespace testing {
+class ArenaMessageAllocatorTestPeer;
+}  // namespace testing
+
+// A MessageAllocator that creates the request and response of each RPC on a
+// protobuf arena, so that the messages and all of their fields are carved out
+// of one block of memory rather than individually heap allocated. Arenas are
+// reset and pooled when the RPC completes; each starts with an initial block
+// that survives the reset, so steady-state RPCs whose messages fit in it do
+// not allocate at all.
+//
+// Register it per method with the generated SetMessageAllocatorFor_*(), or for
+// every callback unary method of a server with
+// ServerBuilder::experimental().EnableArenaMessageAllocation(). Like any
+// MessageAllocator, it must outlive the server.
+template <typename RequestT, typename ResponseT>
+class ArenaMessageAllocator final
+    : public MessageAllocator<RequestT, ResponseT> {
+ public:
+  static constexpr size_t kDefaultInitialBlockSize = 4096;
+  static constexpr size_t kDefaultMaxPooledArenas = 128;
+
+  explicit ArenaMessageAllocator(
+      size_t initial_block_size = kDefaultInitialBlockSize,
+      size_t max_pooled_arenas = kDefaultMaxPooledArenas)
+      : initial_block_size_(initial_block_size),
+        max_pooled_arenas_(max_pooled_arenas) {}
+
+  ~ArenaMessageAllocator() override {
+    for (Holder* holder : pool_) delete holder;
+  }
+
+  MessageHolder<RequestT, ResponseT>* AllocateMessages() override {
+    Holder* holder = nullptr;
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (!pool_.empty()) {
+        holder = pool_.back();
+        pool_.pop_back();
+      }
+    }
+    if (holder == nullptr) {
+      holder = new Holder(this, initial_block_size_);
+      arenas_created_.fetch_add(1, std::memory_order_relaxed);
+    }
+    holder->CreateMessages();
+    return holder;
+  }
+
+ private:
+  friend class grpc::testing::ArenaMessageAllocatorTestPeer;
+
+  class Holder final : public MessageHolder<RequestT, ResponseT> {
+   public:
+    Holder(ArenaMessageAllocator* allocator, size_t initial_block_size)
+        : allocator_(allocator),
+          initial_block_(new char[initial_block_size]),
+          arena_(initial_block_.get(), initial_block_size) {}
+
+    void CreateMessages() {
+      this->set_request(protobuf::Arena::Create<RequestT>(&arena_));
+      this->set_response(protobuf::Arena::Create<ResponseT>(&arena_));
+    }
+
+    void Release() override {
+      arena_.Reset();
+      allocator_->ReturnToPool(this);
+    }
+
+   private:
+    ArenaMessageAllocator* const allocator_;
+    std::unique_ptr<char[]> initial_block_;
+    protobuf::Arena arena_;
+  };
+
+  // The number of arenas created so far. Stays flat once the pool is warm.
+  size_t arenas_created() const {
+    return arenas_created_.load(std::memory_order_relaxed);
+  }
+
+  // The number of arenas currently in the pool, waiting to be reused.
+  size_t pooled_arenas() {
+    grpc::internal::MutexLock lock(&mu_);
+    return pool_.size();
+  }
+
+  void ReturnToPool(Holder* holder) {
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (pool_.size() < max_pooled_arenas_) {
+        pool_.push_back(holder);
+        return;
+      }
+    }
+    delete holder;
+  }
+
+  const size_t initial_block_size_;
+  const size_t max_pooled_arenas_;
+  std::atomic<size_t> arenas_created_{0};
+  grpc::internal::Mutex mu_;
+  std::vector<Holder*> pool_;
+};
+
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_ARENA_MESSAGE_ALLOCATOR_H
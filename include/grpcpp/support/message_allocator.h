@@ -19,6 +19,10 @@
 #ifndef GRPCPP_SUPPORT_MESSAGE_ALLOCATOR_H
 #define GRPCPP_SUPPORT_MESSAGE_ALLOCATOR_H
 
+#include <grpcpp/impl/serialization_traits.h>
+
+#include <type_traits>
+
 namespace grpc {
 
 // NOTE: This is an API for advanced users who need custom allocators.
@@ -66,6 +70,33 @@ class MessageAllocator {
   virtual MessageHolder<RequestT, ResponseT>* AllocateMessages() = 0;
 };
 
+namespace internal {
+
+// Supplies the allocator used for callback unary methods whose handler has
+// had EnableArenaMessageAllocation() called on it (see
+// ServerBuilder::experimental_type::EnableArenaMessageAllocation). It is
+// obtained from SerializationTraits<RequestT>::DefaultArenaMessageAllocator(),
+// which the protobuf serialization traits provide; for other messages there
+// is none.  SerializationTraits<RequestT> must be complete wherever the
+// handler is instantiated, so every translation unit sees the same allocator.
+template <typename RequestT, typename ResponseT, typename = void>
+struct DefaultArenaMessageAllocator {
+  static MessageAllocator<RequestT, ResponseT>* Get() { return nullptr; }
+};
+
+template <typename RequestT, typename ResponseT>
+struct DefaultArenaMessageAllocator<
+    RequestT, ResponseT,
+    std::void_t<decltype(SerializationTraits<RequestT>::template
+                             DefaultArenaMessageAllocator<ResponseT>())>> {
+  static MessageAllocator<RequestT, ResponseT>* Get() {
+    return SerializationTraits<RequestT>::template DefaultArenaMessageAllocator<
+        ResponseT>();
+  }
+};
+
+}  // namespace internal
+
 }  // namespace grpc
 
 #endif  // GRPCPP_SUPPORT_MESSAGE_ALLOCATOR_H
@@ -104,7 +104,8 @@ grpc_call_error ValidateClientBatch(
 
 ClientCall::ClientCall(grpc_call*, uint32_t, grpc_completion_queue* cq,
                        Slice path, std::optional<Slice> authority,
-                       bool registered_method, Timestamp deadline,
+                       RegisteredMethodConfigCache* registered_method,
+                       Timestamp deadline,
                        grpc_compression_options compression_options,
                        RefCountedPtr<Arena> arena,
                        RefCountedPtr<UnstartedCallDestination> destination)
@@ -118,9 +119,7 @@ ClientCall::ClientCall(grpc_call*, uint32_t, grpc_completion_queue* cq,
   if (authority.has_value()) {
     send_initial_metadata_->Set(HttpAuthorityMetadata(), std::move(*authority));
   }
-  send_initial_metadata_->Set(
-      GrpcRegisteredMethod(),
-      reinterpret_cast<void*>(static_cast<uintptr_t>(registered_method)));
+  send_initial_metadata_->Set(GrpcRegisteredMethod(), registered_method);
   if (deadline != Timestamp::InfFuture()) {
     send_initial_metadata_->Set(GrpcTimeoutMetadata(), deadline);
     UpdateDeadline(deadline).IgnoreError();
@@ -491,7 +490,8 @@ char* ClientCall::GetPeer() {
 grpc_call* MakeClientCall(grpc_call* parent_call, uint32_t propagation_mask,
                           grpc_completion_queue* cq, Slice path,
                           std::optional<Slice> authority,
-                          bool registered_method, Timestamp deadline,
+                          RegisteredMethodConfigCache* registered_method,
+                          Timestamp deadline,
                           grpc_compression_options compression_options,
                           RefCountedPtr<Arena> arena,
                           RefCountedPtr<UnstartedCallDestination> destination) {
@@ -42,6 +42,7 @@
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/call_utils.h"
+#include "src/core/service_config/service_config.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -61,8 +62,9 @@ class ClientCall final
  public:
   ClientCall(grpc_call* parent_call, uint32_t propagation_mask,
              grpc_completion_queue* cq, Slice path,
-             std::optional<Slice> authority, bool registered_method,
-             Timestamp deadline, grpc_compression_options compression_options,
+             std::optional<Slice> authority,
+             RegisteredMethodConfigCache* registered_method, Timestamp deadline,
+             grpc_compression_options compression_options,
              RefCountedPtr<Arena> arena,
              RefCountedPtr<UnstartedCallDestination> destination);
 
@@ -195,7 +197,8 @@ class ClientCall final
 grpc_call* MakeClientCall(grpc_call* parent_call, uint32_t propagation_mask,
                           grpc_completion_queue* cq, Slice path,
                           std::optional<Slice> authority,
-                          bool registered_method, Timestamp deadline,
+                          RegisteredMethodConfigCache* registered_method,
+                          Timestamp deadline,
                           grpc_compression_options compression_options,
                           RefCountedPtr<Arena> arena,
                           RefCountedPtr<UnstartedCallDestination> destination);
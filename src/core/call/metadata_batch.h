@@ -663,9 +663,9 @@ struct GrpcTrailersOnly {
   static absl::string_view DisplayValue(bool x) { return x ? "true" : "false"; }
 };
 
-// On the client-side, the value is a uintptr_t with a value of 1 if the call
-// has a registered/known method, or 0, if it's not known. On the server side,
-// the value is a (ChannelRegisteredMethod*).
+// On the client-side, the value is the (RegisteredMethodConfigCache*) of the
+// call's method if it is registered/known, or null if it's not known. On the
+// server side, the value is a (ChannelRegisteredMethod*).
 struct GrpcRegisteredMethod {
   static absl::string_view DebugKey() { return "GrpcRegisteredMethod"; }
   static constexpr bool kRepeatable = false;
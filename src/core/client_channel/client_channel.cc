@@ -46,6 +46,7 @@
 #include "src/core/client_channel/dynamic_filters.h"
 #include "src/core/client_channel/global_subchannel_pool.h"
 #include "src/core/client_channel/local_subchannel_pool.h"
+#include "src/core/client_channel/response_cache_interceptor.h"
 #include "src/core/client_channel/retry_interceptor.h"
 #include "src/core/client_channel/subchannel.h"
 #include "src/core/client_channel/subchannel_interface_internal.h"
@@ -65,6 +66,7 @@
 #include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/surface/call.h"
@@ -658,6 +660,15 @@ ClientChannel::ClientChannel(
       state_tracker_("client_channel", GRPC_CHANNEL_IDLE),
       subchannel_pool_(GetSubchannelPool(channel_args_)) {
   CHECK(event_engine_.get() != nullptr);
+  // Create the response cache, if enabled.
+  const int response_cache_size =
+      channel_args_.GetInt(GRPC_ARG_EXPERIMENTAL_RESPONSE_CACHE_SIZE)
+          .value_or(0);
+  if (response_cache_size > 0) {
+    response_cache_ = MakeRefCounted<ResponseCache>(
+        response_cache_size,
+        channel_args_.GetObject<ResourceQuota>()->memory_quota());
+  }
   GRPC_TRACE_LOG(client_channel, INFO)
       << "client_channel=" << this << ": creating client_channel";
   // Set initial keepalive time.
@@ -870,7 +881,7 @@ grpc_call* ClientChannel::CreateCall(
     grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* /*pollset_set_alternative*/,
     Slice path, std::optional<Slice> authority, Timestamp deadline,
-    bool /*registered_method*/,
+    RegisteredMethodConfigCache* registered_method,
     std::optional<absl::FunctionRef<void(Arena*)>> arena_init_function) {
   auto arena = call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
@@ -879,7 +890,7 @@ grpc_call* ClientChannel::CreateCall(
     (*arena_init_function)(arena.get());
   }
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
-                        std::move(authority), false, deadline,
+                        std::move(authority), registered_method, deadline,
                         compression_options(), std::move(arena), Ref());
 }
 
@@ -909,6 +920,11 @@ class FilterChainBuilderImpl final : public FilterChainBuilder {
 
   absl::StatusOr<RefCountedPtr<FilterChain>> Build() override {
     if (builder_ == nullptr) InitBuilder();
+    // The response cache sits above retries, so that a cached response
+    // short-circuits the whole attempt machinery.
+    if (channel_args_.GetObject<ResponseCache>() != nullptr) {
+      builder_->Add<ResponseCacheInterceptor>(nullptr);
+    }
     if (enable_retries_) builder_->Add<RetryInterceptor>(nullptr);
     auto top_of_stack_destination = builder_->Build(destination_);
     if (!top_of_stack_destination.ok()) {
@@ -1364,6 +1380,7 @@ void ClientChannel::UpdateServiceConfigInDataPlaneLocked(
   }
   // Modify channel args.
   ChannelArgs new_args = args.SetObject(this).SetObject(saved_service_config_);
+  if (response_cache_ != nullptr) new_args = new_args.SetObject(response_cache_);
   const bool enable_retries =
       !channel_args_.WantMinimalStack() &&
       channel_args_.GetBool(GRPC_ARG_ENABLE_RETRIES).value_or(true);
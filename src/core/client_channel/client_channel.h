@@ -18,10 +18,17 @@
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_CLIENT_CHANNEL_H
 
 #include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <utility>
 
 #include "src/core/call/metadata.h"
 #include "src/core/client_channel/client_channel_factory.h"
 #include "src/core/client_channel/config_selector.h"
+#include "src/core/client_channel/response_cache_interceptor.h"
 #include "src/core/client_channel/retry_throttle.h"
 #include "src/core/client_channel/subchannel.h"
 #include "src/core/ext/filters/channel_idle/idle_filter_state.h"
@@ -30,7 +37,9 @@
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/resolver/resolver.h"
 #include "src/core/service_config/service_config.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/single_set_ptr.h"
+#include "src/core/util/sync.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
@@ -39,8 +48,180 @@ namespace grpc_core {
 
 class ClientChannel : public Channel {
  public:
-  using PickerObservable =
-      Observable<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>>;
+  // Broadcasts the channel's current LB picker to calls.
+  //
+  // Calls that need to wait for a new picker use Next(), which is backed by
+  // an Observable<>.  In addition, the current picker is cached in per-CPU
+  // shards, so that the common case -- a pick against a picker that has not
+  // changed since the last pick on this CPU -- takes no lock and does not
+  // touch the picker's refcount.  Each shard holds its own ref to the
+  // picker, and picks borrow it.
+  //
+  // A pick announces itself in one of its shard's two reader counters,
+  // chosen by the shard's phase.  To replace the shard's picker, the shard
+  // swaps in the new one and flips the phase, so that later picks count in
+  // the other counter, and then waits for the counter of the picks that may
+  // still be using the old picker to drain before unreffing it.
+  //
+  // Each shard records the epoch at which it was filled.  Set() bumps the
+  // epoch and then drops the refs that the shards hold to the old picker,
+  // so that the old picker (and the subchannels it references) is not kept
+  // alive by idle CPUs.  A shard is refilled, under its lock, by the first
+  // pick on it that sees the new epoch.
+  class PickerObservable {
+   public:
+    using Picker = RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>;
+
+   private:
+    // Defined ahead of the public methods, whose return types are deduced
+    // from State's.
+    struct alignas(GPR_CACHELINE_SIZE) Shard {
+      // Owns a ref, or null if the shard must be refilled.
+      std::atomic<LoadBalancingPolicy::SubchannelPicker*> picker{nullptr};
+      std::atomic<uint64_t> epoch{0};
+      std::atomic<uint32_t> phase{0};
+      std::atomic<uint32_t> readers[2] = {};
+      // Serializes replacing picker.
+      Mutex mu;
+    };
+
+    class State final : public RefCounted<State> {
+     public:
+      explicit State(Picker initial)
+          : picker_(initial), observable_(std::move(initial)) {}
+
+      ~State() override {
+        for (Shard& shard : shards_) {
+          auto* picker = shard.picker.load(std::memory_order_relaxed);
+          if (picker != nullptr) picker->Unref();
+        }
+      }
+
+      void Set(Picker picker) {
+        uint64_t epoch;
+        {
+          MutexLock lock(&mu_);
+          picker_ = picker;
+          epoch = epoch_.load(std::memory_order_relaxed) + 1;
+          epoch_.store(epoch, std::memory_order_release);
+          observable_.Set(std::move(picker));
+        }
+        for (Shard& shard : shards_) {
+          MutexLock lock(&shard.mu);
+          if (shard.epoch.load(std::memory_order_relaxed) != epoch) {
+            ReplaceLocked(shard, nullptr);
+          }
+        }
+      }
+
+      auto Next(Picker current) { return observable_.Next(std::move(current)); }
+
+      template <typename F>
+      auto WithCachedPicker(F fn) {
+        using Result = std::optional<decltype(fn(
+            std::declval<LoadBalancingPolicy::SubchannelPicker&>()))>;
+        if (GPR_UNLIKELY(cache_disabled_)) return Result();
+        Shard& shard = shards_.this_cpu();
+        const uint32_t phase = shard.phase.load(std::memory_order_relaxed);
+        // The counter must be incremented before the picker is loaded, so
+        // that ReplaceLocked() either sees the increment or this pick sees
+        // the new picker.
+        shard.readers[phase].fetch_add(1, std::memory_order_seq_cst);
+        LoadBalancingPolicy::SubchannelPicker* picker = nullptr;
+        if (GPR_LIKELY(shard.epoch.load(std::memory_order_seq_cst) ==
+                       epoch_.load(std::memory_order_acquire))) {
+          picker = shard.picker.load(std::memory_order_seq_cst);
+        }
+        if (GPR_LIKELY(picker != nullptr)) {
+          Result result(fn(*picker));
+          shard.readers[phase].fetch_sub(1, std::memory_order_release);
+          return result;
+        }
+        shard.readers[phase].fetch_sub(1, std::memory_order_release);
+        // Slow path: the epoch changed since the shard was filled.
+        Picker current = Refill(shard);
+        if (current == nullptr) return Result();
+        return Result(fn(*current));
+      }
+
+      void TestOnlyDisableCache() { cache_disabled_ = true; }
+
+     private:
+      // Fills shard with the current picker, which it returns.
+      Picker Refill(Shard& shard) {
+        MutexLock lock(&shard.mu);
+        Picker picker;
+        uint64_t epoch;
+        {
+          MutexLock state_lock(&mu_);
+          picker = picker_;
+          epoch = epoch_.load(std::memory_order_relaxed);
+        }
+        if (shard.epoch.load(std::memory_order_relaxed) != epoch ||
+            shard.picker.load(std::memory_order_relaxed) != picker.get()) {
+          ReplaceLocked(shard,
+                        picker == nullptr ? nullptr : picker->Ref().release());
+          shard.epoch.store(epoch, std::memory_order_seq_cst);
+        }
+        return picker;
+      }
+
+      // Makes shard hold picker, which is an owned ref or null, and unrefs
+      // the picker it held once no pick uses it anymore.
+      static void ReplaceLocked(Shard& shard,
+                                LoadBalancingPolicy::SubchannelPicker* picker)
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+        auto* old = shard.picker.exchange(picker, std::memory_order_seq_cst);
+        if (old == nullptr) return;
+        // Picks starting from now on count in the other counter, so this
+        // one drains once the picks that may have loaded old are done.
+        const uint32_t phase = shard.phase.load(std::memory_order_relaxed);
+        shard.phase.store(phase ^ 1, std::memory_order_seq_cst);
+        while (shard.readers[phase].load(std::memory_order_seq_cst) != 0) {
+          std::this_thread::yield();
+        }
+        old->Unref();
+      }
+
+      Mutex mu_;
+      Picker picker_ ABSL_GUARDED_BY(mu_);
+      // Starts at 1, so that newly created shards (epoch 0) are never valid.
+      std::atomic<uint64_t> epoch_{1};
+      Observable<Picker> observable_;
+      bool cache_disabled_ = false;
+      PerCpu<Shard> shards_{
+          PerCpuOptions().SetCpusPerShard(1).SetMaxShards(32)};
+    };
+
+   public:
+    explicit PickerObservable(Picker initial)
+        : state_(MakeRefCounted<State>(std::move(initial))) {}
+
+    // Update the picker.  Wakes any calls waiting in Next().
+    void Set(Picker picker) { state_->Set(std::move(picker)); }
+
+    // Returns a promise that resolves to the picker when it becomes !=
+    // current.
+    auto Next(Picker current) { return state_->Next(std::move(current)); }
+
+    // If there is a current picker, invokes fn with a reference to it and
+    // returns the result; otherwise returns nullopt.
+    // The picker is only guaranteed to be alive for the duration of fn, so fn
+    // must take its own ref if it needs to retain the picker.  fn must not
+    // block: replacing the picker waits for the picks using it to finish.
+    template <typename F>
+    auto WithCachedPicker(F fn) {
+      return state_->WithCachedPicker(std::move(fn));
+    }
+
+    // Makes WithCachedPicker() always return nullopt, so that every pick
+    // goes through Next().  Must be called before any pick.  For
+    // benchmarks comparing the two paths.
+    void TestOnlyDisableCachedPicker() { state_->TestOnlyDisableCache(); }
+
+   private:
+    RefCountedPtr<State> state_;
+  };
 
   class CallDestinationFactory {
    public:
@@ -75,7 +256,8 @@ class ClientChannel : public Channel {
                         grpc_completion_queue* cq,
                         grpc_pollset_set* /*pollset_set_alternative*/,
                         Slice path, std::optional<Slice> authority,
-                        Timestamp deadline, bool registered_method,
+                        Timestamp deadline,
+                        RegisteredMethodConfigCache* registered_method,
                         std::optional<absl::FunctionRef<void(Arena*)>>
                             arena_init_function) override;
 
@@ -217,6 +399,9 @@ class ClientChannel : public Channel {
       ABSL_GUARDED_BY(*work_serializer_);
   RetryThrottlerChannelArgsUpdater retry_throttler_updater_
       ABSL_GUARDED_BY(*work_serializer_);
+  // Shared across service config updates, so that cached responses survive
+  // re-resolution.  Null if the cache is disabled.
+  RefCountedPtr<ResponseCache> response_cache_;
   OrphanablePtr<LoadBalancingPolicy> lb_policy_
       ABSL_GUARDED_BY(*work_serializer_);
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_
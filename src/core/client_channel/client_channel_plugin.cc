@@ -23,6 +23,7 @@
 
 #include "src/core/client_channel/client_channel_filter.h"
 #include "src/core/client_channel/client_channel_service_config.h"
+#include "src/core/client_channel/response_cache_service_config.h"
 #include "src/core/client_channel/retry_service_config.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -33,6 +34,7 @@ namespace grpc_core {
 void BuildClientChannelConfiguration(CoreConfiguration::Builder* builder) {
   internal::ClientChannelServiceConfigParser::Register(builder);
   RetryServiceConfigParser::Register(builder);
+  ResponseCacheServiceConfigParser::Register(builder);
   builder->channel_init()
       ->RegisterV2Filter<ClientChannelFilter>(GRPC_CLIENT_CHANNEL)
       .Terminal();
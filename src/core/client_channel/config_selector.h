@@ -110,8 +110,12 @@ class DefaultConfigSelector final : public ConfigSelector {
       GetCallConfigArgs args) override {
     Slice* path = args.initial_metadata->get_pointer(HttpPathMetadata());
     GRPC_CHECK_NE(path, nullptr);
+    auto* registered_method = static_cast<RegisteredMethodConfigCache*>(
+        args.initial_metadata->get(GrpcRegisteredMethod()).value_or(nullptr));
     auto* parsed_method_configs =
-        service_config_->GetMethodParsedConfigVector(path->c_slice());
+        registered_method != nullptr
+            ? registered_method->Get(*service_config_, *path)
+            : service_config_->GetMethodParsedConfigVector(path->c_slice());
     args.service_config_call_data->SetServiceConfig(service_config_,
                                                     parsed_method_configs);
     return filter_chain_;
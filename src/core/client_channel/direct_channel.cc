@@ -77,7 +77,7 @@ grpc_call* DirectChannel::CreateCall(
     grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* /*pollset_set_alternative*/,
     Slice path, std::optional<Slice> authority, Timestamp deadline,
-    bool /*registered_method*/,
+    RegisteredMethodConfigCache* registered_method,
     std::optional<absl::FunctionRef<void(Arena*)>> arena_init_function) {
   auto arena = call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
@@ -86,7 +86,7 @@ grpc_call* DirectChannel::CreateCall(
     (*arena_init_function)(arena.get());
   }
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
-                        std::move(authority), false, deadline,
+                        std::move(authority), registered_method, deadline,
                         compression_options(), std::move(arena), Ref());
 }
 
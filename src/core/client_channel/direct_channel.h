@@ -19,6 +19,7 @@
 
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/service_config/service_config.h"
 
 namespace grpc_core {
 
@@ -62,7 +63,7 @@ class DirectChannel final : public Channel {
                         grpc_completion_queue* cq,
                         grpc_pollset_set* pollset_set_alternative, Slice path,
                         std::optional<Slice> authority, Timestamp deadline,
-                        bool registered_method,
+                        RegisteredMethodConfigCache* registered_method,
                         std::optional<absl::FunctionRef<void(Arena*)>>
                             arena_init_function) override;
   grpc_event_engine::experimental::EventEngine* event_engine() const override {
@@ -14,12 +14,16 @@
 
 #include "src/core/client_channel/load_balanced_call_destination.h"
 
+#include <utility>
+#include <variant>
+
 #include "src/core/call/status_util.h"
 #include "src/core/client_channel/client_channel.h"
 #include "src/core/client_channel/client_channel_internal.h"
 #include "src/core/client_channel/lb_metadata.h"
 #include "src/core/client_channel/subchannel.h"
 #include "src/core/config/core_configuration.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "absl/log/log.h"
@@ -208,19 +212,47 @@ void LoadBalancedCallDestination::StartCall(
             CheckDelayed(Loop(
                 [last_picker =
                      RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>(),
-                 unstarted_handler, picker]() mutable {
-                  return Map(
-                      picker.Next(last_picker),
-                      [unstarted_handler, &last_picker](
-                          RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>
-                              picker) mutable {
-                        CHECK_NE(picker.get(), nullptr);
-                        last_picker = std::move(picker);
-                        // Returns 3 possible things:
-                        // - Continue to queue the pick
-                        // - non-OK status to fail the pick
-                        // - a connected subchannel to complete the pick
-                        return PickSubchannel(*last_picker, unstarted_handler);
+                 tried_cached_picker = false, unstarted_handler,
+                 picker]() mutable {
+                  return If(
+                      !std::exchange(tried_cached_picker, true),
+                      // Fast path: pick using the per-CPU cached picker,
+                      // without going through the Observable.  If the pick
+                      // is queued, hold on to the picker so that we wait for
+                      // a new one.
+                      [&]() {
+                        return picker
+                            .WithCachedPicker(
+                                [&](LoadBalancingPolicy::SubchannelPicker&
+                                        cached_picker) {
+                                  auto result = PickSubchannel(
+                                      cached_picker, unstarted_handler);
+                                  if (std::holds_alternative<Continue>(
+                                          result)) {
+                                    last_picker = cached_picker.Ref();
+                                  }
+                                  return result;
+                                })
+                            .value_or(Continue{});
+                      },
+                      // Slow path: wait for a picker other than the last one
+                      // we tried.
+                      [&]() {
+                        return Map(
+                            picker.Next(last_picker),
+                            [unstarted_handler, &last_picker](
+                                RefCountedPtr<
+                                    LoadBalancingPolicy::SubchannelPicker>
+                                    picker) mutable {
+                              CHECK_NE(picker.get(), nullptr);
+                              last_picker = std::move(picker);
+                              // Returns 3 possible things:
+                              // - Continue to queue the pick
+                              // - non-OK status to fail the pick
+                              // - a connected subchannel to complete the pick
+                              return PickSubchannel(*last_picker,
+                                                    unstarted_handler);
+                            });
                       });
                 })),
             // Create call stack on the connected subchannel.
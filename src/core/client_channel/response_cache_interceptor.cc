@@ -0,0 +1,373 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/client_channel/response_cache_interceptor.h"
+
+#include <grpc/status.h>
+
+#include <iterator>
+#include <utility>
+
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/promise/for_each.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/service_config/service_config_call_data.h"
+#include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Appends a length-prefixed field to a cache key, so that the
+// concatenation of fields is unambiguous.
+void AppendKeyField(absl::string_view field, std::string* key) {
+  absl::StrAppend(key, field.size(), ":", field);
+}
+
+size_t ResponseSize(const ResponseCache::Response& response) {
+  return response.server_initial_metadata->TransportSize() +
+         response.message->payload()->Length() +
+         response.server_trailing_metadata->TransportSize();
+}
+
+ServerMetadataHandle CopyMetadata(const ServerMetadata& md) {
+  return Arena::MakePooled<ServerMetadata>(md.Copy());
+}
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// ResponseCache
+
+void ResponseCache::InFlightRequest::Finish(
+    std::shared_ptr<const Response> response) {
+  {
+    MutexLock lock(&mu_);
+    response_ = std::move(response);
+  }
+  done_.Set();
+}
+
+ResponseCache::ResponseCache(size_t max_size_bytes,
+                             MemoryQuotaRefPtr memory_quota)
+    : max_size_bytes_(max_size_bytes),
+      memory_owner_(memory_quota->CreateMemoryOwner()) {}
+
+ResponseCache::~ResponseCache() {
+  MutexLock lock(&mu_);
+  ClearLocked();
+}
+
+void ResponseCache::Orphaned() {
+  std::vector<RefCountedPtr<InFlightRequest>> in_flight;
+  {
+    MutexLock lock(&mu_);
+    ClearLocked();
+    for (auto& [key, request] : in_flight_) {
+      in_flight.push_back(std::move(request));
+    }
+    in_flight_.clear();
+    memory_owner_.Reset();
+  }
+  // Wake any followers; they will send their own RPCs.
+  for (auto& request : in_flight) request->Finish(nullptr);
+}
+
+ResponseCache::LookupResult ResponseCache::Lookup(absl::string_view key) {
+  LookupResult result;
+  MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    EntryList::iterator entry = it->second;
+    if (entry->expiration > Timestamp::Now()) {
+      lru_.splice(lru_.begin(), lru_, entry);
+      result.response = entry->response;
+      return result;
+    }
+    RemoveLocked(entry);
+  }
+  auto in_flight = in_flight_.find(key);
+  if (in_flight == in_flight_.end()) {
+    in_flight = in_flight_
+                    .emplace(std::string(key),
+                             MakeRefCounted<InFlightRequest>())
+                    .first;
+    result.is_leader = true;
+  }
+  result.in_flight = in_flight->second;
+  return result;
+}
+
+void ResponseCache::Finish(absl::string_view key,
+                           const RefCountedPtr<InFlightRequest>& in_flight,
+                           std::shared_ptr<const Response> response,
+                           Duration ttl) {
+  {
+    MutexLock lock(&mu_);
+    auto it = in_flight_.find(key);
+    if (it == in_flight_.end() || it->second != in_flight) return;
+    in_flight_.erase(it);
+    if (response != nullptr && memory_owner_.is_valid()) {
+      const size_t size_bytes = key.size() + ResponseSize(*response);
+      if (size_bytes <= max_size_bytes_) {
+        auto existing = entries_.find(key);
+        if (existing != entries_.end()) RemoveLocked(existing->second);
+        while (size_bytes_ + size_bytes > max_size_bytes_) {
+          RemoveLocked(std::prev(lru_.end()));
+        }
+        memory_owner_.Reserve(MemoryRequest(size_bytes));
+        size_bytes_ += size_bytes;
+        lru_.push_front(Entry{std::string(key), response, size_bytes,
+                              Timestamp::Now() + ttl});
+        entries_.emplace(lru_.front().key, lru_.begin());
+        MaybePostReclaimerLocked();
+      }
+    }
+  }
+  in_flight->Finish(std::move(response));
+}
+
+void ResponseCache::RemoveLocked(EntryList::iterator it) {
+  memory_owner_.Release(it->size_bytes);
+  size_bytes_ -= it->size_bytes;
+  entries_.erase(it->key);
+  lru_.erase(it);
+}
+
+void ResponseCache::ClearLocked() {
+  while (!lru_.empty()) RemoveLocked(lru_.begin());
+}
+
+void ResponseCache::MaybePostReclaimerLocked() {
+  if (reclaimer_posted_) return;
+  reclaimer_posted_ = true;
+  memory_owner_.PostReclaimer(
+      ReclamationPass::kBenign,
+      [self = WeakRef()](std::optional<ReclamationSweep> sweep) {
+        if (!sweep.has_value()) return;
+        GRPC_TRACE_LOG(resource_quota, INFO)
+            << "response cache: benign reclamation to free memory";
+        MutexLock lock(&self->mu_);
+        self->ClearLocked();
+        self->reclaimer_posted_ = false;
+      });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ResponseCacheInterceptor
+
+ResponseCacheInterceptor::ResponseCacheInterceptor(const ChannelArgs& args)
+    : cache_(args.GetObjectRef<ResponseCache>()),
+      service_config_parser_index_(
+          ResponseCacheServiceConfigParser::ParserIndex()) {}
+
+const ResponseCacheMethodConfig* ResponseCacheInterceptor::GetPolicy() {
+  auto* svc_cfg_call_data = MaybeGetContext<ServiceConfigCallData>();
+  if (svc_cfg_call_data == nullptr) return nullptr;
+  return static_cast<const ResponseCacheMethodConfig*>(
+      svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
+}
+
+void ResponseCacheInterceptor::InterceptCall(
+    UnstartedCallHandler unstarted_call_handler) {
+  const ResponseCacheMethodConfig* policy = GetPolicy();
+  if (cache_ == nullptr || policy == nullptr) {
+    PassThrough(std::move(unstarted_call_handler));
+    return;
+  }
+  auto call_handler = Consume(std::move(unstarted_call_handler));
+  auto* arena = call_handler.arena();
+  auto call = arena->MakeRefCounted<Call>(
+      RefAsSubclass<ResponseCacheInterceptor>(), std::move(call_handler),
+      policy);
+  call->Start();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ResponseCacheInterceptor::Call
+
+ResponseCacheInterceptor::Call::Call(
+    RefCountedPtr<ResponseCacheInterceptor> interceptor,
+    CallHandler call_handler, const ResponseCacheMethodConfig* policy)
+    : call_handler_(std::move(call_handler)),
+      interceptor_(std::move(interceptor)),
+      policy_(policy) {}
+
+ResponseCacheInterceptor::Call::~Call() {
+  // If the leader never saw trailing metadata (e.g. it was cancelled), let
+  // the followers go ahead on their own.
+  if (is_leader_) FinishLeader(nullptr);
+}
+
+std::string ResponseCacheInterceptor::Call::MakeKey() const {
+  std::string key;
+  const Slice* path = client_initial_metadata_->get_pointer(HttpPathMetadata());
+  AppendKeyField(path == nullptr ? "" : path->as_string_view(), &key);
+  AppendKeyField(client_messages_[0]->payload()->JoinIntoString(), &key);
+  std::string buffer;
+  for (const std::string& name : policy_->key_metadata()) {
+    auto value = client_initial_metadata_->GetStringValue(name, &buffer);
+    // Distinguish an absent key from an empty value.
+    if (!value.has_value()) {
+      key.push_back('-');
+    } else {
+      key.push_back('+');
+      AppendKeyField(*value, &key);
+    }
+  }
+  return key;
+}
+
+void ResponseCacheInterceptor::Call::Reply(
+    const ResponseCache::Response& response) {
+  call_handler_.SpawnPushServerInitialMetadata(
+      CopyMetadata(*response.server_initial_metadata));
+  call_handler_.SpawnPushMessage(response.message->Clone());
+  call_handler_.SpawnPushServerTrailingMetadata(
+      CopyMetadata(*response.server_trailing_metadata));
+}
+
+auto ResponseCacheInterceptor::Call::ServerToClient() {
+  return TrySeq(
+      initiator_.PullServerInitialMetadata(),
+      [self = Ref()](std::optional<ServerMetadataHandle> metadata) {
+        const bool has_md = metadata.has_value();
+        return If(
+            has_md,
+            [self, md = std::move(metadata)]() mutable {
+              if (self->is_leader_) {
+                self->server_initial_metadata_ = CopyMetadata(**md);
+              }
+              self->call_handler_.SpawnPushServerInitialMetadata(
+                  std::move(*md));
+              return Seq(
+                  ForEach(MessagesFrom(self->initiator_),
+                          [self](MessageHandle message) {
+                            if (self->is_leader_ &&
+                                ++self->num_server_messages_ == 1) {
+                              self->server_message_ = message->Clone();
+                            }
+                            self->call_handler_.SpawnPushMessage(
+                                std::move(message));
+                            return Success{};
+                          }),
+                  self->initiator_.PullServerTrailingMetadata(),
+                  [self](ServerMetadataHandle md) {
+                    self->OnServerTrailingMetadata(*md);
+                    self->call_handler_.SpawnPushServerTrailingMetadata(
+                        std::move(md));
+                    return absl::OkStatus();
+                  });
+            },
+            [self]() {
+              return Map(self->initiator_.PullServerTrailingMetadata(),
+                         [self](ServerMetadataHandle md) {
+                           self->OnServerTrailingMetadata(*md);
+                           self->call_handler_.SpawnPushServerTrailingMetadata(
+                               std::move(md));
+                           return absl::OkStatus();
+                         });
+            });
+      });
+}
+
+void ResponseCacheInterceptor::Call::Forward() {
+  initiator_ = interceptor_->MakeChildCall(std::move(client_initial_metadata_),
+                                           call_handler_.arena()->Ref());
+  call_handler_.AddChildCall(initiator_);
+  for (auto& message : client_messages_) {
+    initiator_.SpawnPushMessage(std::move(message));
+  }
+  client_messages_.clear();
+  initiator_.SpawnFinishSends();
+  initiator_.SpawnGuarded("server_to_client",
+                          [self = Ref()]() { return self->ServerToClient(); });
+}
+
+auto ResponseCacheInterceptor::Call::Dispatch() {
+  std::shared_ptr<const ResponseCache::Response> cached;
+  if (client_messages_.size() == 1) {
+    key_ = MakeKey();
+    auto lookup = interceptor_->cache_->Lookup(key_);
+    cached = std::move(lookup.response);
+    in_flight_ = std::move(lookup.in_flight);
+    is_leader_ = lookup.is_leader;
+  }
+  GRPC_TRACE_LOG(client_channel_call, INFO)
+      << "response cache: " << (cached != nullptr ? "hit" : "miss")
+      << (is_leader_ ? " (leader)" : "");
+  const bool is_follower = in_flight_ != nullptr && !is_leader_;
+  return Map(
+      If(
+          is_follower, [in_flight = in_flight_]() { return in_flight->Wait(); },
+          []() { return Empty{}; }),
+      [self = Ref(), cached = std::move(cached)](Empty) mutable {
+               if (cached == nullptr && !self->is_leader_ &&
+                   self->in_flight_ != nullptr) {
+                 cached = self->in_flight_->response();
+                 self->in_flight_.reset();
+               }
+               if (cached != nullptr) {
+                 self->Reply(*cached);
+               } else {
+                 self->Forward();
+               }
+               return absl::OkStatus();
+             });
+}
+
+void ResponseCacheInterceptor::Call::Start() {
+  call_handler_.SpawnGuarded("response_cache", [self = Ref()]() {
+    return TrySeq(
+        self->call_handler_.PullClientInitialMetadata(),
+        [self](ClientMetadataHandle metadata) {
+          self->client_initial_metadata_ = std::move(metadata);
+          // Only unary requests are cacheable, so buffer the whole request
+          // before deciding what to do with it.
+          return ForEach(MessagesFrom(self->call_handler_),
+                         [self](MessageHandle message) {
+                           self->client_messages_.push_back(std::move(message));
+                           return Success{};
+                         });
+        },
+        [self]() { return self->Dispatch(); });
+  });
+}
+
+void ResponseCacheInterceptor::Call::OnServerTrailingMetadata(
+    const ServerMetadata& md) {
+  if (!is_leader_) return;
+  std::shared_ptr<const ResponseCache::Response> response;
+  if (md.get(GrpcStatusMetadata()) == GRPC_STATUS_OK &&
+      server_initial_metadata_ != nullptr && num_server_messages_ == 1) {
+    response = std::make_shared<const ResponseCache::Response>(
+        ResponseCache::Response{std::move(server_initial_metadata_),
+                                std::move(server_message_), CopyMetadata(md)});
+  }
+  FinishLeader(std::move(response));
+}
+
+void ResponseCacheInterceptor::Call::FinishLeader(
+    std::shared_ptr<const ResponseCache::Response> response) {
+  is_leader_ = false;
+  interceptor_->cache_->Finish(key_, in_flight_, std::move(response),
+                               policy_->ttl());
+  in_flight_.reset();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,202 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RESPONSE_CACHE_INTERCEPTOR_H
+#define GRPC_SRC_CORE_CLIENT_CHANNEL_RESPONSE_CACHE_INTERCEPTOR_H
+
+#include <stddef.h>
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "src/core/call/interception_chain.h"
+#include "src/core/call/message.h"
+#include "src/core/call/metadata.h"
+#include "src/core/client_channel/response_cache_service_config.h"
+#include "src/core/filter/filter_args.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/dual_ref_counted.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// A byte-bounded LRU cache of unary responses, shared by all calls on a
+// channel.  Concurrent requests for the same key are coalesced: the first
+// caller becomes the leader and performs the RPC, and later callers wait for
+// its result instead of sending duplicate requests.
+//
+// Cached bytes are charged to the channel's resource quota, and the whole
+// cache is dropped if the quota asks for memory back.
+class ResponseCache final : public DualRefCounted<ResponseCache> {
+ public:
+  struct Response {
+    ServerMetadataHandle server_initial_metadata;
+    MessageHandle message;
+    ServerMetadataHandle server_trailing_metadata;
+  };
+
+  // Tracks an RPC that is currently being performed by a leader.
+  class InFlightRequest final : public RefCounted<InFlightRequest> {
+   public:
+    // Resolves once the leader has finished.
+    auto Wait() { return done_.Wait(); }
+    // The leader's response, or null if it was not cacheable.  Only
+    // meaningful once Wait() has resolved.
+    std::shared_ptr<const Response> response() const {
+      MutexLock lock(&mu_);
+      return response_;
+    }
+
+   private:
+    friend class ResponseCache;
+
+    void Finish(std::shared_ptr<const Response> response);
+
+    mutable Mutex mu_;
+    std::shared_ptr<const Response> response_ ABSL_GUARDED_BY(mu_);
+    InterActivityLatch<void> done_;
+  };
+
+  struct LookupResult {
+    // Set on a cache hit.
+    std::shared_ptr<const Response> response;
+    // Set on a cache miss: the request the caller should lead or follow.
+    RefCountedPtr<InFlightRequest> in_flight;
+    bool is_leader = false;
+  };
+
+  ResponseCache(size_t max_size_bytes, MemoryQuotaRefPtr memory_quota);
+  ~ResponseCache() override;
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.response_cache";
+  }
+  static int ChannelArgsCompare(const ResponseCache* a,
+                                const ResponseCache* b) {
+    return QsortCompare(a, b);
+  }
+
+  LookupResult Lookup(absl::string_view key);
+
+  // Called by the leader for `key` once its RPC completes.  If `response` is
+  // non-null it is inserted into the cache for `ttl`.  Either way, any
+  // followers are woken up.  Calling this more than once is a no-op.
+  void Finish(absl::string_view key,
+              const RefCountedPtr<InFlightRequest>& in_flight,
+              std::shared_ptr<const Response> response, Duration ttl);
+
+  size_t size_bytes() const {
+    MutexLock lock(&mu_);
+    return size_bytes_;
+  }
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const Response> response;
+    size_t size_bytes;
+    Timestamp expiration;
+  };
+  using EntryList = std::list<Entry>;
+
+  void Orphaned() override;
+
+  void RemoveLocked(EntryList::iterator it) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ClearLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void MaybePostReclaimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const size_t max_size_bytes_;
+  mutable Mutex mu_;
+  MemoryOwner memory_owner_ ABSL_GUARDED_BY(mu_);
+  bool reclaimer_posted_ ABSL_GUARDED_BY(mu_) = false;
+  size_t size_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+  // Most recently used entries are at the front.
+  EntryList lru_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<absl::string_view, EntryList::iterator> entries_
+      ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, RefCountedPtr<InFlightRequest>> in_flight_
+      ABSL_GUARDED_BY(mu_);
+};
+
+// Serves unary RPCs for methods with a responseCachePolicy out of the
+// channel's ResponseCache.
+class ResponseCacheInterceptor final : public Interceptor {
+ public:
+  static absl::StatusOr<RefCountedPtr<ResponseCacheInterceptor>> Create(
+      const ChannelArgs& args, const FilterArgs& /*filter_args*/) {
+    return MakeRefCounted<ResponseCacheInterceptor>(args);
+  }
+
+  explicit ResponseCacheInterceptor(const ChannelArgs& args);
+
+  void Orphaned() override {}
+
+ protected:
+  void InterceptCall(UnstartedCallHandler unstarted_call_handler) override;
+
+ private:
+  class Call final
+      : public RefCounted<Call, NonPolymorphicRefCount, UnrefCallDtor> {
+   public:
+    Call(RefCountedPtr<ResponseCacheInterceptor> interceptor,
+         CallHandler call_handler, const ResponseCacheMethodConfig* policy);
+    ~Call();
+
+    void Start();
+
+   private:
+    auto Dispatch();
+    auto ServerToClient();
+    void Reply(const ResponseCache::Response& response);
+    void Forward();
+    void OnServerTrailingMetadata(const ServerMetadata& md);
+    void FinishLeader(std::shared_ptr<const ResponseCache::Response> response);
+    std::string MakeKey() const;
+
+    CallHandler call_handler_;
+    CallInitiator initiator_;
+    RefCountedPtr<ResponseCacheInterceptor> interceptor_;
+    const ResponseCacheMethodConfig* const policy_;
+    ClientMetadataHandle client_initial_metadata_;
+    std::vector<MessageHandle> client_messages_;
+    std::string key_;
+    RefCountedPtr<ResponseCache::InFlightRequest> in_flight_;
+    bool is_leader_ = false;
+    // Copies of the server response, kept by the leader for the cache.
+    ServerMetadataHandle server_initial_metadata_;
+    MessageHandle server_message_;
+    size_t num_server_messages_ = 0;
+  };
+
+  const ResponseCacheMethodConfig* GetPolicy();
+
+  const RefCountedPtr<ResponseCache> cache_;
+  const size_t service_config_parser_index_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_CLIENT_CHANNEL_RESPONSE_CACHE_INTERCEPTOR_H
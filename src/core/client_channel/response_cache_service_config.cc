@@ -0,0 +1,112 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/client_channel/response_cache_service_config.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+#include <utility>
+
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/util/json/json_channel_args.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+
+//
+// ResponseCacheMethodConfig
+//
+
+const JsonLoaderInterface* ResponseCacheMethodConfig::JsonLoader(
+    const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<ResponseCacheMethodConfig>()
+          .Field("ttl", &ResponseCacheMethodConfig::ttl_)
+          .OptionalField("keyMetadata",
+                         &ResponseCacheMethodConfig::key_metadata_)
+          .Finish();
+  return loader;
+}
+
+void ResponseCacheMethodConfig::JsonPostLoad(const Json& /*json*/,
+                                             const JsonArgs& /*args*/,
+                                             ValidationErrors* errors) {
+  // Validate ttl.
+  {
+    ValidationErrors::ScopedField field(errors, ".ttl");
+    if (!errors->FieldHasErrors() && ttl_ <= Duration::Zero()) {
+      errors->AddError("must be greater than 0");
+    }
+  }
+  // Validate keyMetadata.  Metadata keys are matched exactly, so they must
+  // be given in the canonical lower-case form.
+  for (size_t i = 0; i < key_metadata_.size(); ++i) {
+    ValidationErrors::ScopedField field(
+        errors, absl::StrCat(".keyMetadata[", i, "]"));
+    const std::string& key = key_metadata_[i];
+    if (key.empty()) {
+      errors->AddError("must be non-empty");
+    } else if (absl::AsciiStrToLower(key) != key) {
+      errors->AddError("must be lower case");
+    } else if (absl::StartsWith(key, ":")) {
+      errors->AddError("pseudo-headers not supported");
+    }
+  }
+}
+
+//
+// ResponseCacheServiceConfigParser
+//
+
+size_t ResponseCacheServiceConfigParser::ParserIndex() {
+  return CoreConfiguration::Get().service_config_parser().GetParserIndex(
+      parser_name());
+}
+
+void ResponseCacheServiceConfigParser::Register(
+    CoreConfiguration::Builder* builder) {
+  builder->service_config_parser()->RegisterParser(
+      std::make_unique<ResponseCacheServiceConfigParser>());
+}
+
+namespace {
+
+struct MethodConfig {
+  std::unique_ptr<ResponseCacheMethodConfig> response_cache_policy;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<MethodConfig>()
+            .OptionalField("responseCachePolicy",
+                           &MethodConfig::response_cache_policy)
+            .Finish();
+    return loader;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<ServiceConfigParser::ParsedConfig>
+ResponseCacheServiceConfigParser::ParsePerMethodParams(
+    const ChannelArgs& args, const Json& json, ValidationErrors* errors) {
+  auto method_params =
+      LoadFromJson<MethodConfig>(json, JsonChannelArgs(args), errors);
+  return std::move(method_params.response_cache_policy);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,86 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RESPONSE_CACHE_SERVICE_CONFIG_H
+#define GRPC_SRC_CORE_CLIENT_CHANNEL_RESPONSE_CACHE_SERVICE_CONFIG_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/service_config/service_config_parser.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// Per-method response cache policy.  A method is only cacheable if it has
+// one of these in its method config.
+class ResponseCacheMethodConfig final
+    : public ServiceConfigParser::ParsedConfig {
+ public:
+  // How long a cached response may be served for.
+  Duration ttl() const { return ttl_; }
+  // Names of client initial metadata entries whose values are part of the
+  // cache key, in addition to the method and the serialized request.
+  const std::vector<std::string>& key_metadata() const {
+    return key_metadata_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
+                    ValidationErrors* errors);
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink,
+                            const ResponseCacheMethodConfig& config) {
+    sink.Append(absl::StrCat("ttl:", config.ttl_, " key_metadata:[",
+                             absl::StrJoin(config.key_metadata_, ","), "]"));
+  }
+
+ private:
+  Duration ttl_;
+  std::vector<std::string> key_metadata_;
+};
+
+class ResponseCacheServiceConfigParser final
+    : public ServiceConfigParser::Parser {
+ public:
+  absl::string_view name() const override { return parser_name(); }
+
+  std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
+      const ChannelArgs& args, const Json& json,
+      ValidationErrors* errors) override;
+
+  static size_t ParserIndex();
+  static void Register(CoreConfiguration::Builder* builder);
+
+ private:
+  static absl::string_view parser_name() { return "response_cache"; }
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_CLIENT_CHANNEL_RESPONSE_CACHE_SERVICE_CONFIG_H
@@ -599,6 +599,14 @@ bool RetryFilter::LegacyCallData::CallAttempt::ShouldRetry(
           << server_pushback->millis() << " ms";
     }
   }
+  // Charge the retry budget only now that the retry will be sent.
+  if (calld_->retry_throttler_ != nullptr &&
+      !calld_->retry_throttler_->RecordRetry()) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << "chand=" << calld_->chand_ << " calld=" << calld_
+        << " attempt=" << this << ": retries throttled";
+    return false;
+  }
   // We should retry.
   return true;
 }
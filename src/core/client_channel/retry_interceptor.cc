@@ -114,6 +114,12 @@ std::optional<Duration> RetryState::ShouldRetry(
                                 << " not retrying due to server push-back";
     return std::nullopt;
   }
+  // Charge the retry budget only now that the retry will be sent.
+  if (retry_throttler_ != nullptr && !retry_throttler_->RecordRetry()) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string() << " retries throttled";
+    return std::nullopt;
+  }
   // We should retry.
   Duration next_attempt_timeout;
   if (server_pushback.has_value()) {
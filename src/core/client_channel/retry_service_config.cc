@@ -110,6 +110,44 @@ void RetryGlobalConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+//
+// RetryGlobalConfig::RetryBudget
+//
+
+const JsonLoaderInterface* RetryGlobalConfig::RetryBudget::JsonLoader(
+    const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<RetryBudget>()
+          .Field("budgetPercent", &RetryBudget::budget_percent_)
+          .OptionalField("minRetriesPerSecond",
+                         &RetryBudget::min_retries_per_second_)
+          .OptionalField("ttl", &RetryBudget::ttl_)
+          .Finish();
+  return loader;
+}
+
+void RetryGlobalConfig::RetryBudget::JsonPostLoad(const Json& /*json*/,
+                                                  const JsonArgs& /*args*/,
+                                                  ValidationErrors* errors) {
+  // Validate budgetPercent.
+  {
+    ValidationErrors::ScopedField field(errors, ".budgetPercent");
+    if (!errors->FieldHasErrors() &&
+        (budget_percent_ < 0 || budget_percent_ > 100)) {
+      errors->AddError("must be in the range [0, 100]");
+    }
+  }
+  // Validate ttl.  The window is tracked in fixed-size slots, so very
+  // short windows would not be meaningful.
+  {
+    ValidationErrors::ScopedField field(errors, ".ttl");
+    if (!errors->FieldHasErrors() &&
+        (ttl_ < Duration::Seconds(1) || ttl_ > Duration::Seconds(60))) {
+      errors->AddError("must be in the range [1s, 60s]");
+    }
+  }
+}
+
 //
 // RetryMethodConfig
 //
@@ -230,14 +268,24 @@ namespace {
 
 struct GlobalConfig {
   std::unique_ptr<RetryGlobalConfig> retry_throttling;
+  std::optional<RetryGlobalConfig::RetryBudget> retry_budget;
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto* loader =
         JsonObjectLoader<GlobalConfig>()
             .OptionalField("retryThrottling", &GlobalConfig::retry_throttling)
+            .OptionalField("retryBudget", &GlobalConfig::retry_budget)
             .Finish();
     return loader;
   }
+
+  void JsonPostLoad(const Json& /*json*/, const JsonArgs& /*args*/,
+                    ValidationErrors* errors) {
+    if (retry_throttling != nullptr && retry_budget.has_value()) {
+      ValidationErrors::ScopedField field(errors, ".retryBudget");
+      errors->AddError("cannot be combined with retryThrottling");
+    }
+  }
 };
 
 }  // namespace
@@ -247,6 +295,9 @@ RetryServiceConfigParser::ParseGlobalParams(const ChannelArgs& /*args*/,
                                             const Json& json,
                                             ValidationErrors* errors) {
   auto global_params = LoadFromJson<GlobalConfig>(json, JsonArgs(), errors);
+  if (global_params.retry_budget.has_value()) {
+    return std::make_unique<RetryGlobalConfig>(*global_params.retry_budget);
+  }
   return std::move(global_params.retry_throttling);
 }
 
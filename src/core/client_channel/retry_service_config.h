@@ -17,12 +17,14 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_SERVICE_CONFIG_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_SERVICE_CONFIG_H
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "src/core/call/status_util.h"
 #include "src/core/config/core_configuration.h"
@@ -39,8 +41,42 @@ namespace grpc_core {
 
 class RetryGlobalConfig final : public ServiceConfigParser::ParsedConfig {
  public:
+  // Retry budget, used instead of the token bucket when configured.
+  // Retries sent within the last `ttl` are capped at `budget_percent`
+  // percent of the successful requests in that window, but at least
+  // `min_retries_per_second` retries per second are always allowed.
+  class RetryBudget {
+   public:
+    float budget_percent() const { return budget_percent_; }
+    uint32_t min_retries_per_second() const { return min_retries_per_second_; }
+    Duration ttl() const { return ttl_; }
+
+    bool operator==(const RetryBudget& other) const {
+      return budget_percent_ == other.budget_percent_ &&
+             min_retries_per_second_ == other.min_retries_per_second_ &&
+             ttl_ == other.ttl_;
+    }
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+    void JsonPostLoad(const Json& json, const JsonArgs& args,
+                      ValidationErrors* errors);
+
+   private:
+    float budget_percent_ = 0;
+    uint32_t min_retries_per_second_ = 10;
+    Duration ttl_ = Duration::Seconds(10);
+  };
+
+  RetryGlobalConfig() = default;
+  explicit RetryGlobalConfig(RetryBudget retry_budget)
+      : retry_budget_(retry_budget) {}
+
+  // Zero if retryThrottling is not configured.
   uintptr_t max_milli_tokens() const { return max_milli_tokens_; }
   uintptr_t milli_token_ratio() const { return milli_token_ratio_; }
+  const std::optional<RetryBudget>& retry_budget() const {
+    return retry_budget_;
+  }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs& args,
@@ -49,6 +85,7 @@ class RetryGlobalConfig final : public ServiceConfigParser::ParsedConfig {
  private:
   uintptr_t max_milli_tokens_ = 0;
   uintptr_t milli_token_ratio_ = 0;
+  std::optional<RetryBudget> retry_budget_;
 };
 
 class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
@@ -102,6 +139,10 @@ class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
 
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING};
+  }
+
   static size_t ParserIndex();
   static void Register(CoreConfiguration::Builder* builder);
 
@@ -18,17 +18,34 @@
 
 #include "src/core/client_channel/retry_throttle.h"
 
+#include <grpc/impl/channel_arg_names.h>
+
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 
+#include "src/core/client_channel/client_channel_args.h"
 #include "src/core/client_channel/retry_service_config.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_core {
 
+RetryThrottlerMetricsDomain::CounterHandle
+    RetryThrottlerMetricsDomain::kRetriesThrottled =
+        RetryThrottlerMetricsDomain::RegisterCounter(
+            "grpc.client.retry_throttler.retries_throttled",
+            "EXPERIMENTAL.  Number of retries denied by retry throttling or "
+            "because the retry budget was exhausted.",
+            "{retry}");
+
 namespace {
 
+constexpr absl::string_view kTokenBucketMode = "token_bucket";
+constexpr absl::string_view kBudgetMode = "budget";
+
 template <typename T>
 T ClampedAdd(std::atomic<T>& value, T delta, T min, T max) {
   T prev_value = value.load(std::memory_order_relaxed);
@@ -42,14 +59,91 @@ T ClampedAdd(std::atomic<T>& value, T delta, T min, T max) {
 
 }  // namespace
 
+//
+// RetryThrottler::Budget
+//
+
+RetryThrottler::Budget::Budget(const RetryGlobalConfig::RetryBudget& config)
+    : config_(config),
+      slot_millis_(std::max<int64_t>(1, config.ttl().millis() / kNumSlots)),
+      min_retries_per_window_(static_cast<uint32_t>(std::min<double>(
+          std::numeric_limits<uint32_t>::max(),
+          config.min_retries_per_second() * config.ttl().seconds()))) {}
+
+int64_t RetryThrottler::Budget::CurrentEpoch() const {
+  return Timestamp::Now().milliseconds_after_process_epoch() / slot_millis_;
+}
+
+RetryThrottler::Budget::Slot& RetryThrottler::Budget::GetSlot(int64_t epoch) {
+  Slot& slot = slots_[epoch % kNumSlots];
+  int64_t slot_epoch = slot.epoch.load(std::memory_order_acquire);
+  while (slot_epoch < epoch) {
+    // The slot holds counts from a previous lap of the window; recycle it.
+    if (slot.epoch.compare_exchange_weak(slot_epoch, epoch,
+                                         std::memory_order_acq_rel)) {
+      slot.successes.store(0, std::memory_order_relaxed);
+      slot.retries.store(0, std::memory_order_relaxed);
+      break;
+    }
+  }
+  return slot;
+}
+
+void RetryThrottler::Budget::RecordSuccess() {
+  GetSlot(CurrentEpoch()).successes.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t RetryThrottler::Budget::RetriesInWindow(int64_t epoch,
+                                                 uint64_t* allowed) const {
+  uint64_t successes = 0;
+  uint64_t retries = 0;
+  for (const Slot& slot : slots_) {
+    if (epoch - slot.epoch.load(std::memory_order_acquire) >=
+        static_cast<int64_t>(kNumSlots)) {
+      continue;
+    }
+    successes += slot.successes.load(std::memory_order_relaxed);
+    retries += slot.retries.load(std::memory_order_seq_cst);
+  }
+  *allowed = std::max<uint64_t>(
+      min_retries_per_window_,
+      static_cast<uint64_t>(std::floor(successes * config_.budget_percent() /
+                                       100.0)));
+  return retries;
+}
+
+bool RetryThrottler::Budget::CanRetry() const {
+  uint64_t allowed;
+  return RetriesInWindow(CurrentEpoch(), &allowed) < allowed;
+}
+
+bool RetryThrottler::Budget::TryRecordRetry() {
+  const int64_t epoch = CurrentEpoch();
+  Slot& slot = GetSlot(epoch);
+  // Reserve the retry before checking the budget, so that of several
+  // concurrent retries, each counts the others' reservations.
+  slot.retries.fetch_add(1, std::memory_order_seq_cst);
+  uint64_t allowed;
+  if (RetriesInWindow(epoch, &allowed) <= allowed) return true;
+  // Over budget: give the reservation back.  The slot may have been
+  // recycled in the meantime, so never go below zero.
+  uint32_t retries = slot.retries.load(std::memory_order_relaxed);
+  while (retries > 0 &&
+         !slot.retries.compare_exchange_weak(retries, retries - 1,
+                                             std::memory_order_relaxed)) {
+  }
+  return false;
+}
+
 //
 // RetryThrottler
 //
 
 RefCountedPtr<RetryThrottler> RetryThrottler::Create(
     uintptr_t max_milli_tokens, uintptr_t milli_token_ratio,
-    RefCountedPtr<RetryThrottler> previous) {
-  if (previous != nullptr && previous->max_milli_tokens_ == max_milli_tokens &&
+    RefCountedPtr<RetryThrottler> previous, MetricsStorage metrics_storage) {
+  if (previous != nullptr && previous->budget_ == nullptr &&
+      previous->max_milli_tokens_ == max_milli_tokens &&
       previous->milli_token_ratio_ == milli_token_ratio) {
     return previous;
   }
@@ -59,24 +153,51 @@ RefCountedPtr<RetryThrottler> RetryThrottler::Create(
   // the token count by scaling proportionately to the old data.  This
   // ensures that if we're already throttling retries on the old scale,
   // we will start out doing the same thing on the new one.
-  if (previous != nullptr) {
+  if (previous != nullptr && previous->budget_ == nullptr) {
     double token_fraction = static_cast<double>(previous->milli_tokens_) /
                             static_cast<double>(previous->max_milli_tokens_);
     initial_milli_tokens =
         static_cast<uintptr_t>(token_fraction * max_milli_tokens);
   }
   auto throttle_data = MakeRefCounted<RetryThrottler>(
-      max_milli_tokens, milli_token_ratio, initial_milli_tokens);
+      max_milli_tokens, milli_token_ratio, initial_milli_tokens,
+      std::move(metrics_storage));
+  if (previous != nullptr) previous->SetReplacement(throttle_data);
+  return throttle_data;
+}
+
+RefCountedPtr<RetryThrottler> RetryThrottler::Create(
+    const RetryGlobalConfig::RetryBudget& retry_budget,
+    RefCountedPtr<RetryThrottler> previous, MetricsStorage metrics_storage) {
+  if (previous != nullptr && previous->budget_ != nullptr &&
+      previous->budget_->config() == retry_budget) {
+    return previous;
+  }
+  // Unlike the token bucket, a new budget starts out empty: the window
+  // refills within one ttl, and the minimum rate applies meanwhile.
+  auto throttle_data =
+      MakeRefCounted<RetryThrottler>(retry_budget, std::move(metrics_storage));
   if (previous != nullptr) previous->SetReplacement(throttle_data);
   return throttle_data;
 }
 
 RetryThrottler::RetryThrottler(uintptr_t max_milli_tokens,
                                uintptr_t milli_token_ratio,
-                               uintptr_t milli_tokens)
+                               uintptr_t milli_tokens,
+                               MetricsStorage metrics_storage)
     : max_milli_tokens_(max_milli_tokens),
       milli_token_ratio_(milli_token_ratio),
-      milli_tokens_(milli_tokens) {}
+      milli_tokens_(milli_tokens),
+      metrics_storage_(std::move(metrics_storage)) {}
+
+RetryThrottler::RetryThrottler(
+    const RetryGlobalConfig::RetryBudget& retry_budget,
+    MetricsStorage metrics_storage)
+    : max_milli_tokens_(0),
+      milli_token_ratio_(0),
+      milli_tokens_(0),
+      budget_(std::make_unique<Budget>(retry_budget)),
+      metrics_storage_(std::move(metrics_storage)) {}
 
 RetryThrottler::~RetryThrottler() {
   RetryThrottler* replacement = replacement_.load(std::memory_order_acquire);
@@ -99,10 +220,22 @@ void RetryThrottler::GetReplacementThrottleDataIfNeeded(
   }
 }
 
+void RetryThrottler::RecordThrottled() {
+  if (metrics_storage_ != nullptr) {
+    metrics_storage_->Increment(RetryThrottlerMetricsDomain::kRetriesThrottled);
+  }
+}
+
 bool RetryThrottler::RecordFailure() {
   // First, check if we are stale and need to be replaced.
   RetryThrottler* throttle_data = this;
   GetReplacementThrottleDataIfNeeded(&throttle_data);
+  if (throttle_data->budget_ != nullptr) {
+    // The retry is charged in RecordRetry(), once it is actually sent.
+    if (throttle_data->budget_->CanRetry()) return true;
+    throttle_data->RecordThrottled();
+    return false;
+  }
   // We decrement milli_tokens by 1000 (1 token) for each failure.
   const uintptr_t new_value = ClampedAdd<intptr_t>(
       throttle_data->milli_tokens_, -1000, 0,
@@ -110,13 +243,32 @@ bool RetryThrottler::RecordFailure() {
                           std::numeric_limits<intptr_t>::max()));
   // Retries are allowed as long as the new value is above the threshold
   // (max_milli_tokens / 2).
-  return new_value > throttle_data->max_milli_tokens_ / 2;
+  if (new_value > throttle_data->max_milli_tokens_ / 2) return true;
+  throttle_data->RecordThrottled();
+  return false;
+}
+
+bool RetryThrottler::RecordRetry() {
+  // First, check if we are stale and need to be replaced.
+  RetryThrottler* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  // The token bucket already charged the failure in RecordFailure().
+  if (throttle_data->budget_ == nullptr) return true;
+  // Other calls may have used up the budget since RecordFailure() checked
+  // it, so check again as the retry is charged.
+  if (throttle_data->budget_->TryRecordRetry()) return true;
+  throttle_data->RecordThrottled();
+  return false;
 }
 
 void RetryThrottler::RecordSuccess() {
   // First, check if we are stale and need to be replaced.
   RetryThrottler* throttle_data = this;
   GetReplacementThrottleDataIfNeeded(&throttle_data);
+  if (throttle_data->budget_ != nullptr) {
+    throttle_data->budget_->RecordSuccess();
+    return;
+  }
   // We increment milli_tokens by milli_token_ratio for each success.
   ClampedAdd<intptr_t>(
       throttle_data->milli_tokens_, throttle_data->milli_token_ratio_, 0,
@@ -135,11 +287,27 @@ void RetryThrottlerChannelArgsUpdater::Update(
     throttler_.reset();  // No throttling config.
     return;
   }
+  const bool use_budget = config->retry_budget().has_value();
+  RetryThrottler::MetricsStorage metrics_storage;
+  auto* stats_plugin_group =
+      args.GetObject<GlobalStatsPluginRegistry::StatsPluginGroup>();
+  if (stats_plugin_group != nullptr) {
+    metrics_storage = RetryThrottlerMetricsDomain::GetStorage(
+        stats_plugin_group->GetCollectionScope(),
+        args.GetString(GRPC_ARG_SERVER_URI).value_or(""),
+        use_budget ? kBudgetMode : kTokenBucketMode);
+  }
   // Create a new throttler that replaces the current throttler and add
   // it to channel args.
-  throttler_ = RetryThrottler::Create(config->max_milli_tokens(),
-                                      config->milli_token_ratio(),
-                                      std::move(throttler_));
+  if (use_budget) {
+    throttler_ =
+        RetryThrottler::Create(*config->retry_budget(), std::move(throttler_),
+                               std::move(metrics_storage));
+  } else {
+    throttler_ = RetryThrottler::Create(
+        config->max_milli_tokens(), config->milli_token_ratio(),
+        std::move(throttler_), std::move(metrics_storage));
+  }
   args = args.SetObject(throttler_);
 }
 
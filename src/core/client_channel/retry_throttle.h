@@ -21,29 +21,66 @@
 
 #include <stdint.h>
 
+#include <array>
 #include <atomic>
+#include <memory>
 
+#include "src/core/client_channel/retry_service_config.h"
 #include "src/core/service_config/service_config.h"
+#include "src/core/telemetry/instrument.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
 
 namespace grpc_core {
 
+class RetryThrottlerMetricsDomain final
+    : public InstrumentDomain<RetryThrottlerMetricsDomain> {
+ public:
+  using Backend = LowContentionBackend;
+  static constexpr absl::string_view kName = "retry_throttler";
+  GRPC_INSTRUMENT_DOMAIN_LABELS("grpc.target", "grpc.retry.throttle_mode");
+
+  static CounterHandle kRetriesThrottled;
+};
+
 /// Tracks retry throttling data for a channel.
+///
+/// Operates in one of two modes: a token bucket (the retryThrottling
+/// service config field), or a retry budget that caps retries at a
+/// percentage of recent successful requests (the retryBudget field).
 class RetryThrottler final : public RefCounted<RetryThrottler> {
  public:
+  using MetricsStorage = InstrumentStorageRefPtr<RetryThrottlerMetricsDomain>;
+
   static RefCountedPtr<RetryThrottler> Create(
       uintptr_t max_milli_tokens, uintptr_t milli_token_ratio,
-      RefCountedPtr<RetryThrottler> previous);
+      RefCountedPtr<RetryThrottler> previous,
+      MetricsStorage metrics_storage = nullptr);
+  static RefCountedPtr<RetryThrottler> Create(
+      const RetryGlobalConfig::RetryBudget& retry_budget,
+      RefCountedPtr<RetryThrottler> previous,
+      MetricsStorage metrics_storage = nullptr);
 
   // Do not instantiate directly -- use Create() instead.
   RetryThrottler(uintptr_t max_milli_tokens, uintptr_t milli_token_ratio,
-                 uintptr_t milli_tokens);
+                 uintptr_t milli_tokens,
+                 MetricsStorage metrics_storage = nullptr);
+  RetryThrottler(const RetryGlobalConfig::RetryBudget& retry_budget,
+                 MetricsStorage metrics_storage);
   ~RetryThrottler() override;
 
   /// Records a failure.  Returns true if it's okay to send a retry.
+  /// In budget mode this only checks the budget; callers must call
+  /// RecordRetry() once they have decided to actually send the retry.
   bool RecordFailure();
 
+  /// Charges the budget for a retry that is about to be sent.  Returns
+  /// false, without charging it, if the budget was used up since
+  /// RecordFailure(), in which case the retry must not be sent.  Always
+  /// returns true for the token bucket.
+  bool RecordRetry();
+
   /// Records a success.
   void RecordSuccess();
 
@@ -63,13 +100,58 @@ class RetryThrottler final : public RefCounted<RetryThrottler> {
   }
 
  private:
+  // Counts successes and retries over a sliding window for the retry
+  // budget.  The window is split into fixed-size slots that are recycled
+  // as time advances.  Counts are updated without locks and may be slightly
+  // off when a slot is recycled concurrently, which is fine for a budget.
+  class Budget {
+   public:
+    explicit Budget(const RetryGlobalConfig::RetryBudget& config);
+
+    const RetryGlobalConfig::RetryBudget& config() const { return config_; }
+
+    void RecordSuccess();
+    // Returns true if the budget allows another retry.  Does not charge
+    // the budget; that is done by TryRecordRetry().
+    bool CanRetry() const;
+    // Charges the budget for a retry if it allows one, and returns whether
+    // it did.  Concurrent callers cannot overdraw the budget.
+    bool TryRecordRetry();
+
+   private:
+    static constexpr size_t kNumSlots = 10;
+
+    struct Slot {
+      std::atomic<int64_t> epoch{-1};
+      std::atomic<uint32_t> successes{0};
+      std::atomic<uint32_t> retries{0};
+    };
+
+    int64_t CurrentEpoch() const;
+    Slot& GetSlot(int64_t epoch);
+    // Returns the number of retries charged over the window ending at
+    // epoch, and sets *allowed to how many the budget allows.
+    uint64_t RetriesInWindow(int64_t epoch, uint64_t* allowed) const;
+
+    const RetryGlobalConfig::RetryBudget config_;
+    const int64_t slot_millis_;
+    // Retries always allowed within a window, regardless of traffic.
+    const uint32_t min_retries_per_window_;
+    std::array<Slot, kNumSlots> slots_;
+  };
+
   void SetReplacement(RefCountedPtr<RetryThrottler> replacement);
 
   void GetReplacementThrottleDataIfNeeded(RetryThrottler** throttle_data);
 
+  void RecordThrottled();
+
   const uintptr_t max_milli_tokens_;
   const uintptr_t milli_token_ratio_;
   std::atomic<intptr_t> milli_tokens_;
+  // Non-null in retry budget mode.
+  const std::unique_ptr<Budget> budget_;
+  const MetricsStorage metrics_storage_;
   // A pointer to the replacement for this RetryThrottler entry.
   // If non-nullptr, then this entry is stale and must not be used.
   // We hold a reference to the replacement.
@@ -492,6 +492,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     const char* crl_directory, bool send_client_ca_list,
     std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider,
     const std::vector<grpc_tls_key_exchange_group>& key_exchange_groups,
+    grpc_core::RefCountedPtr<tsi::SslSessionStore> session_store,
     tsi_ssl_server_handshaker_factory** handshaker_factory) {
   size_t num_alpn_protocols = 0;
   const char** alpn_protocol_strings =
@@ -511,6 +512,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
   options.send_client_ca_list = send_client_ca_list;
   options.root_cert_info = std::move(root_cert_info);
   options.key_exchange_groups = key_exchange_groups;
+  options.session_store = std::move(session_store);
   const tsi_result result =
       tsi_create_ssl_server_handshaker_factory_with_options(&options,
                                                             handshaker_factory);
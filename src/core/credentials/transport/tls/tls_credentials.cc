@@ -33,6 +33,7 @@
 #include "src/core/credentials/transport/tls/tls_security_connector.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_store.h"
 #include "src/core/util/useful.h"
 #include "absl/log/log.h"
 
@@ -139,9 +140,10 @@ TlsServerCredentials::~TlsServerCredentials() {}
 
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 TlsServerCredentials::create_security_connector(
-    const grpc_core::ChannelArgs& /* args */) {
+    const grpc_core::ChannelArgs& args) {
   return grpc_core::TlsServerSecurityConnector::
-      CreateTlsServerSecurityConnector(this->Ref(), options_);
+      CreateTlsServerSecurityConnector(
+          this->Ref(), options_, args.GetObjectRef<tsi::SslSessionStore>());
 }
 
 grpc_core::UniqueTypeName TlsServerCredentials::Type() {
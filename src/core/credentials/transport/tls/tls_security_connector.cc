@@ -588,7 +588,8 @@ TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
 RefCountedPtr<grpc_server_security_connector>
 TlsServerSecurityConnector::CreateTlsServerSecurityConnector(
     RefCountedPtr<grpc_server_credentials> server_creds,
-    RefCountedPtr<grpc_tls_credentials_options> options) {
+    RefCountedPtr<grpc_tls_credentials_options> options,
+    RefCountedPtr<tsi::SslSessionStore> session_store) {
   if (server_creds == nullptr) {
     LOG(ERROR) << "server_creds is nullptr in "
                   "TlsServerSecurityConnectorCreate()";
@@ -599,16 +600,18 @@ TlsServerSecurityConnector::CreateTlsServerSecurityConnector(
                   "TlsServerSecurityConnectorCreate()";
     return nullptr;
   }
-  return MakeRefCounted<TlsServerSecurityConnector>(std::move(server_creds),
-                                                    std::move(options));
+  return MakeRefCounted<TlsServerSecurityConnector>(
+      std::move(server_creds), std::move(options), std::move(session_store));
 }
 
 TlsServerSecurityConnector::TlsServerSecurityConnector(
     RefCountedPtr<grpc_server_credentials> server_creds,
-    RefCountedPtr<grpc_tls_credentials_options> options)
+    RefCountedPtr<grpc_tls_credentials_options> options,
+    RefCountedPtr<tsi::SslSessionStore> session_store)
     : grpc_server_security_connector(GRPC_SSL_URL_SCHEME,
                                      std::move(server_creds)),
-      options_(std::move(options)) {
+      options_(std::move(options)),
+      session_store_(std::move(session_store)) {
   const std::string& tls_session_key_log_file_path =
       options_->tls_session_key_log_file_path();
   if (!tls_session_key_log_file_path.empty()) {
@@ -856,7 +859,8 @@ TlsServerSecurityConnector::UpdateHandshakerFactoryLocked() {
       grpc_get_tsi_tls_version(options_->max_tls_version()),
       tls_session_key_logger_.get(), options_->crl_directory().c_str(),
       options_->send_client_ca_list(), options_->crl_provider(),
-      options_->key_exchange_groups(), &server_handshaker_factory_);
+      options_->key_exchange_groups(), session_store_,
+      &server_handshaker_factory_);
 }
 
 }  // namespace grpc_core
@@ -41,6 +41,7 @@
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_store.h"
 #include "src/core/tsi/ssl_transport_security.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/match.h"
@@ -193,11 +194,13 @@ class TlsServerSecurityConnector final : public grpc_server_security_connector {
   static RefCountedPtr<grpc_server_security_connector>
   CreateTlsServerSecurityConnector(
       RefCountedPtr<grpc_server_credentials> server_creds,
-      RefCountedPtr<grpc_tls_credentials_options> options);
+      RefCountedPtr<grpc_tls_credentials_options> options,
+      RefCountedPtr<tsi::SslSessionStore> session_store = nullptr);
 
   TlsServerSecurityConnector(
       RefCountedPtr<grpc_server_credentials> server_creds,
-      RefCountedPtr<grpc_tls_credentials_options> options);
+      RefCountedPtr<grpc_tls_credentials_options> options,
+      RefCountedPtr<tsi::SslSessionStore> session_store = nullptr);
   ~TlsServerSecurityConnector() override;
 
   void add_handshakers(const ChannelArgs& args,
@@ -301,6 +304,7 @@ class TlsServerSecurityConnector final : public grpc_server_security_connector {
       ABSL_GUARDED_BY(mu_);
   std::shared_ptr<tsi::RootCertInfo> root_cert_info_ ABSL_GUARDED_BY(mu_);
   RefCountedPtr<TlsSessionKeyLogger> tls_session_key_logger_;
+  const RefCountedPtr<tsi::SslSessionStore> session_store_;
   std::map<grpc_closure* /*on_peer_checked*/, ServerPendingVerifierRequest*>
       pending_verifier_requests_ ABSL_GUARDED_BY(verifier_request_map_mu_);
 };
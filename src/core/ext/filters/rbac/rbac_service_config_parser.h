@@ -70,6 +70,9 @@ class RbacServiceConfigParser : public ServiceConfigParser::Parser {
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_PARSE_RBAC_METHOD_CONFIG};
+  }
   // Returns the parser index for RbacServiceConfigParser.
   static size_t ParserIndex();
   // Registers RbacServiceConfigParser to ServiceConfigParser.
@@ -0,0 +1,171 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/handshaker/security/handshake_offload_pool.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "src/core/util/no_destruct.h"
+#include "absl/status/status.h"
+
+namespace grpc_core {
+
+HandshakeOffloadDomain::HistogramHandle<ExponentialHistogramShape>
+    HandshakeOffloadDomain::kQueueTime =
+        HandshakeOffloadDomain::RegisterHistogram<ExponentialHistogramShape>(
+            "grpc.handshake_offload.queue_time",
+            "EXPERIMENTAL.  Time handshake steps waited for the handshake "
+            "offload pool, in microseconds.",
+            "{us}", 1 << 24, 100);  // Max bucket is 16 seconds.
+
+HandshakeOffloadDomain::UpDownCounterHandle
+    HandshakeOffloadDomain::kActiveHandshakes =
+        HandshakeOffloadDomain::RegisterUpDownCounter(
+            "grpc.handshake_offload.active_handshakes",
+            "EXPERIMENTAL.  Number of handshake steps currently running on the "
+            "handshake offload pool.",
+            "{handshake}");
+
+HandshakeOffloadDomain::CounterHandle
+    HandshakeOffloadDomain::kRejectedHandshakes =
+        HandshakeOffloadDomain::RegisterCounter(
+            "grpc.handshake_offload.rejected_handshakes",
+            "EXPERIMENTAL.  Number of handshakes failed because the handshake "
+            "offload pool was overloaded.",
+            "{handshake}");
+
+namespace {
+
+constexpr int kDefaultMaxQueuedHandshakes = 1024;
+constexpr Duration kDefaultMaxQueueTime = Duration::Seconds(5);
+
+// Pools by options. Entries are removed by the pool's destructor.
+struct PoolRegistry {
+  Mutex mu;
+  std::map<HandshakeOffloadPool::Options, HandshakeOffloadPool*> pools
+      ABSL_GUARDED_BY(mu);
+};
+
+NoDestruct<PoolRegistry> g_registry;
+
+}  // namespace
+
+RefCountedPtr<HandshakeOffloadPool> HandshakeOffloadPool::Get(
+    const ChannelArgs& args) {
+  const int max_concurrent =
+      args.GetInt(GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_CONCURRENT).value_or(0);
+  if (max_concurrent <= 0) return nullptr;
+  Options options;
+  options.max_concurrent_handshakes = max_concurrent;
+  options.max_queued_handshakes = std::max(
+      0, args.GetInt(GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_QUEUED)
+             .value_or(kDefaultMaxQueuedHandshakes));
+  options.max_queue_time = std::max(
+      Duration::Zero(),
+      args.GetDurationFromIntMillis(
+              GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_QUEUE_TIME_MS)
+          .value_or(kDefaultMaxQueueTime));
+  MutexLock lock(&g_registry->mu);
+  HandshakeOffloadPool*& pool = g_registry->pools[options];
+  if (pool != nullptr) {
+    auto ref = pool->RefIfNonZero();
+    if (ref != nullptr) return ref;
+  }
+  auto ref = MakeRefCounted<HandshakeOffloadPool>(options);
+  pool = ref.get();
+  return ref;
+}
+
+HandshakeOffloadPool::HandshakeOffloadPool(Options options)
+    : options_(options),
+      thread_pool_(grpc_event_engine::experimental::MakeThreadPool(
+          options.max_concurrent_handshakes)) {}
+
+HandshakeOffloadPool::~HandshakeOffloadPool() {
+  {
+    MutexLock lock(&g_registry->mu);
+    auto it = g_registry->pools.find(options_);
+    if (it != g_registry->pools.end() && it->second == this) {
+      g_registry->pools.erase(it);
+    }
+  }
+  thread_pool_->Quiesce();
+}
+
+void HandshakeOffloadPool::Run(Step step) {
+  {
+    MutexLock lock(&mu_);
+    if (active_ < options_.max_concurrent_handshakes) {
+      ++active_;
+    } else if (queue_.size() < options_.max_queued_handshakes) {
+      queue_.push_back({std::move(step), gpr_get_cycle_counter()});
+      return;
+    } else {
+      thread_pool_->Run([step = std::move(step)]() mutable {
+        step(absl::ResourceExhaustedError(
+            "handshake offload queue is full"));
+      });
+      return;
+    }
+  }
+  thread_pool_->Run([self = Ref(), step = std::move(step)]() mutable {
+    self->RunInSlot(std::move(step), 0);
+  });
+}
+
+void HandshakeOffloadPool::RunInSlot(Step step, int64_t queue_time_us) {
+  const int64_t max_queue_time_us =
+      options_.max_queue_time.millis() * GPR_US_PER_MS;
+  while (step != nullptr) {
+    step(queue_time_us);
+    step = nullptr;
+    std::vector<Step> expired;
+    {
+      MutexLock lock(&mu_);
+      const gpr_cycle_counter now = gpr_get_cycle_counter();
+      while (!queue_.empty()) {
+        QueuedStep queued = std::move(queue_.front());
+        queue_.pop_front();
+        gpr_timespec queue_time =
+            gpr_cycle_counter_sub(now, queued.enqueue_cycles);
+        queue_time_us = queue_time.tv_sec * GPR_US_PER_SEC +
+                        queue_time.tv_nsec / GPR_NS_PER_US;
+        // Steps behind this one were queued later, so the first one that is
+        // still in time ends the scan.
+        if (queue_time_us <= max_queue_time_us) {
+          step = std::move(queued.step);
+          break;
+        }
+        expired.push_back(std::move(queued.step));
+      }
+      if (step == nullptr) --active_;
+    }
+    for (Step& expired_step : expired) {
+      expired_step(absl::DeadlineExceededError(
+          "handshake waited too long for the handshake offload pool"));
+    }
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,115 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_HANDSHAKER_SECURITY_HANDSHAKE_OFFLOAD_POOL_H
+#define GRPC_SRC_CORE_HANDSHAKER_SECURITY_HANDSHAKE_OFFLOAD_POOL_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <memory>
+#include <tuple>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/time_precise.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+class HandshakeOffloadDomain final
+    : public InstrumentDomain<HandshakeOffloadDomain> {
+ public:
+  using Backend = LowContentionBackend;
+  static constexpr absl::string_view kName = "handshake_offload";
+  GRPC_EMPTY_INSTRUMENT_DOMAIN_LABELS();
+
+  static HistogramHandle<ExponentialHistogramShape> kQueueTime;
+  static UpDownCounterHandle kActiveHandshakes;
+  static CounterHandle kRejectedHandshakes;
+};
+
+// Runs the CPU heavy steps of security handshakes on a dedicated, bounded set
+// of threads, so that a reconnect storm cannot starve the EventEngine threads
+// serving established connections.
+//
+// At most max_concurrent_handshakes steps run at once; the rest wait in a
+// FIFO queue. Steps are rejected when the queue is full or once they have
+// waited longer than max_queue_time, failing the handshake early rather than
+// completing it after the peer has likely given up.
+class HandshakeOffloadPool final : public RefCounted<HandshakeOffloadPool> {
+ public:
+  struct Options {
+    size_t max_concurrent_handshakes = 0;
+    size_t max_queued_handshakes = 0;
+    Duration max_queue_time;
+
+    bool operator<(const Options& other) const {
+      return std::tie(max_concurrent_handshakes, max_queued_handshakes,
+                      max_queue_time) <
+             std::tie(other.max_concurrent_handshakes,
+                      other.max_queued_handshakes, other.max_queue_time);
+    }
+  };
+
+  // Called on a pool thread with the time in microseconds the step waited in
+  // the queue, or with the reason it was rejected.
+  using Step =
+      absl::AnyInvocable<void(absl::StatusOr<int64_t> queue_time_us)>;
+
+  // Returns the pool configured by GRPC_ARG_HANDSHAKE_OFFLOAD_* in args,
+  // shared by every channel and server using the same settings, or null if
+  // offload is disabled.
+  static RefCountedPtr<HandshakeOffloadPool> Get(const ChannelArgs& args);
+
+  explicit HandshakeOffloadPool(Options options);
+  ~HandshakeOffloadPool() override;
+
+  void Run(Step step);
+
+ private:
+  struct QueuedStep {
+    Step step;
+    // Timestamp::Now() is cached per ExecCtx and only has millisecond
+    // resolution, too coarse for queue times.
+    gpr_cycle_counter enqueue_cycles;
+  };
+
+  // Runs step and then any steps queued behind it, in the same slot.
+  void RunInSlot(Step step, int64_t queue_time_us);
+
+  const Options options_;
+  std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
+  Mutex mu_;
+  size_t active_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<QueuedStep> queue_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_HANDSHAKER_SECURITY_HANDSHAKE_OFFLOAD_POOL_H
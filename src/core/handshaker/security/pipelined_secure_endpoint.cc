@@ -18,6 +18,7 @@
 
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/event_engine/memory_request.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
@@ -27,6 +28,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -34,10 +36,14 @@
 #include <utility>
 #include <vector>
 
+#include "src/core/channelz/channelz.h"
+#include "src/core/channelz/property_list.h"
 #include "src/core/handshaker/security/pipelining_heuristic_selector.h"
 #include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/extensions/channelz.h"
+#include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
@@ -47,6 +53,8 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/grpc_check.h"
@@ -68,6 +76,38 @@
 
 namespace grpc_core {
 namespace {
+
+class SecureEndpointDomain final
+    : public InstrumentDomain<SecureEndpointDomain> {
+ public:
+  using Backend = HighContentionBackend;
+  static constexpr absl::string_view kName = "secure_endpoint";
+  GRPC_EMPTY_INSTRUMENT_DOMAIN_LABELS();
+
+  static CounterHandle kPipelinedReads;
+  static CounterHandle kInlineReads;
+  static HistogramHandle<ExponentialHistogramShape> kThreadHopLatency;
+};
+
+SecureEndpointDomain::CounterHandle SecureEndpointDomain::kPipelinedReads =
+    SecureEndpointDomain::RegisterCounter(
+        "grpc.secure_endpoint.pipelined_reads",
+        "EXPERIMENTAL.  Number of reads unprotected while the next read was "
+        "started on another thread.",
+        "{read}");
+SecureEndpointDomain::CounterHandle SecureEndpointDomain::kInlineReads =
+    SecureEndpointDomain::RegisterCounter(
+        "grpc.secure_endpoint.inline_reads",
+        "EXPERIMENTAL.  Number of reads unprotected before the next read was "
+        "started.",
+        "{read}");
+SecureEndpointDomain::HistogramHandle<ExponentialHistogramShape>
+    SecureEndpointDomain::kThreadHopLatency =
+        SecureEndpointDomain::RegisterHistogram<ExponentialHistogramShape>(
+            "grpc.secure_endpoint.thread_hop_latency",
+            "EXPERIMENTAL.  Time between scheduling a pipelined read and it "
+            "starting on another thread, in microseconds.",
+            "{us}", 1 << 20, 100);  // Max bucket is 1 second.
 class FrameProtector : public RefCounted<FrameProtector> {
  public:
   FrameProtector(tsi_frame_protector* protector,
@@ -76,6 +116,9 @@ class FrameProtector : public RefCounted<FrameProtector> {
                  const ChannelArgs& args)
       : protector_(protector),
         zero_copy_protector_(zero_copy_protector),
+        kernel_protected_writes_(
+            args.GetBool(GRPC_ARG_SECURE_ENDPOINT_KERNEL_PROTECTED_WRITES)
+                .value_or(false)),
         memory_owner_(args.GetObject<ResourceQuota>()
                           ->memory_quota()
                           ->CreateMemoryOwner()),
@@ -324,6 +367,13 @@ class FrameProtector : public RefCounted<FrameProtector> {
   tsi_result Protect(grpc_slice_buffer* slices, int max_frame_size)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(write_mu_) {
     if (shutdown_) return TSI_FAILED_PRECONDITION;
+    if (kernel_protected_writes_) {
+      // The kernel encrypts whatever reaches the socket.
+      output_buffer_.Clear();
+      TraceOp("Protect", slices);
+      grpc_slice_buffer_move_into(slices, output_buffer_.c_slice_buffer());
+      return TSI_OK;
+    }
 
     GRPC_LATENT_SEE_SCOPE("protect");
     uint8_t* cur = GRPC_SLICE_START_PTR(write_staging_buffer_);
@@ -435,6 +485,7 @@ class FrameProtector : public RefCounted<FrameProtector> {
  private:
   struct tsi_frame_protector* const protector_;
   struct tsi_zero_copy_grpc_protector* const zero_copy_protector_;
+  const bool kernel_protected_writes_;
   Mutex mu_;
   Mutex write_mu_;
   // The read mutex must be acquired after the write mutex for shutdown
@@ -463,7 +514,8 @@ class FrameProtector : public RefCounted<FrameProtector> {
 namespace grpc_event_engine::experimental {
 namespace {
 
-class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
+class PipelinedSecureEndpoint final : public EventEngine::Endpoint,
+                                      public ChannelzExtension {
  public:
   PipelinedSecureEndpoint(
       std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
@@ -476,7 +528,10 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
             std::move(wrapped_ep), protector, zero_copy_protector,
             leftover_slices, leftover_nslices, channel_args)) {}
 
-  ~PipelinedSecureEndpoint() override { impl_->Shutdown(); }
+  ~PipelinedSecureEndpoint() override {
+    ShutdownChannelzExtension();
+    impl_->Shutdown();
+  }
 
   bool Read(absl::AnyInvocable<void(absl::Status)> on_read, SliceBuffer* buffer,
             ReadArgs in_args) override {
@@ -497,6 +552,10 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
   }
 
   void* QueryExtension(absl::string_view id) override {
+    // Channelz data is reported here, on top of the wrapped endpoint's.
+    if (id == ChannelzExtension::EndpointExtensionName()) {
+      return static_cast<ChannelzExtension*>(this);
+    }
     return impl_->QueryExtension(id);
   }
 
@@ -504,6 +563,10 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
     return std::make_shared<Impl::TelemetryInfo>(impl_->GetTelemetryInfo());
   }
 
+  void AddData(grpc_core::channelz::DataSink& sink) override {
+    impl_->AddData(sink);
+  }
+
  private:
   class Impl : public grpc_core::RefCounted<Impl> {
    public:
@@ -568,6 +631,24 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
       if (event_engine_ == nullptr) {
         event_engine_ = GetDefaultEventEngine();
       }
+      auto heuristic =
+          channel_args.GetString(GRPC_ARG_SECURE_ENDPOINT_PIPELINING_HEURISTIC);
+      if (heuristic.has_value()) {
+        auto type = grpc_core::PipeliningHeuristicSelector::ParseHeuristicType(
+            *heuristic);
+        if (type.has_value()) {
+          heuristic_selector_.SetHeuristicType(*type);
+        } else {
+          LOG(ERROR) << "Unknown secure endpoint pipelining heuristic: "
+                     << *heuristic;
+        }
+      }
+      auto* stats_plugin_group = channel_args.GetObject<
+          grpc_core::GlobalStatsPluginRegistry::StatsPluginGroup>();
+      if (stats_plugin_group != nullptr) {
+        metrics_ = grpc_core::SecureEndpointDomain::GetStorage(
+            stats_plugin_group->GetCollectionScope());
+      }
       // Kick off the first endpoint read ahead of the first transport read.
       StartFirstRead();
     }
@@ -689,6 +770,32 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
           wrapped_ep_->GetTelemetryInfo());
     }
 
+    void AddData(grpc_core::channelz::DataSink& sink) {
+      {
+        grpc_core::MutexLock lock(&shutdown_read_mu_);
+        auto* wrapped_channelz =
+            grpc_event_engine::experimental::QueryExtension<ChannelzExtension>(
+                wrapped_ep_.get());
+        if (wrapped_channelz != nullptr) wrapped_channelz->AddData(sink);
+      }
+      grpc_core::MutexLock lock(&read_queue_mu_);
+      grpc_core::channelz::PropertyList properties;
+      properties
+          .Set("heuristic",
+               grpc_core::PipeliningHeuristicSelector::HeuristicTypeName(
+                   heuristic_selector_.type()))
+          .Set("pipelining_enabled", heuristic_selector_.IsPipeliningEnabled())
+          .Set("pipelined_reads", pipelined_reads_)
+          .Set("inline_reads", inline_reads_);
+      const auto* cost_model = heuristic_selector_.cost_model();
+      if (cost_model != nullptr) {
+        properties
+            .Set("unprotect_ns_per_byte", cost_model->unprotect_ns_per_byte())
+            .Set("thread_hop_ns", cost_model->thread_hop_ns());
+      }
+      sink.AddData("secure_endpoint_pipelining", std::move(properties));
+    }
+
    private:
     // Called from the constructor to kick off the first read on the wrapped
     // endpoint.
@@ -855,6 +962,8 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
       absl::AnyInvocable<void(absl::Status)> on_read;
       bool enable_pipelining = false;
       bool exit_loop = false;
+      size_t protected_bytes = 0;
+      std::chrono::nanoseconds unprotect_cost{0};
 
       /*
       Data passes through the buffers as follows:
@@ -908,17 +1017,33 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
             args.set_read_hint_bytes(1);
           }
 
-          impl->heuristic_selector_.RecordRead(source_buffer->Length());
+          protected_bytes = source_buffer->Length();
+          impl->heuristic_selector_.RecordRead(protected_bytes);
           enable_pipelining = impl->heuristic_selector_.IsPipeliningEnabled();
+          if (enable_pipelining) {
+            ++impl->pipelined_reads_;
+          } else {
+            ++impl->inline_reads_;
+          }
+        }
+        if (impl->metrics_ != nullptr) {
+          using grpc_core::SecureEndpointDomain;
+          impl->metrics_->Increment(enable_pipelining
+                                        ? SecureEndpointDomain::kPipelinedReads
+                                        : SecureEndpointDomain::kInlineReads);
         }
 
         // If pipelining is enabled, kick off the next read in another thread
         // while we unprotect in this thread.
         if (enable_pipelining) {
-          impl->event_engine_->Run([impl = impl->Ref(), args = args]() mutable {
-            grpc_core::ExecCtx exec_ctx;
-            StartPipelinedRead(std::move(impl), args);
-          });
+          impl->event_engine_->Run(
+              [impl = impl->Ref(), args = args,
+               scheduled = std::chrono::steady_clock::now()]() mutable {
+                grpc_core::ExecCtx exec_ctx;
+                impl->RecordThreadHop(std::chrono::steady_clock::now() -
+                                      scheduled);
+                StartPipelinedRead(std::move(impl), args);
+              });
         }
 
         {
@@ -928,7 +1053,9 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
           impl->frame_protector_.SetSourceBuffer(std::move(source_buffer));
           read_buffer = std::make_unique<SliceBuffer>();
           impl->frame_protector_.BeginRead(read_buffer->c_slice_buffer());
+          const auto unprotect_start = std::chrono::steady_clock::now();
           unprotect_status = impl->frame_protector_.Unprotect(absl::OkStatus());
+          unprotect_cost = std::chrono::steady_clock::now() - unprotect_start;
           impl->frame_protector_.FinishRead(unprotect_status.ok());
           if (!unprotect_status.ok()) {
             lock.Release();
@@ -938,6 +1065,8 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
         }
 
         impl->read_queue_mu_.Lock();
+        impl->heuristic_selector_.RecordUnprotect(protected_bytes,
+                                                  unprotect_cost);
         impl->unprotected_data_buffer_ = std::move(read_buffer);
         if (impl->on_read_ != nullptr) {
           // We have a transport read waiting on this unprotected data - either
@@ -1022,6 +1151,20 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
       }
     }
 
+    void RecordThreadHop(std::chrono::nanoseconds latency)
+        ABSL_LOCKS_EXCLUDED(read_queue_mu_) {
+      {
+        grpc_core::MutexLock lock(&read_queue_mu_);
+        heuristic_selector_.RecordThreadHop(latency);
+      }
+      if (metrics_ != nullptr) {
+        metrics_->Increment(
+            grpc_core::SecureEndpointDomain::kThreadHopLatency,
+            std::chrono::duration_cast<std::chrono::microseconds>(latency)
+                .count());
+      }
+    }
+
     static void FinishPipelinedRead(grpc_core::RefCountedPtr<Impl> impl,
                                     absl::Status status)
         ABSL_LOCKS_EXCLUDED(impl->read_queue_mu_) {
@@ -1087,6 +1230,11 @@ class PipelinedSecureEndpoint final : public EventEngine::Endpoint {
     bool waiting_for_transport_read_ ABSL_GUARDED_BY(read_queue_mu_) = false;
     grpc_core::PipeliningHeuristicSelector heuristic_selector_
         ABSL_GUARDED_BY(read_queue_mu_);
+    // Pipelining decisions, reported to channelz.
+    uint64_t pipelined_reads_ ABSL_GUARDED_BY(read_queue_mu_) = 0;
+    uint64_t inline_reads_ ABSL_GUARDED_BY(read_queue_mu_) = 0;
+    grpc_core::InstrumentStorageRefPtr<grpc_core::SecureEndpointDomain>
+        metrics_;
   };
 
   grpc_core::RefCountedPtr<Impl> impl_;
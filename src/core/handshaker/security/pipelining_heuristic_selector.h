@@ -20,8 +20,13 @@
 #define GRPC_SRC_CORE_HANDSHAKER_SECURITY_PIPELINING_HEURISTIC_SELECTOR_H
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <utility>
+
+#include "absl/strings/string_view.h"
 
 namespace grpc_core {
 
@@ -29,6 +34,11 @@ class PipeliningHeuristic {
  public:
   virtual ~PipeliningHeuristic() = default;
   virtual void RecordRead(size_t read_size) = 0;
+  // Reports that unprotecting read_size bytes took cost.
+  virtual void RecordUnprotect(size_t /*read_size*/,
+                               std::chrono::nanoseconds /*cost*/) {}
+  // Reports how long a pipelined read waited to start on another thread.
+  virtual void RecordThreadHop(std::chrono::nanoseconds /*latency*/) {}
   virtual bool IsPipeliningEnabled() const = 0;
 };
 
@@ -104,6 +114,80 @@ class MovingAverageHeuristic : public PipeliningHeuristic {
   double moving_average_ = 0.0;
 };
 
+// Cost model heuristic. Pipelining overlaps unprotecting one read with the
+// next endpoint read, at the price of hopping to another thread. Both sides
+// are measured on the connection itself, since they depend on the cipher,
+// the CPU and the read sizes: pipelining is enabled only while the
+// unprotect time of an average read exceeds the thread hop latency.
+class CostModelHeuristic : public PipeliningHeuristic {
+ public:
+  void RecordRead(size_t source_buffer_length) override {
+    average_read_size_ =
+        average_read_size_ == 0.0
+            ? source_buffer_length
+            : average_read_size_ * (1 - kSmoothing) +
+                  source_buffer_length * kSmoothing;
+    exploring_ = false;
+    // Nothing to overlap before the first unprotect has been measured.
+    if (unprotect_ns_per_byte_ == 0.0) return;
+    const double overlap_gain_ns = average_read_size_ * unprotect_ns_per_byte_;
+    if (enable_pipelining_) {
+      enable_pipelining_ = overlap_gain_ns >= thread_hop_ns_;
+    } else {
+      enable_pipelining_ = overlap_gain_ns > thread_hop_ns_ * kEnableMargin;
+    }
+    // The hop latency is only observed while pipelining, so pipeline the
+    // odd read anyway to keep it from going stale.
+    if (enable_pipelining_ || ++reads_since_thread_hop_ < kThreadHopProbe) {
+      return;
+    }
+    exploring_ = true;
+    reads_since_thread_hop_ = 0;
+  }
+
+  void RecordUnprotect(size_t read_size,
+                       std::chrono::nanoseconds cost) override {
+    if (read_size == 0) return;
+    const double sample = static_cast<double>(cost.count()) / read_size;
+    unprotect_ns_per_byte_ =
+        unprotect_ns_per_byte_ == 0.0
+            ? sample
+            : unprotect_ns_per_byte_ * (1 - kSmoothing) + sample * kSmoothing;
+  }
+
+  void RecordThreadHop(std::chrono::nanoseconds latency) override {
+    thread_hop_ns_ =
+        thread_hop_ns_ * (1 - kSmoothing) + latency.count() * kSmoothing;
+    reads_since_thread_hop_ = 0;
+  }
+
+  bool IsPipeliningEnabled() const override {
+    return enable_pipelining_ || exploring_;
+  }
+
+  double unprotect_ns_per_byte() const { return unprotect_ns_per_byte_; }
+  double thread_hop_ns() const { return thread_hop_ns_; }
+
+ private:
+  // Weight of each new sample in the moving averages.
+  static constexpr double kSmoothing = 0.05;
+  // Expected gain must exceed the hop latency by this factor to enable
+  // pipelining, which is disabled again once it no longer covers the hop.
+  static constexpr double kEnableMargin = 2.0;
+  // Number of consecutive non-pipelined reads after which one read is
+  // pipelined to measure the thread hop latency again.
+  static constexpr size_t kThreadHopProbe = 1024;
+  // Thread hop latency assumed until it has been measured.
+  static constexpr double kInitialThreadHopNs = 20000;
+  // We disable pipelining initially.
+  bool enable_pipelining_ = false;
+  bool exploring_ = false;
+  size_t reads_since_thread_hop_ = 0;
+  double average_read_size_ = 0.0;
+  double unprotect_ns_per_byte_ = 0.0;
+  double thread_hop_ns_ = kInitialThreadHopNs;
+};
+
 class PipeliningHeuristicSelector {
  public:
   enum class HeuristicType {
@@ -111,8 +195,37 @@ class PipeliningHeuristicSelector {
     kMovingAverage,
     kAlwaysOff,
     kAlwaysOn,
+    kCostModel,
   };
 
+  // Parses the value of GRPC_ARG_SECURE_ENDPOINT_PIPELINING_HEURISTIC.
+  static std::optional<HeuristicType> ParseHeuristicType(
+      absl::string_view name) {
+    for (HeuristicType type :
+         {HeuristicType::kConsecutiveSmallReads, HeuristicType::kMovingAverage,
+          HeuristicType::kAlwaysOff, HeuristicType::kAlwaysOn,
+          HeuristicType::kCostModel}) {
+      if (name == HeuristicTypeName(type)) return type;
+    }
+    return std::nullopt;
+  }
+
+  static absl::string_view HeuristicTypeName(HeuristicType type) {
+    switch (type) {
+      case HeuristicType::kConsecutiveSmallReads:
+        return "consecutive_small_reads";
+      case HeuristicType::kMovingAverage:
+        return "moving_average";
+      case HeuristicType::kAlwaysOff:
+        return "always_off";
+      case HeuristicType::kAlwaysOn:
+        return "always_on";
+      case HeuristicType::kCostModel:
+        return "cost_model";
+    }
+    return "unknown";
+  }
+
   // Default to kMovingAverage.
   explicit PipeliningHeuristicSelector(
       HeuristicType type = HeuristicType::kMovingAverage) {
@@ -120,6 +233,8 @@ class PipeliningHeuristicSelector {
   }
 
   void SetHeuristicType(HeuristicType type) {
+    type_ = type;
+    cost_model_ = nullptr;
     switch (type) {
       case HeuristicType::kConsecutiveSmallReads:
         heuristic_ = std::make_unique<ConsecutiveSmallReadsHeuristic>();
@@ -133,6 +248,12 @@ class PipeliningHeuristicSelector {
       case HeuristicType::kAlwaysOn:
         heuristic_ = std::make_unique<AlwaysOnHeuristic>();
         break;
+      case HeuristicType::kCostModel: {
+        auto cost_model = std::make_unique<CostModelHeuristic>();
+        cost_model_ = cost_model.get();
+        heuristic_ = std::move(cost_model);
+        break;
+      }
     }
   }
 
@@ -140,10 +261,24 @@ class PipeliningHeuristicSelector {
     heuristic_->RecordRead(source_buffer_length);
   }
 
+  void RecordUnprotect(size_t read_size, std::chrono::nanoseconds cost) {
+    heuristic_->RecordUnprotect(read_size, cost);
+  }
+
+  void RecordThreadHop(std::chrono::nanoseconds latency) {
+    heuristic_->RecordThreadHop(latency);
+  }
+
   bool IsPipeliningEnabled() const { return heuristic_->IsPipeliningEnabled(); }
 
+  HeuristicType type() const { return type_; }
+  // Null unless the heuristic type is kCostModel.
+  const CostModelHeuristic* cost_model() const { return cost_model_; }
+
  private:
+  HeuristicType type_;
   std::unique_ptr<PipeliningHeuristic> heuristic_;
+  const CostModelHeuristic* cost_model_ = nullptr;
 };
 
 }  // namespace grpc_core
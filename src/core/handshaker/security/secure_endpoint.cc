@@ -24,6 +24,7 @@
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/sync.h>
 #include <inttypes.h>
@@ -41,6 +42,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/extensions/receive_coalescing_extension.h"
 #include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -57,17 +59,21 @@
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/grpc_check.h"
+#include "src/core/util/no_destruct.h"
 #include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/string.h"
 #include "src/core/util/sync.h"
 #include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 
 #define STAGING_BUFFER_SIZE 8192
+#define DEFAULT_PARALLEL_ENCRYPTION_THRESHOLD (1024 * 1024)
+#define MAX_PARALLEL_ENCRYPTION_THREADS 8
 
 static void on_read(void* user_data, grpc_error_handle error);
 static void on_write(void* user_data, grpc_error_handle error);
@@ -80,6 +86,56 @@ grpc_slice AllocSlice(size_t size, void* user_data) {
   return owner->MakeSlice(MemoryRequest(size));
 }
 
+// Threads that seal the frames of large writes, shared by every secure
+// endpoint. Sealing runs here rather than on the EventEngine, which the
+// writing thread (often an EventEngine thread itself) blocks while holding
+// the write lock: work posted to a busy EventEngine could be queued behind
+// the very callbacks that need that thread.
+grpc_event_engine::experimental::ThreadPool* SealThreadPool() {
+  static NoDestruct<
+      std::shared_ptr<grpc_event_engine::experimental::ThreadPool>>
+      pool(grpc_event_engine::experimental::MakeThreadPool(
+          MAX_PARALLEL_ENCRYPTION_THREADS - 1));
+  return pool->get();
+}
+
+// Calls seal(i) for every i in [0, n) across the calling thread and the seal
+// thread pool. The calling thread claims work too, and only waits for frames
+// already being sealed by pool threads, which never wait on anything else.
+void SealInParallel(size_t n, absl::FunctionRef<void(size_t)> seal) {
+  struct State {
+    State(size_t n, absl::FunctionRef<void(size_t)> seal) : n(n), seal(seal) {}
+    const size_t n;
+    // Only called for claimed indices, i.e. while SealInParallel waits.
+    const absl::FunctionRef<void(size_t)> seal;
+    std::atomic<size_t> next{0};
+    Mutex mu;
+    CondVar cv;
+    size_t done ABSL_GUARDED_BY(mu) = 0;
+  };
+  auto state = std::make_shared<State>(n, seal);
+  auto work = [](State& state) {
+    size_t sealed = 0;
+    for (size_t i = state.next.fetch_add(1, std::memory_order_relaxed);
+         i < state.n;
+         i = state.next.fetch_add(1, std::memory_order_relaxed)) {
+      state.seal(i);
+      ++sealed;
+    }
+    if (sealed == 0) return;
+    MutexLock lock(&state.mu);
+    state.done += sealed;
+    if (state.done == state.n) state.cv.SignalAll();
+  };
+  grpc_event_engine::experimental::ThreadPool* pool = SealThreadPool();
+  for (size_t i = 1; i < n; ++i) {
+    pool->Run([state, work]() { work(*state); });
+  }
+  work(*state);
+  MutexLock lock(&state->mu);
+  while (state->done < n) state->cv.Wait(&state->mu);
+}
+
 class FrameProtector : public RefCounted<FrameProtector> {
  public:
   FrameProtector(tsi_frame_protector* protector,
@@ -88,6 +144,9 @@ class FrameProtector : public RefCounted<FrameProtector> {
                  const ChannelArgs& args)
       : protector_(protector),
         zero_copy_protector_(zero_copy_protector),
+        kernel_protected_writes_(
+            args.GetBool(GRPC_ARG_SECURE_ENDPOINT_KERNEL_PROTECTED_WRITES)
+                .value_or(false)),
         memory_owner_(args.GetObject<ResourceQuota>()
                           ->memory_quota()
                           ->CreateMemoryOwner()),
@@ -112,6 +171,14 @@ class FrameProtector : public RefCounted<FrameProtector> {
     if (zero_copy_protector_ != nullptr) {
       tsi_zero_copy_grpc_protector_set_allocator(zero_copy_protector_,
                                                  &AllocSlice, &memory_owner_);
+      const int parallel_threshold =
+          args.GetInt(GRPC_ARG_PARALLEL_ENCRYPTION_THRESHOLD)
+              .value_or(DEFAULT_PARALLEL_ENCRYPTION_THRESHOLD);
+      if (parallel_threshold > 0) {
+        parallel_threshold_ = static_cast<size_t>(parallel_threshold);
+        max_parallelism_ = std::min<size_t>(gpr_cpu_num_cores(),
+                                            MAX_PARALLEL_ENCRYPTION_THREADS);
+      }
       read_staging_buffer_ = grpc_empty_slice();
       write_staging_buffer_ = grpc_empty_slice();
     } else if (IsSecureEndpointReadCoalescingEnabled()) {
@@ -447,6 +514,8 @@ class FrameProtector : public RefCounted<FrameProtector> {
 
   int min_progress_size() const { return min_progress_size_; }
 
+  bool kernel_protected_writes() const { return kernel_protected_writes_; }
+
   void FlushWriteStagingBuffer(uint8_t** cur, uint8_t** end)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(write_mu_) {
     output_buffer_.AppendIndexed(
@@ -461,6 +530,13 @@ class FrameProtector : public RefCounted<FrameProtector> {
   tsi_result Protect(grpc_slice_buffer* slices, int max_frame_size)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(write_mu_) {
     if (shutdown_) return TSI_FAILED_PRECONDITION;
+    if (kernel_protected_writes_) {
+      // The kernel encrypts whatever reaches the socket.
+      output_buffer_.Clear();
+      TraceOp("Protect", slices);
+      grpc_slice_buffer_move_into(slices, output_buffer_.c_slice_buffer());
+      return TSI_OK;
+    }
 
     GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("protect");
     GRPC_TRACE_LOG(secure_endpoint, INFO) << "Starting protect for " << this;
@@ -483,13 +559,10 @@ class FrameProtector : public RefCounted<FrameProtector> {
         grpc_slice_buffer_move_first(
             slices, static_cast<size_t>(max_frame_size),
             protector_staging_buffer_.c_slice_buffer());
-        result = tsi_zero_copy_grpc_protector_protect(
-            zero_copy_protector_, protector_staging_buffer_.c_slice_buffer(),
-            output_buffer_.c_slice_buffer());
+        result = ZeroCopyProtect(protector_staging_buffer_.c_slice_buffer());
       }
       if (result == TSI_OK && slices->length > 0) {
-        result = tsi_zero_copy_grpc_protector_protect(
-            zero_copy_protector_, slices, output_buffer_.c_slice_buffer());
+        result = ZeroCopyProtect(slices);
       }
       protector_staging_buffer_.Clear();
     } else {
@@ -589,8 +662,28 @@ class FrameProtector : public RefCounted<FrameProtector> {
   }
 
  private:
+  // Protects slices into output_buffer_, sealing the frames of large writes
+  // in parallel.
+  tsi_result ZeroCopyProtect(grpc_slice_buffer* slices)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(write_mu_) {
+    if (parallel_threshold_ == 0 || slices->length < parallel_threshold_) {
+      return tsi_zero_copy_grpc_protector_protect(
+          zero_copy_protector_, slices, output_buffer_.c_slice_buffer());
+    }
+    return tsi_zero_copy_grpc_protector_protect_parallel(
+        zero_copy_protector_, slices, output_buffer_.c_slice_buffer(),
+        max_parallelism_,
+        [](size_t n, absl::FunctionRef<void(size_t)> seal) {
+          SealInParallel(n, seal);
+        });
+  }
+
   struct tsi_frame_protector* const protector_;
   struct tsi_zero_copy_grpc_protector* const zero_copy_protector_;
+  const bool kernel_protected_writes_;
+  // Writes of at least this many bytes are sealed in parallel, unless 0.
+  size_t parallel_threshold_ = 0;
+  size_t max_parallelism_ = 1;
   Mutex mu_;
   Mutex read_mu_;
   Mutex write_mu_;
@@ -1027,8 +1120,10 @@ class SecureEndpoint final : public EventEngine::Endpoint,
         // If we're already writing (== encrypting on another thread) we need to
         // queue the writes up to do after that completes.
         // OR if we're not already writing but this write is large, we push it
-        // onto the event engine to encrypt later.
-        if (*writing_ || data->Length() > large_write_threshold_) {
+        // onto the event engine to encrypt later, unless the kernel encrypts
+        // it anyway.
+        if (*writing_ || (data->Length() > large_write_threshold_ &&
+                          !frame_protector_.kernel_protected_writes())) {
           // Since we don't call on_write until we've collected pending_writes
           // in the FinishAsyncWrites path, and EventEngine insists that one
           // write finishes before a second begins, we should never see a Write
@@ -37,6 +37,16 @@
   "grpc.secure_endpoint.encryption_offload_threshold"
 #define GRPC_ARG_ENCRYPTION_OFFLOAD_MAX_BUFFERED_WRITES \
   "grpc.secure_endpoint.encryption_offload_max_buffered_writes"
+// Integer. The size of a write from which the secure endpoint seals its
+// frames concurrently on a dedicated thread pool, if the frame protector can.
+// Zero or negative disables it.
+#define GRPC_ARG_PARALLEL_ENCRYPTION_THRESHOLD \
+  "grpc.secure_endpoint.parallel_encryption_threshold"
+// Boolean. Set by the security handshaker once the kernel protects the
+// records written to the wrapped endpoint, in which case the secure endpoint
+// passes writes through as plaintext and only unprotects reads.
+#define GRPC_ARG_SECURE_ENDPOINT_KERNEL_PROTECTED_WRITES \
+  "grpc.internal.secure_endpoint.kernel_protected_writes"
 
 // Takes ownership of protector, zero_copy_protector, and to_wrap, and refs
 // leftover_slices. If zero_copy_protector is not NULL, protector will never be
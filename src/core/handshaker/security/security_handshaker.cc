@@ -40,8 +40,10 @@
 #include "src/core/handshaker/handshaker.h"
 #include "src/core/handshaker/handshaker_factory.h"
 #include "src/core/handshaker/handshaker_registry.h"
+#include "src/core/handshaker/security/handshake_offload_pool.h"
 #include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
@@ -50,6 +52,7 @@
 #include "src/core/lib/iomgr/tcp_server.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
 #include "src/core/transport/auth_context.h"
@@ -87,6 +90,11 @@ class SecurityHandshaker : public Handshaker {
   grpc_error_handle DoHandshakerNextLocked(const unsigned char* bytes_received,
                                            size_t bytes_received_size)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  grpc_error_handle CallHandshakerNextLocked(
+      const unsigned char* bytes_received, size_t bytes_received_size)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnOffloadSlotReady(absl::StatusOr<int64_t> queue_time_us,
+                          size_t bytes_received_size);
 
   grpc_error_handle OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -110,10 +118,14 @@ class SecurityHandshaker : public Handshaker {
   // State set at creation time.
   tsi_handshaker* handshaker_;
   RefCountedPtr<grpc_security_connector> connector_;
+  RefCountedPtr<HandshakeOffloadPool> offload_pool_;
+  InstrumentStorageRefPtr<HandshakeOffloadDomain> offload_metrics_;
 
   Mutex mu_;
 
   bool is_shutdown_ = false;
+  // Whether a handshake step waits for a slot in offload_pool_.
+  bool offload_step_queued_ ABSL_GUARDED_BY(mu_) = false;
 
   // State saved while performing the handshake.
   HandshakerArgs* args_ = nullptr;
@@ -138,7 +150,15 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
       handshake_buffer_(
           static_cast<uint8_t*>(gpr_malloc(handshake_buffer_size_))),
       max_frame_size_(
-          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))) {}
+          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))) {
+  offload_pool_ = HandshakeOffloadPool::Get(args);
+  auto* stats_plugin_group =
+      args.GetObject<GlobalStatsPluginRegistry::StatsPluginGroup>();
+  if (offload_pool_ != nullptr && stats_plugin_group != nullptr) {
+    offload_metrics_ = HandshakeOffloadDomain::GetStorage(
+        stats_plugin_group->GetCollectionScope());
+  }
+}
 
 SecurityHandshaker::~SecurityHandshaker() {
   tsi_handshaker_destroy(handshaker_);
@@ -211,6 +231,29 @@ MakeChannelzSecurityFromAuthContext(grpc_auth_context* auth_context) {
   return security;
 }
 
+// If requested, lets the kernel protect the records written to endpoint and
+// returns args telling the secure endpoint to write plaintext. Otherwise, or
+// if the protector or the platform cannot do it, returns args unchanged.
+ChannelArgs MaybeOffloadProtectToKernel(tsi_frame_protector* protector,
+                                        grpc_endpoint* endpoint,
+                                        const ChannelArgs& args) {
+  if (!args.GetBool(GRPC_ARG_TLS_KERNEL_OFFLOAD).value_or(false) ||
+      args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false)) {
+    return args;
+  }
+  const int fd = grpc_endpoint_get_fd(endpoint);
+  if (fd < 0) return args;
+  tsi_result result =
+      tsi_frame_protector_offload_protect_to_kernel(protector, fd);
+  if (result != TSI_OK) {
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "Not offloading record protection to the kernel for fd " << fd
+        << ": " << tsi_result_to_string(result);
+    return args;
+  }
+  return args.Set(GRPC_ARG_SECURE_ENDPOINT_KERNEL_PROTECTED_WRITES, true);
+}
+
 }  // namespace
 
 void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
@@ -278,17 +321,22 @@ void SecurityHandshaker::OnPeerCheckedFn(grpc_error_handle error) {
       zero_copy_protector != nullptr || protector != nullptr;
   // If we have a frame protector, create a secure endpoint.
   if (has_frame_protector) {
+    ChannelArgs endpoint_args = args_->args;
+    if (protector != nullptr) {
+      endpoint_args = MaybeOffloadProtectToKernel(
+          protector, args_->endpoint.get(), endpoint_args);
+    }
     if (unused_bytes_size > 0) {
       grpc_slice slice = grpc_slice_from_copied_buffer(
           reinterpret_cast<const char*>(unused_bytes), unused_bytes_size);
       args_->endpoint = grpc_secure_endpoint_create(
           protector, zero_copy_protector, std::move(args_->endpoint), &slice, 1,
-          args_->args);
+          endpoint_args);
       CSliceUnref(slice);
     } else {
       args_->endpoint = grpc_secure_endpoint_create(
           protector, zero_copy_protector, std::move(args_->endpoint), nullptr,
-          0, args_->args);
+          0, endpoint_args);
     }
   } else if (unused_bytes_size > 0) {
     // Not wrapping the endpoint, so just pass along unused bytes.
@@ -418,6 +466,59 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  if (offload_pool_ == nullptr) {
+    return CallHandshakerNextLocked(bytes_received, bytes_received_size);
+  }
+  // Nothing else touches handshake_buffer_ until the step has run, since
+  // no read is pending meanwhile.
+  GRPC_CHECK(bytes_received == handshake_buffer_);
+  offload_step_queued_ = true;
+  offload_pool_->Run([self = RefAsSubclass<SecurityHandshaker>(),
+                      bytes_received_size](
+                         absl::StatusOr<int64_t> queue_time_us) mutable {
+    ExecCtx exec_ctx;
+    self->OnOffloadSlotReady(std::move(queue_time_us), bytes_received_size);
+    // Avoid destruction outside of an ExecCtx (since this is non-cancelable).
+    self.reset();
+  });
+  return absl::OkStatus();
+}
+
+void SecurityHandshaker::OnOffloadSlotReady(
+    absl::StatusOr<int64_t> queue_time_us, size_t bytes_received_size) {
+  MutexLock lock(&mu_);
+  if (!std::exchange(offload_step_queued_, false)) {
+    // Shutdown() already failed the handshake while the step was queued.
+    return;
+  }
+  if (!queue_time_us.ok()) {
+    if (offload_metrics_ != nullptr) {
+      offload_metrics_->Increment(HandshakeOffloadDomain::kRejectedHandshakes);
+    }
+    HandshakeFailedLocked(queue_time_us.status());
+    return;
+  }
+  if (is_shutdown_) {
+    HandshakeFailedLocked(GRPC_ERROR_CREATE("Handshaker shutdown"));
+    return;
+  }
+  if (offload_metrics_ != nullptr) {
+    offload_metrics_->Increment(HandshakeOffloadDomain::kQueueTime,
+                                *queue_time_us);
+    offload_metrics_->Increment(HandshakeOffloadDomain::kActiveHandshakes);
+  }
+  grpc_error_handle error =
+      CallHandshakerNextLocked(handshake_buffer_, bytes_received_size);
+  if (offload_metrics_ != nullptr) {
+    offload_metrics_->Decrement(HandshakeOffloadDomain::kActiveHandshakes);
+  }
+  if (!error.ok()) {
+    HandshakeFailedLocked(std::move(error));
+  }
+}
+
+grpc_error_handle SecurityHandshaker::CallHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
@@ -523,6 +624,11 @@ void SecurityHandshaker::Shutdown(grpc_error_handle error) {
     connector_->cancel_check_peer(on_peer_checked_, std::move(error));
     tsi_handshaker_shutdown(handshaker_, /*peer_closed=*/false);
     args_->endpoint.reset();
+    // A step waiting for the offload pool may not get a slot for a while,
+    // so fail the handshake now rather than when it does.
+    if (std::exchange(offload_step_queued_, false)) {
+      Finish(GRPC_ERROR_CREATE("Handshaker shutdown"));
+    }
   }
 }
 
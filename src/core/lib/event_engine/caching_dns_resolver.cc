@@ -0,0 +1,396 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/caching_dns_resolver.h"
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace grpc_core {
+
+DnsCacheTelemetryDomain::CounterHandle DnsCacheTelemetryDomain::kCacheHits =
+    DnsCacheTelemetryDomain::RegisterCounter(
+        "grpc.dns_cache.hits",
+        "EXPERIMENTAL.  Number of DNS lookups answered from the shared DNS "
+        "cache, including with stale results.",
+        "{lookup}");
+DnsCacheTelemetryDomain::CounterHandle
+    DnsCacheTelemetryDomain::kCoalescedLookups =
+        DnsCacheTelemetryDomain::RegisterCounter(
+            "grpc.dns_cache.coalesced_lookups",
+            "EXPERIMENTAL.  Number of DNS lookups that waited for a query "
+            "started by an earlier lookup of the same name.",
+            "{lookup}");
+DnsCacheTelemetryDomain::CounterHandle
+    DnsCacheTelemetryDomain::kUpstreamQueries =
+        DnsCacheTelemetryDomain::RegisterCounter(
+            "grpc.dns_cache.upstream_queries",
+            "EXPERIMENTAL.  Number of DNS queries made by the shared DNS "
+            "cache.",
+            "{query}");
+
+}  // namespace grpc_core
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+using grpc_core::DnsCacheTelemetryDomain;
+using grpc_core::Duration;
+using grpc_core::MutexLock;
+using grpc_core::Timestamp;
+
+struct DNSCacheKey {
+  const EventEngine* event_engine;
+  std::string dns_server;
+  std::string name;
+  // Empty for SRV and TXT lookups.
+  std::string default_port;
+  int64_t ttl_ms;
+  int64_t negative_ttl_ms;
+  int64_t stale_ttl_ms;
+
+  bool operator==(const DNSCacheKey& other) const {
+    return event_engine == other.event_engine &&
+           dns_server == other.dns_server && name == other.name &&
+           default_port == other.default_port && ttl_ms == other.ttl_ms &&
+           negative_ttl_ms == other.negative_ttl_ms &&
+           stale_ttl_ms == other.stale_ttl_ms;
+  }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const DNSCacheKey& key) {
+    return H::combine(std::move(h), key.event_engine, key.dns_server,
+                      key.name, key.default_port, key.ttl_ms,
+                      key.negative_ttl_ms, key.stale_ttl_ms);
+  }
+};
+
+// The results of one type of lookup.
+template <typename T>
+class DNSResultCache {
+ public:
+  using Result = absl::StatusOr<std::vector<T>>;
+  using Callback = absl::AnyInvocable<void(Result)>;
+  // Starts the lookup on the given resolver.
+  using Query =
+      absl::AnyInvocable<void(EventEngine::DNSResolver*, Callback on_done)>;
+
+  explicit DNSResultCache(absl::string_view record_type)
+      : metrics_storage_(DnsCacheTelemetryDomain::GetStorage(
+            grpc_core::GlobalCollectionScope(), record_type)) {}
+
+  void Lookup(const CachingDNSResolver* owner,
+              std::shared_ptr<EventEngine> event_engine,
+              const EventEngine::DNSResolver::ResolverOptions& options,
+              DNSCacheKey key, Callback on_resolve, Query query) {
+    const Timestamp now = Timestamp::Now();
+    std::optional<Result> cached_result;
+    bool start_query = false;
+    {
+      MutexLock lock(&mu_);
+      if (entries_.size() >= prune_threshold_) {
+        PruneLocked(now);
+        prune_threshold_ = std::max<size_t>(64, entries_.size() * 2);
+      }
+      Entry& entry = entries_[key];
+      // If the EventEngine is gone, the one we were given merely reuses its
+      // address.  There is no query in flight, since that would hold a ref
+      // to the EventEngine.
+      if (entry.event_engine.expired()) {
+        entry = Entry();
+        entry.event_engine = event_engine;
+      }
+      switch (Usability(key, entry, now)) {
+        case kFresh:
+          cached_result = *entry.result;
+          break;
+        case kStale:
+          cached_result = *entry.result;
+          start_query = !entry.query_in_flight;
+          break;
+        case kUnusable:
+          entry.waiters.push_back({owner, std::move(on_resolve)});
+          start_query = !entry.query_in_flight;
+          if (!start_query) {
+            metrics_storage_->Increment(
+                DnsCacheTelemetryDomain::kCoalescedLookups);
+          }
+          break;
+      }
+      if (start_query) entry.query_in_flight = true;
+    }
+    if (cached_result.has_value()) {
+      metrics_storage_->Increment(DnsCacheTelemetryDomain::kCacheHits);
+      event_engine->Run([on_resolve = std::move(on_resolve),
+                         result = std::move(*cached_result)]() mutable {
+        on_resolve(std::move(result));
+      });
+    }
+    if (start_query) {
+      StartQuery(std::move(event_engine), options, std::move(key),
+                 std::move(query));
+    }
+  }
+
+  // Cancels the lookups started by owner that are waiting for a query.
+  void CancelLookups(const CachingDNSResolver* owner,
+                     EventEngine* event_engine) {
+    std::vector<Callback> cancelled;
+    {
+      MutexLock lock(&mu_);
+      for (auto& [key, entry] : entries_) {
+        auto it = std::remove_if(
+            entry.waiters.begin(), entry.waiters.end(),
+            [&](Waiter& waiter) {
+              if (waiter.owner != owner) return false;
+              cancelled.push_back(std::move(waiter.on_resolve));
+              return true;
+            });
+        entry.waiters.erase(it, entry.waiters.end());
+      }
+    }
+    for (auto& on_resolve : cancelled) {
+      event_engine->Run([on_resolve = std::move(on_resolve)]() mutable {
+        on_resolve(absl::CancelledError("DNS resolver destroyed"));
+      });
+    }
+  }
+
+  void Clear() {
+    MutexLock lock(&mu_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      // Queries in flight must find their entries when they complete.
+      if (it->second.query_in_flight) {
+        it->second.result.reset();
+        ++it;
+      } else {
+        entries_.erase(it++);
+      }
+    }
+  }
+
+ private:
+  struct Waiter {
+    const CachingDNSResolver* owner;
+    Callback on_resolve;
+  };
+
+  struct Entry {
+    std::weak_ptr<EventEngine> event_engine;
+    std::optional<Result> result;
+    Timestamp result_time;
+    bool query_in_flight = false;
+    // Set while the query is in flight.  Unset if the query failed to
+    // start.
+    std::unique_ptr<EventEngine::DNSResolver> upstream;
+    std::vector<Waiter> waiters;
+  };
+
+  enum ResultUsability { kFresh, kStale, kUnusable };
+
+  static ResultUsability Usability(const DNSCacheKey& key, const Entry& entry,
+                                   Timestamp now) {
+    if (!entry.result.has_value()) return kUnusable;
+    const Duration age = now - entry.result_time;
+    if (entry.result->ok()) {
+      if (age < Duration::Milliseconds(key.ttl_ms)) return kFresh;
+      if (age < Duration::Milliseconds(key.ttl_ms + key.stale_ttl_ms)) {
+        return kStale;
+      }
+      return kUnusable;
+    }
+    if (age < Duration::Milliseconds(key.negative_ttl_ms)) return kFresh;
+    return kUnusable;
+  }
+
+  void StartQuery(std::shared_ptr<EventEngine> event_engine,
+                  const EventEngine::DNSResolver::ResolverOptions& options,
+                  DNSCacheKey key, Query query) {
+    metrics_storage_->Increment(DnsCacheTelemetryDomain::kUpstreamQueries);
+    auto upstream = event_engine->GetDNSResolver(options);
+    if (!upstream.ok()) {
+      OnQueryDone(key, upstream.status(), event_engine);
+      return;
+    }
+    EventEngine::DNSResolver* upstream_ptr = upstream->get();
+    {
+      MutexLock lock(&mu_);
+      // Entries are never removed while their query is in flight.
+      entries_[key].upstream = std::move(*upstream);
+    }
+    query(upstream_ptr, [this, key = std::move(key),
+                         event_engine = std::move(event_engine)](
+                            Result result) mutable {
+      OnQueryDone(key, std::move(result), std::move(event_engine));
+    });
+  }
+
+  void OnQueryDone(const DNSCacheKey& key, Result result,
+                   std::shared_ptr<EventEngine> event_engine) {
+    const Timestamp now = Timestamp::Now();
+    std::vector<Waiter> waiters;
+    std::unique_ptr<EventEngine::DNSResolver> upstream;
+    {
+      MutexLock lock(&mu_);
+      Entry& entry = entries_[key];
+      entry.query_in_flight = false;
+      upstream = std::move(entry.upstream);
+      waiters = std::move(entry.waiters);
+      entry.waiters.clear();
+      // A failed refresh does not replace a result that can still be
+      // served stale.
+      if (result.ok() || Usability(key, entry, now) != kStale) {
+        entry.result = result;
+        entry.result_time = now;
+      }
+    }
+    for (auto& waiter : waiters) {
+      event_engine->Run(
+          [on_resolve = std::move(waiter.on_resolve), result]() mutable {
+            on_resolve(std::move(result));
+          });
+    }
+    // We are most likely running in a callback from the upstream resolver,
+    // so it must be destroyed later.
+    if (upstream != nullptr) {
+      event_engine->Run([upstream = std::move(upstream)]() {});
+    }
+  }
+
+  // Removes entries that have neither a usable result nor a query in
+  // flight.
+  void PruneLocked(Timestamp now) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      const Entry& entry = it->second;
+      if (!entry.query_in_flight &&
+          (entry.event_engine.expired() ||
+           Usability(it->first, entry, now) == kUnusable)) {
+        entries_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  const grpc_core::InstrumentStorageRefPtr<DnsCacheTelemetryDomain>
+      metrics_storage_;
+  grpc_core::Mutex mu_;
+  absl::flat_hash_map<DNSCacheKey, Entry> entries_ ABSL_GUARDED_BY(mu_);
+  // Size at which PruneLocked() is next run.
+  size_t prune_threshold_ ABSL_GUARDED_BY(mu_) = 64;
+};
+
+DNSResultCache<EventEngine::ResolvedAddress>& HostnameCache() {
+  static grpc_core::NoDestruct<DNSResultCache<EventEngine::ResolvedAddress>>
+      cache("hostname");
+  return *cache;
+}
+
+DNSResultCache<EventEngine::DNSResolver::SRVRecord>& SRVCache() {
+  static grpc_core::NoDestruct<
+      DNSResultCache<EventEngine::DNSResolver::SRVRecord>>
+      cache("srv");
+  return *cache;
+}
+
+DNSResultCache<std::string>& TXTCache() {
+  static grpc_core::NoDestruct<DNSResultCache<std::string>> cache("txt");
+  return *cache;
+}
+
+}  // namespace
+
+CachingDNSResolver::CachingDNSResolver(
+    std::shared_ptr<EventEngine> event_engine, ResolverOptions resolver_options,
+    DNSCacheOptions cache_options)
+    : event_engine_(std::move(event_engine)),
+      resolver_options_(std::move(resolver_options)),
+      cache_options_(cache_options) {}
+
+CachingDNSResolver::~CachingDNSResolver() {
+  HostnameCache().CancelLookups(this, event_engine_.get());
+  SRVCache().CancelLookups(this, event_engine_.get());
+  TXTCache().CancelLookups(this, event_engine_.get());
+}
+
+void CachingDNSResolver::LookupHostname(LookupHostnameCallback on_resolve,
+                                        absl::string_view name,
+                                        absl::string_view default_port) {
+  HostnameCache().Lookup(
+      this, event_engine_, resolver_options_,
+      DNSCacheKey{event_engine_.get(), resolver_options_.dns_server,
+                  std::string(name), std::string(default_port),
+                  cache_options_.ttl.millis(),
+                  cache_options_.negative_ttl.millis(),
+                  cache_options_.stale_ttl.millis()},
+      std::move(on_resolve),
+      [name = std::string(name), default_port = std::string(default_port)](
+          DNSResolver* upstream, LookupHostnameCallback on_done) {
+        upstream->LookupHostname(std::move(on_done), name, default_port);
+      });
+}
+
+void CachingDNSResolver::LookupSRV(LookupSRVCallback on_resolve,
+                                   absl::string_view name) {
+  SRVCache().Lookup(
+      this, event_engine_, resolver_options_,
+      DNSCacheKey{event_engine_.get(), resolver_options_.dns_server,
+                  std::string(name), /*default_port=*/"",
+                  cache_options_.ttl.millis(),
+                  cache_options_.negative_ttl.millis(),
+                  cache_options_.stale_ttl.millis()},
+      std::move(on_resolve),
+      [name = std::string(name)](DNSResolver* upstream,
+                                 LookupSRVCallback on_done) {
+        upstream->LookupSRV(std::move(on_done), name);
+      });
+}
+
+void CachingDNSResolver::LookupTXT(LookupTXTCallback on_resolve,
+                                   absl::string_view name) {
+  TXTCache().Lookup(
+      this, event_engine_, resolver_options_,
+      DNSCacheKey{event_engine_.get(), resolver_options_.dns_server,
+                  std::string(name), /*default_port=*/"",
+                  cache_options_.ttl.millis(),
+                  cache_options_.negative_ttl.millis(),
+                  cache_options_.stale_ttl.millis()},
+      std::move(on_resolve),
+      [name = std::string(name)](DNSResolver* upstream,
+                                 LookupTXTCallback on_done) {
+        upstream->LookupTXT(std::move(on_done), name);
+      });
+}
+
+void CachingDNSResolver::TestOnlyClearCache() {
+  HostnameCache().Clear();
+  SRVCache().Clear();
+  TXTCache().Clear();
+}
+
+}  // namespace grpc_event_engine::experimental
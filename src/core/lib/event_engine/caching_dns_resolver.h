@@ -0,0 +1,94 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+
+#include "src/core/telemetry/instrument.h"
+#include "src/core/util/time.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+class DnsCacheTelemetryDomain final
+    : public InstrumentDomain<DnsCacheTelemetryDomain> {
+ public:
+  using Backend = LowContentionBackend;
+  static constexpr absl::string_view kName = "dns_cache";
+  GRPC_INSTRUMENT_DOMAIN_LABELS("grpc.dns.record_type");
+
+  // Lookups answered from a cached result, fresh or stale.
+  static CounterHandle kCacheHits;
+  // Lookups that waited for a query already started by another lookup.
+  static CounterHandle kCoalescedLookups;
+  // Queries sent to the underlying resolver.
+  static CounterHandle kUpstreamQueries;
+};
+
+}  // namespace grpc_core
+
+namespace grpc_event_engine::experimental {
+
+struct DNSCacheOptions {
+  // How long a successful result is used without querying again.
+  grpc_core::Duration ttl;
+  // How long a failed lookup is remembered.  Zero disables negative
+  // caching.
+  grpc_core::Duration negative_ttl;
+  // How long past its TTL a successful result may still be returned, while
+  // it is being refreshed in the background.  Zero disables serving stale
+  // results.
+  grpc_core::Duration stale_ttl;
+};
+
+// A DNSResolver that answers lookups from a process-wide cache, shared by
+// all CachingDNSResolvers.  Concurrent lookups of the same name and record
+// type result in a single query, made with a DNSResolver obtained from the
+// EventEngine.  Results are shared only between resolvers with the same
+// EventEngine, DNS server and cache options.
+//
+// The EventEngine DNSResolver API does not report record TTLs, so results
+// are cached for the configured duration.
+//
+// Lookups still waiting for a query when the CachingDNSResolver is
+// destroyed are cancelled; the query itself continues and its result is
+// cached.
+class CachingDNSResolver final : public EventEngine::DNSResolver {
+ public:
+  CachingDNSResolver(std::shared_ptr<EventEngine> event_engine,
+                     ResolverOptions resolver_options,
+                     DNSCacheOptions cache_options);
+  ~CachingDNSResolver() override;
+
+  void LookupHostname(LookupHostnameCallback on_resolve, absl::string_view name,
+                      absl::string_view default_port) override;
+  void LookupSRV(LookupSRVCallback on_resolve, absl::string_view name) override;
+  void LookupTXT(LookupTXTCallback on_resolve, absl::string_view name) override;
+
+  // Forgets all cached results.  Queries in flight are not affected.
+  static void TestOnlyClearCache();
+
+ private:
+  std::shared_ptr<EventEngine> event_engine_;
+  const ResolverOptions resolver_options_;
+  const DNSCacheOptions cache_options_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
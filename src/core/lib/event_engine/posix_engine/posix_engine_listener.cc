@@ -31,6 +31,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
@@ -52,6 +53,25 @@
 
 namespace grpc_event_engine::experimental {
 
+namespace {
+
+// Asks the kernel to prefer this listening socket, among those sharing its
+// port through SO_REUSEPORT, for connections received on the given CPU.
+void SetSocketIncomingCpu(
+    GRPC_UNUSED EventEnginePosixInterface& posix_interface,
+    GRPC_UNUSED const FileDescriptor& fd, GRPC_UNUSED int cpu) {
+#ifdef SO_INCOMING_CPU
+  auto result =
+      posix_interface.SetSockOpt(fd, SOL_SOCKET, SO_INCOMING_CPU, cpu);
+  if (!result.ok()) {
+    VLOG(2) << "cannot set SO_INCOMING_CPU fd=" << fd.fd()
+            << " error=" << result.StrError();
+  }
+#endif  // SO_INCOMING_CPU
+}
+
+}  // namespace
+
 PosixEngineListenerImpl::PosixEngineListenerImpl(
     PosixEventEngineWithFdSupport::PosixAcceptCallback on_accept,
     absl::AnyInvocable<void(absl::Status)> on_shutdown,
@@ -101,10 +121,13 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
   // Update the callback. Any subsequent new sockets created and added to
   // acceptors_ in this function will invoke the new callback.
   acceptors_.UpdateOnAppendCallback(std::move(on_bind_new_fd));
+  const int first_new_socket = acceptors_.Size();
   if (used_port.has_value()) {
     requested_port = *used_port;
-    return ListenerContainerAddWildcardAddresses(&posix_interface, acceptors_,
-                                                 options_, requested_port);
+    auto port = ListenerContainerAddWildcardAddresses(
+        &posix_interface, acceptors_, options_, requested_port);
+    if (port.ok()) AddListenerShardsLocked(first_new_socket);
+    return port;
   }
   if (ResolvedAddressToV4Mapped(res_addr, &addr6_v4mapped)) {
     res_addr = addr6_v4mapped;
@@ -114,9 +137,42 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
       CreateAndPrepareListenerSocket(&posix_interface, options_, res_addr);
   GRPC_RETURN_IF_ERROR(result.status());
   acceptors_.Append(*result);
+  AddListenerShardsLocked(first_new_socket);
   return result->port;
 }
 
+void PosixEngineListenerImpl::AddListenerShardsLocked(int first_new_socket) {
+  if (options_.listener_shards <= 1 || !options_.allow_reuse_port ||
+      !IsSocketReusePortSupported()) {
+    return;
+  }
+  std::vector<ListenerSocketsContainer::ListenerSocket> sockets;
+  int index = 0;
+  for (auto it = acceptors_.begin(); it != acceptors_.end(); ++it, ++index) {
+    if (index >= first_new_socket) sockets.push_back((*it)->Socket());
+  }
+  EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+  for (const ListenerSocketsContainer::ListenerSocket& socket : sockets) {
+    const int family = socket.addr.address()->sa_family;
+    if (family != AF_INET && family != AF_INET6) continue;
+    EventEngine::ResolvedAddress addr = socket.addr;
+    ResolvedAddressSetPort(addr, socket.port);
+    SetSocketIncomingCpu(posix_interface, socket.sock, 0);
+    for (int shard = 1; shard < options_.listener_shards; ++shard) {
+      auto shard_socket =
+          CreateAndPrepareListenerSocket(&posix_interface, options_, addr);
+      if (!shard_socket.ok()) {
+        LOG(ERROR) << "Failed to open listener shard " << shard << " of "
+                   << options_.listener_shards << " for port " << socket.port
+                   << ": " << shard_socket.status();
+        break;
+      }
+      SetSocketIncomingCpu(posix_interface, shard_socket->sock, shard);
+      acceptors_.Append(*shard_socket);
+    }
+  }
+}
+
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
   Ref();
   handle_->NotifyOnRead(notify_on_accept_);
@@ -173,6 +173,14 @@ class PosixEngineListenerImpl
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
   };
+  // Gives every TCP socket appended to acceptors_ from index first_new_socket
+  // on options_.listener_shards - 1 siblings bound to the same address through
+  // SO_REUSEPORT, preferring shard i for connections received on CPU i, so
+  // that incoming connections are queued on several sockets instead of
+  // funnelling through one.
+  void AddListenerShardsLocked(int first_new_socket)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   friend class ListenerAsyncAcceptors;
   friend class AsyncConnectionAcceptor;
   // The mutex ensures thread safety when multiple threads try to call Bind
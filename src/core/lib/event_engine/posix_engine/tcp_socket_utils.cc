@@ -17,9 +17,11 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <limits.h>
 
+#include <algorithm>
 #include <optional>
 
 #include "src/core/lib/iomgr/port.h"
@@ -115,6 +117,13 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.listener_shards =
+      AdjustValue(1, 0, PosixTcpOptions::kMaxListenerShards,
+                  config.GetInt(GRPC_ARG_TCP_LISTENER_SHARDS));
+  if (options.listener_shards == 0) {
+    options.listener_shards = std::min<int>(
+        gpr_cpu_num_cores(), PosixTcpOptions::kMaxListenerShards);
+  }
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
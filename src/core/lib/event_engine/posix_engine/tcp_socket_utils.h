@@ -55,6 +55,7 @@ struct PosixTcpOptions {
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
+  static constexpr int kMaxListenerShards = 1024;
   int tcp_read_chunk_size = kDefaultReadChunkSize;
   int tcp_min_read_chunk_size = kDefaultMinReadChunksize;
   int tcp_max_read_chunk_size = kDefaultMaxReadChunksize;
@@ -67,6 +68,9 @@ struct PosixTcpOptions {
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  // Number of SO_REUSEPORT listening sockets per bound address; see
+  // GRPC_ARG_TCP_LISTENER_SHARDS.
+  int listener_shards = 1;
   int dscp = kDscpNotSet;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
@@ -139,6 +143,7 @@ struct PosixTcpOptions {
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    listener_shards = other.listener_shards;
     dscp = other.dscp;
   }
 };
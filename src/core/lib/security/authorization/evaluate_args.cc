@@ -18,6 +18,8 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <memory>
+
 #include "src/core/credentials/transport/tls/tls_utils.h"
 #include "src/core/handshaker/endpoint_info/endpoint_info_handshaker.h"
 #include "src/core/lib/address_utils/parse_address.h"
@@ -214,4 +216,75 @@ absl::string_view EvaluateArgs::GetSubject() const {
   return channel_args_->subject;
 }
 
+EvaluateArgs::PerChannelArgs::ConnectionScopedResults*
+EvaluateArgs::GetConnectionScopedResults() const {
+  if (channel_args_ == nullptr) {
+    return nullptr;
+  }
+  return channel_args_->connection_scoped_results.get();
+}
+
+EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Result
+EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Slots::Load(
+    size_t slot) const {
+  const uint64_t value = slots_[slot].load(std::memory_order_relaxed);
+  if ((value >> 2) != engine_id_) return kUnknown;
+  return static_cast<Result>(value & 3);
+}
+
+void EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Slots::Store(
+    size_t slot, Result result) {
+  const uint64_t desired = (engine_id_ << 2) | result;
+  uint64_t expected = slots_[slot].load(std::memory_order_acquire);
+  do {
+    // Once the entry belongs to another engine, leave that engine's results
+    // alone.
+    if ((expected >> 2) != engine_id_ &&
+        owner_->load(std::memory_order_acquire) != engine_id_) {
+      return;
+    }
+  } while (!slots_[slot].compare_exchange_weak(expected, desired,
+                                               std::memory_order_release,
+                                               std::memory_order_acquire));
+}
+
+EvaluateArgs::PerChannelArgs::ConnectionScopedResults::
+    ~ConnectionScopedResults() {
+  for (auto& entry : entries_) {
+    delete entry.load(std::memory_order_relaxed);
+  }
+}
+
+EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Slots
+EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Get(
+    uint64_t engine_id) {
+  for (auto& entry_ptr : entries_) {
+    Entry* entry = entry_ptr.load(std::memory_order_acquire);
+    if (entry == nullptr) break;
+    if (entry->engine_id.load(std::memory_order_acquire) == engine_id) {
+      return Slots(&entry->engine_id, entry->slots, engine_id);
+    }
+  }
+  MutexLock lock(&mu_);
+  for (auto& entry_ptr : entries_) {
+    Entry* entry = entry_ptr.load(std::memory_order_relaxed);
+    if (entry == nullptr) {
+      // Entries are filled in order, so the engine has none yet.
+      entry = new Entry();
+      entry->engine_id.store(engine_id, std::memory_order_relaxed);
+      entry_ptr.store(entry, std::memory_order_release);
+      return Slots(&entry->engine_id, entry->slots, engine_id);
+    }
+    if (entry->engine_id.load(std::memory_order_relaxed) == engine_id) {
+      return Slots(&entry->engine_id, entry->slots, engine_id);
+    }
+  }
+  // Slots of the evicted engine carry its ID, so they read as kUnknown for
+  // this one without being cleared.
+  Entry* entry = entries_[next_eviction_].load(std::memory_order_relaxed);
+  next_eviction_ = (next_eviction_ + 1) % kMaxEngines;
+  entry->engine_id.store(engine_id, std::memory_order_release);
+  return Slots(&entry->engine_id, entry->slots, engine_id);
+}
+
 }  // namespace grpc_core
@@ -18,6 +18,10 @@
 #include <grpc/grpc_security.h>
 #include <grpc/support/port_platform.h>
 
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -25,6 +29,8 @@
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 
 namespace grpc_core {
@@ -42,6 +48,70 @@ class EvaluateArgs final {
       int port = 0;
     };
 
+    // Memoized results of authorization rules that depend only on the
+    // connection, and are thus the same for every call on it.  Results are
+    // stored per authorization engine, under an ID that is never reused, so
+    // that the results of an engine replaced by a policy update are not
+    // used for its successor.  Looking up the results of an engine seen
+    // before takes no lock.
+    class ConnectionScopedResults final {
+     public:
+      enum Result : uint8_t { kUnknown = 0, kMatch, kNoMatch };
+      // Only this many connection-scoped rules of an engine are memoized.
+      static constexpr size_t kMaxSlots = 16;
+
+      // The results of one engine, valid as long as the connection.
+      class Slots {
+       public:
+        Result Load(size_t slot) const;
+        void Store(size_t slot, Result result);
+
+       private:
+        friend class ConnectionScopedResults;
+
+        Slots(std::atomic<uint64_t>* owner, std::atomic<uint64_t>* slots,
+              uint64_t engine_id)
+            : owner_(owner), slots_(slots), engine_id_(engine_id) {}
+
+        // The ID of the engine the entry currently belongs to.
+        std::atomic<uint64_t>* owner_;
+        std::atomic<uint64_t>* slots_;
+        uint64_t engine_id_;
+      };
+
+      ConnectionScopedResults() = default;
+      ~ConnectionScopedResults();
+
+      ConnectionScopedResults(const ConnectionScopedResults&) = delete;
+      ConnectionScopedResults& operator=(const ConnectionScopedResults&) =
+          delete;
+
+      // Returns the results of the engine with the given ID.  All of them
+      // are initially kUnknown.
+      Slots Get(uint64_t engine_id);
+
+     private:
+      // Engines used on a connection can be replaced over its lifetime
+      // without us noticing, so once there are more than this, the results
+      // of one of them are evicted for each new one.
+      static constexpr size_t kMaxEngines = 16;
+
+      // Each slot holds the ID of the engine that stored it next to the
+      // result, so that a call still using an evicted engine's Slots does
+      // not see the results of the engine that replaced it in the entry.
+      // Stores only replace a slot holding a result of the entry's current
+      // engine if they come from that engine.
+      struct Entry {
+        std::atomic<uint64_t> engine_id{0};
+        std::atomic<uint64_t> slots[kMaxSlots] = {};
+      };
+
+      // Allocated on first use, and never freed before the connection.
+      std::atomic<Entry*> entries_[kMaxEngines] = {};
+      Mutex mu_;
+      size_t next_eviction_ ABSL_GUARDED_BY(mu_) = 0;
+    };
+
     PerChannelArgs(grpc_auth_context* auth_context, const ChannelArgs& args);
 
     absl::string_view transport_security_type;
@@ -52,6 +122,8 @@ class EvaluateArgs final {
     absl::string_view subject;
     Address local_address;
     Address peer_address;
+    std::unique_ptr<ConnectionScopedResults> connection_scoped_results =
+        std::make_unique<ConnectionScopedResults>();
   };
 
   EvaluateArgs(grpc_metadata_batch* metadata, PerChannelArgs* channel_args)
@@ -83,6 +155,9 @@ class EvaluateArgs final {
   absl::string_view GetCommonName() const;
   absl::string_view GetSubject() const;
 
+  // Returns null if there are no per-channel args.
+  PerChannelArgs::ConnectionScopedResults* GetConnectionScopedResults() const;
+
  private:
   grpc_metadata_batch* metadata_;
   PerChannelArgs* channel_args_;
@@ -17,12 +17,19 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <optional>
+#include <string>
 #include <utility>
 
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/iomgr/sockaddr.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/util/grpc_check.h"
+#include "absl/container/inlined_vector.h"
 
 namespace grpc_core {
 
@@ -42,17 +49,200 @@ bool ShouldLog(const Decision& decision,
           condition == Rbac::AuditCondition::kOnDeny);
 }
 
+// The rules of a permission that a request must match at least one of for
+// the permission to match, and that can be looked up in a policy index.
+struct IndexKeys {
+  std::vector<const StringMatcher*> paths;
+  std::vector<const Rbac::CidrRange*> destination_ips;
+  std::vector<const HeaderMatcher*> headers;
+
+  void Append(const IndexKeys& other) {
+    paths.insert(paths.end(), other.paths.begin(), other.paths.end());
+    destination_ips.insert(destination_ips.end(),
+                           other.destination_ips.begin(),
+                           other.destination_ips.end());
+    headers.insert(headers.end(), other.headers.begin(), other.headers.end());
+  }
+};
+
+// Appends to keys the rules of which a request must match at least one for
+// permission to match.  Returns false if permission is not constrained by
+// rules that can be indexed.
+bool CollectIndexKeys(const Rbac::Permission& permission, IndexKeys* keys) {
+  switch (permission.type) {
+    case Rbac::Permission::RuleType::kPath: {
+      const StringMatcher& matcher = permission.string_matcher;
+      if (!matcher.case_sensitive()) return false;
+      if (matcher.type() == StringMatcher::Type::kExact ||
+          (matcher.type() == StringMatcher::Type::kPrefix &&
+           !matcher.string_matcher().empty())) {
+        keys->paths.push_back(&matcher);
+        return true;
+      }
+      return false;
+    }
+    case Rbac::Permission::RuleType::kDestIp:
+      keys->destination_ips.push_back(&permission.ip);
+      return true;
+    case Rbac::Permission::RuleType::kHeader: {
+      const HeaderMatcher& matcher = permission.header_matcher;
+      if (matcher.type() != HeaderMatcher::Type::kExact ||
+          !matcher.case_sensitive() || matcher.invert_match()) {
+        return false;
+      }
+      keys->headers.push_back(&matcher);
+      return true;
+    }
+    case Rbac::Permission::RuleType::kOr:
+      for (const auto& sub_permission : permission.permissions) {
+        if (!CollectIndexKeys(*sub_permission, keys)) return false;
+      }
+      return true;
+    case Rbac::Permission::RuleType::kAnd:
+      // All sub-permissions must match, so any one that is indexable is
+      // enough.
+      for (const auto& sub_permission : permission.permissions) {
+        IndexKeys sub_keys;
+        if (CollectIndexKeys(*sub_permission, &sub_keys)) {
+          keys->Append(sub_keys);
+          return true;
+        }
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
+// Returns the bytes of address masked to prefix_len, as the key of a
+// destination IP table, or nullopt if address is neither IPv4 nor IPv6.
+std::optional<std::string> MaskedAddressKey(grpc_resolved_address address,
+                                            uint32_t prefix_len) {
+  grpc_sockaddr_mask_bits(&address, prefix_len);
+  const auto* addr = reinterpret_cast<const grpc_sockaddr*>(address.addr);
+  if (addr->sa_family == GRPC_AF_INET) {
+    const auto* addr4 = reinterpret_cast<const grpc_sockaddr_in*>(addr);
+    return std::string(reinterpret_cast<const char*>(&addr4->sin_addr),
+                       sizeof(addr4->sin_addr));
+  }
+  if (addr->sa_family == GRPC_AF_INET6) {
+    const auto* addr6 = reinterpret_cast<const grpc_sockaddr_in6*>(addr);
+    return std::string(reinterpret_cast<const char*>(&addr6->sin6_addr),
+                       sizeof(addr6->sin6_addr));
+  }
+  return std::nullopt;
+}
+
+// Appends index to indices unless it is already last, as it is when a
+// policy has several rules under the same key.
+void AddIndex(std::vector<size_t>& indices, size_t index) {
+  if (indices.empty() || indices.back() != index) indices.push_back(index);
+}
+
+// Returns true if principal depends only on the connection, not on the
+// call.
+bool IsConnectionScoped(const Rbac::Principal& principal) {
+  switch (principal.type) {
+    case Rbac::Principal::RuleType::kAnd:
+    case Rbac::Principal::RuleType::kOr:
+    case Rbac::Principal::RuleType::kNot:
+      for (const auto& sub_principal : principal.principals) {
+        if (!IsConnectionScoped(*sub_principal)) return false;
+      }
+      return true;
+    case Rbac::Principal::RuleType::kAny:
+    case Rbac::Principal::RuleType::kPrincipalName:
+    case Rbac::Principal::RuleType::kSourceIp:
+    case Rbac::Principal::RuleType::kDirectRemoteIp:
+    case Rbac::Principal::RuleType::kRemoteIp:
+    // Envoy metadata is never present, so this is constant.
+    case Rbac::Principal::RuleType::kMetadata:
+      return true;
+    default:
+      // Rules that depend on the call, like kHeader and kPath.
+      return false;
+  }
+}
+
+uint64_t NextEngineId() {
+  static std::atomic<uint64_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
 }  // namespace
 
+GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac::Action action)
+    : id_(NextEngineId()),
+      action_(action),
+      audit_condition_(Rbac::AuditCondition::kNone) {}
+
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(const Rbac& rbac)
-    : name_(rbac.name),
+    : id_(NextEngineId()),
+      name_(rbac.name),
       action_(rbac.action),
       audit_condition_(rbac.audit_condition) {
+  auto policy_index = std::make_unique<PolicyIndex>();
+  std::map<std::string, std::vector<size_t>> prefixes;
   for (auto& [name, policy] : rbac.policies) {
+    const size_t index = policies_.size();
     auto& engine_policy = policies_.emplace_back();
     engine_policy.name = name;
-    engine_policy.matcher =
-        std::make_unique<PolicyAuthorizationMatcher>(policy);
+    engine_policy.permissions =
+        AuthorizationMatcher::Create(policy.permissions);
+    engine_policy.principals = AuthorizationMatcher::Create(policy.principals);
+    // Matching any principal is cheaper than looking up its result.
+    if (policy.principals.type != Rbac::Principal::RuleType::kAny &&
+        num_connection_scoped_slots_ <
+            EvaluateArgs::PerChannelArgs::ConnectionScopedResults::kMaxSlots &&
+        IsConnectionScoped(policy.principals)) {
+      engine_policy.connection_scoped_slot = num_connection_scoped_slots_++;
+    }
+    IndexKeys keys;
+    if (!CollectIndexKeys(policy.permissions, &keys)) {
+      policy_index->unconstrained.push_back(index);
+      continue;
+    }
+    for (const StringMatcher* matcher : keys.paths) {
+      AddIndex(matcher->type() == StringMatcher::Type::kExact
+                   ? policy_index->exact_paths[matcher->string_matcher()]
+                   : prefixes[matcher->string_matcher()],
+               index);
+    }
+    for (const Rbac::CidrRange* range : keys.destination_ips) {
+      auto address = StringToSockaddr(range->address_prefix, 0);
+      // Such a rule never matches, so the policy need not be a candidate
+      // for it.
+      if (!address.ok()) continue;
+      std::optional<std::string> key =
+          MaskedAddressKey(*address, range->prefix_len);
+      if (!key.has_value()) continue;
+      const int family =
+          reinterpret_cast<const grpc_sockaddr*>(address->addr)->sa_family;
+      auto table = std::find_if(
+          policy_index->destination_ips.begin(),
+          policy_index->destination_ips.end(),
+          [&](const PolicyIndex::DestinationIpTable& table) {
+            return table.family == family &&
+                   table.prefix_len == range->prefix_len;
+          });
+      if (table == policy_index->destination_ips.end()) {
+        table = policy_index->destination_ips.insert(
+            table, PolicyIndex::DestinationIpTable{family, range->prefix_len,
+                                                   {}});
+      }
+      AddIndex(table->addresses[*key], index);
+    }
+    for (const HeaderMatcher* matcher : keys.headers) {
+      AddIndex(policy_index->exact_headers[matcher->name()]
+                                          [matcher->string_matcher()],
+               index);
+    }
+  }
+  if (policy_index->unconstrained.size() < policies_.size()) {
+    for (auto& [prefix, indices] : prefixes) {
+      policy_index->path_prefixes.AddNode(prefix, std::move(indices));
+    }
+    policy_index_ = std::move(policy_index);
   }
   for (const auto& logger_config : rbac.logger_configs) {
     auto logger = AuditLoggerRegistry::CreateAuditLogger(logger_config);
@@ -63,17 +253,23 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(const Rbac& rbac)
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     GrpcAuthorizationEngine&& other) noexcept
-    : name_(std::move(other.name_)),
+    : id_(other.id_),
+      name_(std::move(other.name_)),
       action_(other.action_),
       policies_(std::move(other.policies_)),
+      num_connection_scoped_slots_(other.num_connection_scoped_slots_),
+      policy_index_(std::move(other.policy_index_)),
       audit_condition_(other.audit_condition_),
       audit_loggers_(std::move(other.audit_loggers_)) {}
 
 GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
+  id_ = other.id_;
   name_ = std::move(other.name_);
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  num_connection_scoped_slots_ = other.num_connection_scoped_slots_;
+  policy_index_ = std::move(other.policy_index_);
   audit_condition_ = other.audit_condition_;
   audit_loggers_ = std::move(other.audit_loggers_);
   return *this;
@@ -82,15 +278,26 @@ GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
 AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
-  bool matches = false;
-  for (const auto& policy : policies_) {
-    if (policy.matcher->Matches(args)) {
-      matches = true;
-      decision.matching_policy_name = policy.name;
-      break;
+  std::optional<EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Slots>
+      slots;
+  if (num_connection_scoped_slots_ > 0) {
+    auto* results = args.GetConnectionScopedResults();
+    if (results != nullptr) slots = results->Get(id_);
+  }
+  auto* memoized = slots.has_value() ? &*slots : nullptr;
+  const Policy* policy = nullptr;
+  if (policy_index_ == nullptr) {
+    for (const auto& candidate : policies_) {
+      if (PolicyMatches(candidate, args, memoized)) {
+        policy = &candidate;
+        break;
+      }
     }
+  } else {
+    policy = FindIndexedPolicy(args, memoized);
   }
-  decision.type = (matches == (action_ == Rbac::Action::kAllow))
+  if (policy != nullptr) decision.matching_policy_name = policy->name;
+  decision.type = ((policy != nullptr) == (action_ == Rbac::Action::kAllow))
                       ? Decision::Type::kAllow
                       : Decision::Type::kDeny;
   if (ShouldLog(decision, audit_condition_)) {
@@ -103,4 +310,89 @@ AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
   return decision;
 }
 
+const GrpcAuthorizationEngine::Policy*
+GrpcAuthorizationEngine::FindIndexedPolicy(
+    const EvaluateArgs& args,
+    EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Slots* slots)
+    const {
+  // Gathers the sorted lists of candidate policies and merges them,
+  // evaluating the candidates in list order so that the first matching
+  // policy is reported, as without the index.
+  using Candidates = std::pair<const size_t*, const size_t*>;
+  absl::InlinedVector<Candidates, 8> candidates;
+  auto add_candidates = [&](const std::vector<size_t>& indices) {
+    if (!indices.empty()) {
+      candidates.emplace_back(indices.data(), indices.data() + indices.size());
+    }
+  };
+  const absl::string_view path = args.GetPath();
+  add_candidates(policy_index_->unconstrained);
+  auto it = policy_index_->exact_paths.find(path);
+  if (it != policy_index_->exact_paths.end()) add_candidates(it->second);
+  policy_index_->path_prefixes.ForEachPrefixMatch(path, add_candidates);
+  if (!policy_index_->destination_ips.empty()) {
+    const grpc_resolved_address local_address = args.GetLocalAddress();
+    const int family =
+        reinterpret_cast<const grpc_sockaddr*>(local_address.addr)->sa_family;
+    for (const auto& table : policy_index_->destination_ips) {
+      if (table.family != family) continue;
+      std::optional<std::string> key =
+          MaskedAddressKey(local_address, table.prefix_len);
+      if (!key.has_value()) continue;
+      auto address_it = table.addresses.find(*key);
+      if (address_it != table.addresses.end()) {
+        add_candidates(address_it->second);
+      }
+    }
+  }
+  for (const auto& [name, values] : policy_index_->exact_headers) {
+    std::string concatenated_value;
+    std::optional<absl::string_view> value =
+        args.GetHeaderValue(name, &concatenated_value);
+    if (!value.has_value()) continue;
+    auto value_it = values.find(*value);
+    if (value_it != values.end()) add_candidates(value_it->second);
+  }
+  // A policy with several indexed rules may be in several lists, but the
+  // merge yields its copies one after the other.
+  std::optional<size_t> last_index;
+  while (!candidates.empty()) {
+    auto next = std::min_element(
+        candidates.begin(), candidates.end(),
+        [](const Candidates& a, const Candidates& b) {
+          return *a.first < *b.first;
+        });
+    const size_t index = *next->first;
+    if (index != last_index) {
+      last_index = index;
+      const Policy& policy = policies_[index];
+      if (PolicyMatches(policy, args, slots)) return &policy;
+    }
+    if (++next->first == next->second) candidates.erase(next);
+  }
+  return nullptr;
+}
+
+bool GrpcAuthorizationEngine::PolicyMatches(
+    const Policy& policy, const EvaluateArgs& args,
+    EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Slots* slots) {
+  using Results = EvaluateArgs::PerChannelArgs::ConnectionScopedResults;
+  if (slots == nullptr || !policy.connection_scoped_slot.has_value()) {
+    return policy.permissions->Matches(args) &&
+           policy.principals->Matches(args);
+  }
+  // Concurrent calls on the connection may both compute the result, but
+  // they will store the same value.
+  const size_t slot = *policy.connection_scoped_slot;
+  Results::Result result = slots->Load(slot);
+  if (result == Results::kNoMatch) return false;
+  if (!policy.permissions->Matches(args)) return false;
+  if (result == Results::kUnknown) {
+    result = policy.principals->Matches(args) ? Results::kMatch
+                                              : Results::kNoMatch;
+    slots->Store(slot, result);
+  }
+  return result == Results::kMatch;
+}
+
 }  // namespace grpc_core
@@ -18,8 +18,10 @@
 #include <grpc/grpc_audit_logging.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -27,6 +29,8 @@
 #include "src/core/lib/security/authorization/evaluate_args.h"
 #include "src/core/lib/security/authorization/matchers.h"
 #include "src/core/lib/security/authorization/rbac_policy.h"
+#include "src/core/util/trie_lookup.h"
+#include "absl/container/flat_hash_map.h"
 
 namespace grpc_core {
 
@@ -41,8 +45,7 @@ using experimental::AuditLogger;
 class GrpcAuthorizationEngine : public AuthorizationEngine {
  public:
   // Builds GrpcAuthorizationEngine without any policies.
-  explicit GrpcAuthorizationEngine(Rbac::Action action)
-      : action_(action), audit_condition_(Rbac::AuditCondition::kNone) {}
+  explicit GrpcAuthorizationEngine(Rbac::Action action);
   // Builds GrpcAuthorizationEngine with allow/deny RBAC policy.
   explicit GrpcAuthorizationEngine(const Rbac& rbac);
 
@@ -69,12 +72,62 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
  private:
   struct Policy {
     std::string name;
-    std::unique_ptr<AuthorizationMatcher> matcher;
+    std::unique_ptr<AuthorizationMatcher> permissions;
+    std::unique_ptr<AuthorizationMatcher> principals;
+    // Set if principals depends only on the connection, in which case its
+    // result is memoized in this slot of the connection's
+    // EvaluateArgs::PerChannelArgs::ConnectionScopedResults.
+    std::optional<size_t> connection_scoped_slot;
   };
 
+  // Maps requests to the indices of the policies whose permissions can
+  // match them, as derived from the exact and prefix path rules, the
+  // destination IP rules and the exact header rules in those permissions.
+  // Policies whose permissions constrain none of these are always
+  // candidates.  Each index list is sorted.
+  struct PolicyIndex {
+    // The destination IP rules of one address family and prefix length,
+    // keyed by the masked address.
+    struct DestinationIpTable {
+      int family;
+      uint32_t prefix_len;
+      absl::flat_hash_map<std::string, std::vector<size_t>> addresses;
+    };
+
+    absl::flat_hash_map<std::string, std::vector<size_t>> exact_paths;
+    TrieLookupTree<std::vector<size_t>> path_prefixes;
+    std::vector<DestinationIpTable> destination_ips;
+    // Keyed by header name, then by value.
+    absl::flat_hash_map<std::string,
+                        absl::flat_hash_map<std::string, std::vector<size_t>>>
+        exact_headers;
+    std::vector<size_t> unconstrained;
+  };
+
+  // Returns the first policy that matches args among those that the policy
+  // index yields for it, or null if none does.
+  const Policy* FindIndexedPolicy(
+      const EvaluateArgs& args,
+      EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Slots* slots)
+      const;
+
+  // Returns true if both the permissions and the principals of policy match
+  // args.  slots may be null if no results are memoized.
+  static bool PolicyMatches(
+      const Policy& policy, const EvaluateArgs& args,
+      EvaluateArgs::PerChannelArgs::ConnectionScopedResults::Slots* slots);
+
+  // Identifies the results memoized for this engine.  Never reused, so
+  // that an engine replacing this one on a policy update does not see
+  // them.
+  uint64_t id_;
   std::string name_;
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  size_t num_connection_scoped_slots_ = 0;
+  // Unset if no policy has rules that can be indexed, in which case
+  // policies are simply evaluated in order.
+  std::unique_ptr<PolicyIndex> policy_index_;
   Rbac::AuditCondition audit_condition_;
   std::vector<std::unique_ptr<AuditLogger>> audit_loggers_;
 };
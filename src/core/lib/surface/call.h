@@ -41,6 +41,7 @@
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
+#include "src/core/service_config/service_config.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/time.h"
@@ -69,7 +70,8 @@ typedef struct grpc_call_create_args {
   std::optional<grpc_core::Slice> authority;
 
   grpc_core::Timestamp send_deadline;
-  bool registered_method;  // client_only
+  // client_only; null if the method is not registered
+  grpc_core::RegisteredMethodConfigCache* registered_method;
 
   std::optional<absl::FunctionRef<void(grpc_core::Arena*)>> arena_init_function;
 } grpc_call_create_args;
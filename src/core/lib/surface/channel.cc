@@ -114,7 +114,7 @@ grpc_call* grpc_channel_create_call(grpc_channel* channel,
           ? std::optional<grpc_core::Slice>(grpc_core::CSliceRef(*host))
           : std::nullopt,
       grpc_core::Timestamp::FromTimespecRoundUp(deadline),
-      /*registered_method=*/false,
+      /*registered_method=*/nullptr,
       /*arena_init_function=*/std::nullopt);
 }
 
@@ -151,7 +151,7 @@ grpc_call* grpc_channel_create_registered_call(
           ? std::optional<grpc_core::Slice>(rc->authority->Ref())
           : std::nullopt,
       grpc_core::Timestamp::FromTimespecRoundUp(deadline),
-      /*registered_method=*/true,
+      /*registered_method=*/&rc->config_cache,
       /*arena_init_function=*/std::nullopt);
 }
 
@@ -159,7 +159,7 @@ grpc_call* grpc_channel_create_call_with_arena_init(
     grpc_channel* channel, grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* completion_queue, grpc_core::Slice method,
     std::optional<grpc_core::Slice> authority, gpr_timespec deadline,
-    bool registered_method,
+    grpc_core::RegisteredMethodConfigCache* registered_method,
     std::optional<absl::FunctionRef<void(grpc_core::Arena*)>>
         arena_init_function) {
   grpc_core::ExecCtx exec_ctx;
@@ -39,6 +39,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/service_config/service_config.h"
 #include "src/core/util/cpp_impl_of.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -62,6 +63,8 @@ class Channel : public UnstartedCallDestination,
   struct RegisteredCall {
     Slice path;
     std::optional<Slice> authority;
+    // Carried by calls to this method to look up its method config.
+    RegisteredMethodConfigCache config_cache;
 
     explicit RegisteredCall(const char* method_arg, const char* host_arg);
     RegisteredCall(const RegisteredCall& other);
@@ -77,7 +80,7 @@ class Channel : public UnstartedCallDestination,
       grpc_call* parent_call, uint32_t propagation_mask,
       grpc_completion_queue* cq, grpc_pollset_set* pollset_set_alternative,
       Slice path, std::optional<Slice> authority, Timestamp deadline,
-      bool registered_method,
+      RegisteredMethodConfigCache* registered_method,
       std::optional<absl::FunctionRef<void(Arena*)>> arena_init_function) = 0;
 
   virtual grpc_event_engine::experimental::EventEngine* event_engine()
@@ -182,7 +185,7 @@ grpc_call* grpc_channel_create_call_with_arena_init(
     grpc_channel* channel, grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* completion_queue, grpc_core::Slice method,
     std::optional<grpc_core::Slice> authority, gpr_timespec deadline,
-    bool registered_method,
+    grpc_core::RegisteredMethodConfigCache* registered_method,
     std::optional<absl::FunctionRef<void(grpc_core::Arena*)>>
         arena_init_function);
 
@@ -21,6 +21,7 @@
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
@@ -28,6 +29,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -285,7 +287,9 @@ namespace {
 // Only used in completion queues whose completion_type is GRPC_CQ_NEXT
 class CqEventQueue {
  public:
-  CqEventQueue() = default;
+  CqEventQueue()
+      : num_shards_(std::clamp<size_t>(gpr_cpu_num_cores(), 1, kMaxShards)),
+        shards_(new Shard[num_shards_]) {}
   ~CqEventQueue() = default;
 
   // Note: The counter is not incremented/decremented atomically with push/pop.
@@ -298,10 +302,28 @@ class CqEventQueue {
   grpc_cq_completion* Pop();
 
  private:
-  // Spinlock to serialize consumers i.e pop() operations
-  gpr_spinlock queue_lock_ = GPR_SPINLOCK_INITIALIZER;
+  static constexpr size_t kMaxShards = 16;
+
+  // Completions are spread over several MPSC queues, each with its own
+  // consumer spinlock, so that threads polling the same CQ do not all
+  // serialize on one lock. Each thread pushes to and first pops from its own
+  // home shard, then steals from the others.
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    // Spinlock to serialize consumers i.e pop() operations
+    gpr_spinlock queue_lock = GPR_SPINLOCK_INITIALIZER;
+    grpc_core::MultiProducerSingleConsumerQueue queue;
+  };
+
+  // The index of the calling thread's home shard.
+  size_t HomeShard() const {
+    static std::atomic<size_t> next_thread_index{0};
+    thread_local size_t thread_index =
+        next_thread_index.fetch_add(1, std::memory_order_relaxed);
+    return thread_index % num_shards_;
+  }
 
-  grpc_core::MultiProducerSingleConsumerQueue queue_;
+  const size_t num_shards_;
+  const std::unique_ptr<Shard[]> shards_;
 
   // A lazy counter of number of items in the queue. This is NOT atomically
   // incremented/decremented along with push/pop operations and hence is only
@@ -545,18 +567,23 @@ int grpc_completion_queue_thread_local_cache_flush(grpc_completion_queue* cq,
 }
 
 bool CqEventQueue::Push(grpc_cq_completion* c) {
-  queue_.Push(
+  shards_[HomeShard()].queue.Push(
       reinterpret_cast<grpc_core::MultiProducerSingleConsumerQueue::Node*>(c));
   return num_queue_items_.fetch_add(1, std::memory_order_relaxed) == 0;
 }
 
 grpc_cq_completion* CqEventQueue::Pop() {
+  if (num_items() <= 0) return nullptr;
   grpc_cq_completion* c = nullptr;
-
-  if (gpr_spinlock_trylock(&queue_lock_)) {
-    bool is_empty = false;
-    c = reinterpret_cast<grpc_cq_completion*>(queue_.PopAndCheckEnd(&is_empty));
-    gpr_spinlock_unlock(&queue_lock_);
+  const size_t home = HomeShard();
+  for (size_t i = 0; c == nullptr && i < num_shards_; ++i) {
+    Shard& shard = shards_[(home + i) % num_shards_];
+    if (gpr_spinlock_trylock(&shard.queue_lock)) {
+      bool is_empty = false;
+      c = reinterpret_cast<grpc_cq_completion*>(
+          shard.queue.PopAndCheckEnd(&is_empty));
+      gpr_spinlock_unlock(&shard.queue_lock);
+    }
   }
 
   if (c) {
@@ -133,17 +133,16 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
       call->send_initial_metadata_.Set(HttpAuthorityMetadata(),
                                        std::move(*args->authority));
     }
-    call->send_initial_metadata_.Set(
-        GrpcRegisteredMethod(), reinterpret_cast<void*>(static_cast<uintptr_t>(
-                                    args->registered_method)));
+    call->send_initial_metadata_.Set(GrpcRegisteredMethod(),
+                                     args->registered_method);
     if (parent != nullptr) {
       add_init_error(&error, call->InitParent(parent, args->propagation_mask));
     }
     // Client call tracers should be created after propagating relevant
     // properties (tracing included) from the parent.
     (*channel_stack->stats_plugin_group)
-        ->AddClientCallTracers(Slice(CSliceRef(path)), args->registered_method,
-                               arena.get());
+        ->AddClientCallTracers(Slice(CSliceRef(path)),
+                               args->registered_method != nullptr, arena.get());
   } else {
     global_stats().IncrementServerCallsCreated();
     call->final_op_.server.cancelled = nullptr;
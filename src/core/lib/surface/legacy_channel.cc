@@ -164,7 +164,7 @@ grpc_call* LegacyChannel::CreateCall(
     grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* pollset_set_alternative,
     Slice path, std::optional<Slice> authority, Timestamp deadline,
-    bool registered_method,
+    RegisteredMethodConfigCache* registered_method,
     std::optional<absl::FunctionRef<void(Arena*)>> arena_init_function) {
   GRPC_CHECK(is_client_);
   GRPC_CHECK(!(cq != nullptr && pollset_set_alternative != nullptr));
@@ -36,6 +36,7 @@
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/service_config/service_config.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/time.h"
@@ -62,7 +63,7 @@ class LegacyChannel final : public Channel {
                         grpc_completion_queue* cq,
                         grpc_pollset_set* pollset_set_alternative, Slice path,
                         std::optional<Slice> authority, Timestamp deadline,
-                        bool registered_method,
+                        RegisteredMethodConfigCache* registered_method,
                         std::optional<absl::FunctionRef<void(Arena*)>>
                             arena_init_function) override;
 
@@ -876,11 +876,14 @@ GrpcLb::BalancerCallState::BalancerCallState(
       grpclb_policy()->lb_call_timeout_ == Duration::Zero()
           ? Timestamp::InfFuture()
           : Timestamp::Now() + grpclb_policy()->lb_call_timeout_;
-  lb_call_ = grpclb_policy()->lb_channel_->CreateCall(
+  const char* method = "/grpc.lb.v1.LoadBalancer/BalanceLoad";
+  Channel* lb_channel = grpclb_policy()->lb_channel_.get();
+  lb_call_ = lb_channel->CreateCall(
       /*parent_call=*/nullptr, GRPC_PROPAGATE_DEFAULTS,
       /*cq=*/nullptr, grpclb_policy_->interested_parties(),
-      Slice::FromStaticString("/grpc.lb.v1.LoadBalancer/BalanceLoad"),
-      /*authority=*/std::nullopt, deadline, /*registered_method=*/true,
+      Slice::FromStaticString(method), /*authority=*/std::nullopt, deadline,
+      /*registered_method=*/
+      &lb_channel->RegisterCall(method, /*host=*/nullptr)->config_cache,
       /*arena_init_function=*/std::nullopt);
   // Init the LB call request payload.
   upb::Arena arena;
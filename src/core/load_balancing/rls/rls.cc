@@ -1692,11 +1692,14 @@ void RlsLb::RlsRequest::StartCallLocked() {
   deadline_ = now + lb_policy_->config_->lookup_service_timeout();
   grpc_metadata_array_init(&recv_initial_metadata_);
   grpc_metadata_array_init(&recv_trailing_metadata_);
-  call_ = rls_channel_->channel()->CreateCall(
+  Channel* channel = rls_channel_->channel();
+  call_ = channel->CreateCall(
       /*parent_call=*/nullptr, GRPC_PROPAGATE_DEFAULTS, /*cq=*/nullptr,
       lb_policy_->interested_parties(),
       Slice::FromStaticString(kRlsRequestPath), /*authority=*/std::nullopt,
-      deadline_, /*registered_method=*/true,
+      deadline_,
+      /*registered_method=*/
+      &channel->RegisterCall(kRlsRequestPath, /*host=*/nullptr)->config_cache,
       /*arena_init_function=*/std::nullopt);
   grpc_op ops[6];
   memset(ops, 0, sizeof(ops));
@@ -30,6 +30,7 @@
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/caching_dns_resolver.h"
 #include "src/core/lib/event_engine/resolved_address_internal.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/load_balancing/grpclb/grpclb_balancer_addresses.h"
@@ -159,6 +160,8 @@ class ClientChannelDNSResolver final : public PollingResolver {
   const bool enable_srv_queries_;
   // timeout in milliseconds for active DNS queries
   EventEngine::Duration query_timeout_ms_;
+  // lookups go through the shared DNS cache if cache_options_.ttl is positive
+  const grpc_event_engine::experimental::DNSCacheOptions cache_options_;
   std::shared_ptr<EventEngine> event_engine_;
 };
 
@@ -185,9 +188,29 @@ ClientChannelDNSResolver::ClientChannelDNSResolver(
           std::max(0, channel_args()
                           .GetInt(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
                           .value_or(GRPC_DNS_DEFAULT_QUERY_TIMEOUT_MS)))),
+      cache_options_{
+          Duration::Milliseconds(std::max(
+              0, channel_args().GetInt(GRPC_ARG_DNS_CACHE_TTL_MS).value_or(0))),
+          Duration::Milliseconds(std::max(
+              0, channel_args()
+                     .GetInt(GRPC_ARG_DNS_CACHE_NEGATIVE_TTL_MS)
+                     .value_or(0))),
+          Duration::Milliseconds(std::max(
+              0, channel_args()
+                     .GetInt(GRPC_ARG_DNS_CACHE_STALE_TTL_MS)
+                     .value_or(0)))},
       event_engine_(channel_args().GetObjectRef<EventEngine>()) {}
 
 OrphanablePtr<Orphanable> ClientChannelDNSResolver::StartRequest() {
+  if (cache_options_.ttl > Duration::Zero()) {
+    return MakeOrphanable<EventEngineDNSRequestWrapper>(
+        RefAsSubclass<ClientChannelDNSResolver>(DEBUG_LOCATION,
+                                                "dns-resolving"),
+        std::make_unique<grpc_event_engine::experimental::CachingDNSResolver>(
+            event_engine_, EventEngine::DNSResolver::ResolverOptions{
+                               /*dns_server=*/authority()},
+            cache_options_));
+  }
   auto dns_resolver =
       event_engine_->GetDNSResolver({/*dns_server=*/authority()});
   if (!dns_resolver.ok()) {
@@ -236,6 +236,7 @@ class XdsResolver final : public Resolver {
 
     std::map<absl::string_view, RefCountedPtr<ClusterRef>> clusters_;
     std::vector<RouteEntry> routes_;
+    XdsRouting::RouteTable route_table_;
   };
 
   class XdsConfigSelector final : public ConfigSelector {
@@ -429,14 +430,14 @@ XdsResolver::RouteConfigData::Create(
       return status;
     }
   }
+  data->route_table_ = XdsRouting::RouteTable(RouteListIterator(data.get()));
   return data;
 }
 
 XdsResolver::RouteConfigData::RouteEntry*
 XdsResolver::RouteConfigData::GetRouteForRequest(
     absl::string_view path, grpc_metadata_batch* initial_metadata) {
-  auto route_index = XdsRouting::GetRouteForRequest(RouteListIterator(this),
-                                                    path, initial_metadata);
+  auto route_index = route_table_.GetRouteForRequest(path, initial_metadata);
   if (!route_index.has_value()) {
     return nullptr;
   }
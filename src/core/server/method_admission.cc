@@ -0,0 +1,212 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/server/method_admission.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "src/core/telemetry/metrics.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/validation_errors.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+
+ServerMethodAdmissionDomain::UpDownCounterHandle
+    ServerMethodAdmissionDomain::kInFlightCalls =
+        ServerMethodAdmissionDomain::RegisterUpDownCounter(
+            "grpc.server.method.in_flight_calls",
+            "EXPERIMENTAL.  Number of calls to the method admitted by the "
+            "server and not yet complete.",
+            "{call}");
+
+ServerMethodAdmissionDomain::CounterHandle
+    ServerMethodAdmissionDomain::kRejectedCalls =
+        ServerMethodAdmissionDomain::RegisterCounter(
+            "grpc.server.method.rejected_calls",
+            "EXPERIMENTAL.  Number of calls to the method rejected because it "
+            "was at its concurrency limit.",
+            "{call}");
+
+namespace {
+
+struct MethodAdmissionConfigJson {
+  struct MethodConfig {
+    struct Name {
+      std::optional<std::string> service;
+      std::optional<std::string> method;
+
+      static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+        static const auto* loader =
+            JsonObjectLoader<Name>()
+                .OptionalField("service", &Name::service)
+                .OptionalField("method", &Name::method)
+                .Finish();
+        return loader;
+      }
+
+      void JsonPostLoad(const JsonArgs&, ValidationErrors* errors) {
+        if (!service.has_value() && method.has_value()) {
+          errors->AddError("method name populated without service name");
+        }
+      }
+
+      std::string Path() const {
+        if (!service.has_value() || service->empty()) return "";
+        return absl::StrCat("/", *service, "/",
+                            method.has_value() ? *method : "");
+      }
+    };
+
+    std::vector<Name> names;
+    uint32_t max_concurrent_calls = 0;
+    std::string priority = "DEFAULT";
+    MethodAdmissionConfig::Entry entry;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader =
+          JsonObjectLoader<MethodConfig>()
+              .OptionalField("name", &MethodConfig::names)
+              .OptionalField("maxConcurrentCalls",
+                             &MethodConfig::max_concurrent_calls)
+              .OptionalField("priority", &MethodConfig::priority)
+              .Finish();
+      return loader;
+    }
+
+    void JsonPostLoad(const JsonArgs&, ValidationErrors* errors) {
+      entry.max_concurrent_calls = max_concurrent_calls;
+      if (priority == "CRITICAL") {
+        entry.priority = MethodPriority::kCritical;
+      } else if (priority == "DEFAULT") {
+        entry.priority = MethodPriority::kDefault;
+      } else if (priority == "SHEDDABLE") {
+        entry.priority = MethodPriority::kSheddable;
+      } else {
+        ValidationErrors::ScopedField field(errors, ".priority");
+        errors->AddError("must be one of CRITICAL, DEFAULT or SHEDDABLE");
+      }
+    }
+  };
+
+  std::vector<MethodConfig> method_configs;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<MethodAdmissionConfigJson>()
+            .OptionalField("methodConfig",
+                           &MethodAdmissionConfigJson::method_configs)
+            .Finish();
+    return loader;
+  }
+};
+
+}  // namespace
+
+absl::StatusOr<MethodAdmissionConfig> MethodAdmissionConfig::Parse(
+    absl::string_view json_string) {
+  ValidationErrors errors;
+  auto parsed = LoadFromJsonString<MethodAdmissionConfigJson>(
+      json_string, JsonArgs(), &errors);
+  if (!parsed.ok()) return parsed.status();
+  MethodAdmissionConfig config;
+  for (size_t i = 0; i < parsed->method_configs.size(); ++i) {
+    const auto& method_config = parsed->method_configs[i];
+    ValidationErrors::ScopedField field(
+        &errors, absl::StrCat(".methodConfig[", i, "]"));
+    if (method_config.names.empty()) {
+      if (!config.entries_.emplace("", method_config.entry).second) {
+        errors.AddError("duplicate default entry");
+      }
+      continue;
+    }
+    for (size_t j = 0; j < method_config.names.size(); ++j) {
+      if (!config.entries_
+               .emplace(method_config.names[j].Path(), method_config.entry)
+               .second) {
+        ValidationErrors::ScopedField name_field(
+            &errors, absl::StrCat(".name[", j, "]"));
+        errors.AddError("multiple entries for the same method");
+      }
+    }
+  }
+  if (!errors.ok()) {
+    return errors.status(absl::StatusCode::kInvalidArgument,
+                         "errors validating method admission config");
+  }
+  return config;
+}
+
+const MethodAdmissionConfig::Entry* MethodAdmissionConfig::Lookup(
+    absl::string_view path) const {
+  auto it = entries_.find(path);
+  if (it != entries_.end()) return &it->second;
+  // Fall back to the service-wide entry ("/service/method" -> "/service/").
+  size_t sep = path.rfind('/');
+  if (sep != absl::string_view::npos && sep > 0) {
+    it = entries_.find(path.substr(0, sep + 1));
+    if (it != entries_.end()) return &it->second;
+  }
+  it = entries_.find("");
+  if (it != entries_.end()) return &it->second;
+  return nullptr;
+}
+
+MethodAdmission::MethodAdmission(absl::string_view path,
+                                 const MethodAdmissionConfig::Entry& entry,
+                                 const ChannelArgs& args)
+    : max_concurrent_calls_(entry.max_concurrent_calls),
+      priority_(entry.priority) {
+  auto* stats_plugin_group =
+      args.GetObject<GlobalStatsPluginRegistry::StatsPluginGroup>();
+  if (stats_plugin_group != nullptr) {
+    metrics_storage_ = ServerMethodAdmissionDomain::GetStorage(
+        stats_plugin_group->GetCollectionScope(), path);
+  }
+}
+
+bool MethodAdmission::TryAdmit() {
+  uint32_t in_flight = in_flight_.load(std::memory_order_relaxed);
+  do {
+    if (max_concurrent_calls_ != 0 && in_flight >= max_concurrent_calls_) {
+      if (metrics_storage_ != nullptr) {
+        metrics_storage_->Increment(
+            ServerMethodAdmissionDomain::kRejectedCalls);
+      }
+      return false;
+    }
+  } while (!in_flight_.compare_exchange_weak(in_flight, in_flight + 1,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_relaxed));
+  if (metrics_storage_ != nullptr) {
+    metrics_storage_->Increment(ServerMethodAdmissionDomain::kInFlightCalls);
+  }
+  return true;
+}
+
+void MethodAdmission::Release() {
+  in_flight_.fetch_sub(1, std::memory_order_acq_rel);
+  if (metrics_storage_ != nullptr) {
+    metrics_storage_->Decrement(ServerMethodAdmissionDomain::kInFlightCalls);
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,115 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_SERVER_METHOD_ADMISSION_H
+#define GRPC_SRC_CORE_SERVER_METHOD_ADMISSION_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+class ServerMethodAdmissionDomain final
+    : public InstrumentDomain<ServerMethodAdmissionDomain> {
+ public:
+  using Backend = LowContentionBackend;
+  static constexpr absl::string_view kName = "server_method_admission";
+  GRPC_INSTRUMENT_DOMAIN_LABELS("grpc.method");
+
+  static UpDownCounterHandle kInFlightCalls;
+  static CounterHandle kRejectedCalls;
+};
+
+// Priority class of a method, deciding how its calls fare when the server
+// is overloaded.
+enum class MethodPriority {
+  // Never shed from the pending queue (e.g. health checks, control plane).
+  kCritical,
+  // Subject to the server's usual overload shedding.
+  kDefault,
+  // Rejected as soon as the pending queue reaches its soft limit, so that
+  // expensive batch work is shed before anything else.
+  kSheddable,
+};
+
+// Per-method admission settings, parsed from the JSON in
+// GRPC_ARG_SERVER_METHOD_ADMISSION_CONFIG.  Methods are named as in service
+// config method configs:
+//
+//   {"methodConfig": [{
+//     "name": [{"service": "pkg.Service", "method": "Method"}],
+//     "maxConcurrentCalls": 200,
+//     "priority": "CRITICAL" | "DEFAULT" | "SHEDDABLE"
+//   }]}
+//
+// An entry without a method applies to every method of the service, and one
+// without a name to every method of the server.
+class MethodAdmissionConfig {
+ public:
+  struct Entry {
+    // 0 means unlimited.
+    uint32_t max_concurrent_calls = 0;
+    MethodPriority priority = MethodPriority::kDefault;
+  };
+
+  static absl::StatusOr<MethodAdmissionConfig> Parse(
+      absl::string_view json_string);
+
+  // Returns the settings for the method with the given :path
+  // ("/pkg.Service/Method"), or nullptr if none apply.
+  const Entry* Lookup(absl::string_view path) const;
+
+ private:
+  // Keyed by "/service/method", "/service/" or "" (the server default).
+  absl::flat_hash_map<std::string, Entry> entries_;
+};
+
+// Enforces a method's admission settings on calls as they are matched.
+// Thread safe.
+class MethodAdmission final : public RefCounted<MethodAdmission> {
+ public:
+  MethodAdmission(absl::string_view path,
+                  const MethodAdmissionConfig::Entry& entry,
+                  const ChannelArgs& args);
+
+  MethodPriority priority() const { return priority_; }
+
+  // Admits a new call, returning false if the method is at its concurrency
+  // limit.  Each admitted call must be released exactly once.
+  bool TryAdmit();
+  void Release();
+
+ private:
+  const uint32_t max_concurrent_calls_;
+  const MethodPriority priority_;
+  std::atomic<uint32_t> in_flight_{0};
+  InstrumentStorageRefPtr<ServerMethodAdmissionDomain> metrics_storage_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_SERVER_METHOD_ADMISSION_H
@@ -30,11 +30,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
 #include <list>
 #include <memory>
 #include <new>
 #include <optional>
-#include <queue>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -72,8 +72,10 @@
 #include "src/core/lib/surface/legacy_channel.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
+#include "src/core/server/server_metrics.h"
 #include "src/core/telemetry/metrics.h"
 #include "src/core/telemetry/stats.h"
+#include "src/core/util/controlled_delay.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/grpc_check.h"
@@ -81,6 +83,7 @@
 #include "src/core/util/orphanable.h"
 #include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/status_helper.h"
+#include "src/core/util/time_precise.h"
 #include "src/core/util/useful.h"
 #include "absl/cleanup/cleanup.h"
 #include "absl/container/flat_hash_map.h"
@@ -461,6 +464,9 @@ struct Server::RegisteredMethod {
   const uint32_t flags;
   // One request matcher per method.
   std::unique_ptr<RequestMatcherInterface> matcher;
+  // Concurrency limit for the method, if one is configured; see
+  // GRPC_ARG_SERVER_METHOD_ADMISSION_CONFIG.
+  RefCountedPtr<MethodAdmission> admission;
 };
 
 //
@@ -553,8 +559,29 @@ struct Server::RequestedCall {
 // pending list if they aren't able to be matched to an application request.
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
-  explicit RealRequestMatcher(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+  explicit RealRequestMatcher(
+      Server* server, MethodPriority priority = MethodPriority::kDefault)
+      : server_(server),
+        priority_(priority),
+        codel_(MakeControlledDelay(server->channel_args())),
+        codel_shedding_(
+            priority != MethodPriority::kCritical &&
+            server->channel_args()
+                    .GetInt(GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_TARGET_MS)
+                    .value_or(0) > 0),
+        adaptive_lifo_(
+            server->channel_args()
+                .GetBool(GRPC_ARG_SERVER_PENDING_QUEUE_ADAPTIVE_LIFO)
+                .value_or(false)),
+        requests_per_cq_(server->cqs_.size()) {
+    auto* stats_plugin_group =
+        server->channel_args()
+            .GetObject<GlobalStatsPluginRegistry::StatsPluginGroup>();
+    if (codel_.has_value() && stats_plugin_group != nullptr) {
+      metrics_storage_ = ServerPendingRequestsDomain::GetStorage(
+          stats_plugin_group->GetCollectionScope());
+    }
+  }
 
   ~RealRequestMatcher() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
@@ -569,11 +596,11 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       pending_filter_stack_.front().calld->SetState(
           CallData::CallState::ZOMBIED);
       pending_filter_stack_.front().calld->KillZombie();
-      pending_filter_stack_.pop();
+      pending_filter_stack_.pop_front();
     }
     while (!pending_promises_.empty()) {
       pending_promises_.front()->Finish(absl::InternalError("Server closed"));
-      pending_promises_.pop();
+      pending_promises_.pop_front();
     }
     zombified_ = true;
   }
@@ -605,6 +632,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       while (true) {
         NextPendingCall pending_call;
         {
+          ShedCalls shed;
           MutexLock lock(&server_->mu_call_);
           while (!pending_filter_stack_.empty() &&
                  pending_filter_stack_.front().Age() >
@@ -612,23 +640,21 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
             pending_filter_stack_.front().calld->SetState(
                 CallData::CallState::ZOMBIED);
             pending_filter_stack_.front().calld->KillZombie();
-            pending_filter_stack_.pop();
+            pending_filter_stack_.pop_front();
           }
+          ShedOverloadedLocked(shed);
           if (!pending_promises_.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
             if (pending_call.rc != nullptr) {
-              pending_call.pending_promise =
-                  std::move(pending_promises_.front());
-              pending_promises_.pop();
+              pending_call.pending_promise = TakeNextLocked(pending_promises_);
             }
           } else if (!pending_filter_stack_.empty()) {
             pending_call.rc = reinterpret_cast<RequestedCall*>(
                 requests_per_cq_[request_queue_index].Pop());
             if (pending_call.rc != nullptr) {
               pending_call.pending_filter_stack =
-                  pending_filter_stack_.front().calld;
-              pending_filter_stack_.pop();
+                  TakeNextLocked(pending_filter_stack_).calld;
             }
           }
         }
@@ -675,6 +701,7 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     size_t cq_idx = 0;
     size_t loop_count;
     {
+      ShedCalls shed;
       MutexLock lock(&server_->mu_call_);
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
@@ -686,13 +713,18 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       }
       if (rc == nullptr) {
         if (IsOptimization04Enabled() &&
-            server_->pending_backlog_protector_.Reject(
-                pending_filter_stack_.size(), SharedBitGen())) {
+            RejectPendingLocked(pending_filter_stack_.size())) {
           calld->FailCallCreation();
           return;
         }
+        if (codel_.has_value()) {
+          if (pending_filter_stack_.empty()) {
+            codel_->OnQueueEmpty(Timestamp::Now());
+          }
+          ShedOverloadedLocked(shed);
+        }
         calld->SetState(CallData::CallState::PENDING);
-        pending_filter_stack_.push(PendingCallFilterStack{calld});
+        pending_filter_stack_.push_back(PendingCallFilterStack{calld});
         return;
       }
     }
@@ -720,12 +752,13 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     size_t loop_count;
     {
       std::vector<std::shared_ptr<ActivityWaiter>> removed_pending;
+      ShedCalls shed;
       MutexLock lock(&server_->mu_call_);
       while (!pending_promises_.empty() &&
              pending_promises_.front()->Age() >
                  server_->max_time_in_pending_queue_) {
         removed_pending.push_back(std::move(pending_promises_.front()));
-        pending_promises_.pop();
+        pending_promises_.pop_front();
       }
       for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
         cq_idx =
@@ -734,17 +767,22 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         if (rc != nullptr) break;
       }
       if (rc == nullptr) {
-        if (server_->pending_backlog_protector_.Reject(pending_promises_.size(),
-                                                       SharedBitGen())) {
+        if (RejectPendingLocked(pending_promises_.size())) {
           return Immediate(absl::ResourceExhaustedError(
               "Too many pending requests for this server"));
         }
         if (zombified_) {
           return Immediate(absl::InternalError("Server closed"));
         }
+        if (codel_.has_value()) {
+          if (pending_promises_.empty()) {
+            codel_->OnQueueEmpty(Timestamp::Now());
+          }
+          ShedOverloadedLocked(shed);
+        }
         auto w = std::make_shared<ActivityWaiter>(
             GetContext<Activity>()->MakeOwningWaker());
-        pending_promises_.push(w);
+        pending_promises_.push_back(w);
         return OnCancel(
             [w]() -> Poll<absl::StatusOr<MatchResult>> {
               std::unique_ptr<absl::StatusOr<MatchResult>> r(
@@ -765,6 +803,9 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   struct PendingCallFilterStack {
     CallData* calld;
     Timestamp created = Timestamp::Now();
+    // Timestamp only has millisecond resolution; the sojourn time metric
+    // is measured with the cycle counter instead.
+    gpr_cycle_counter created_cycles = gpr_get_cycle_counter();
     Duration Age() { return Timestamp::Now() - created; }
   };
   struct ActivityWaiter {
@@ -802,10 +843,142 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     Waker waker;
     std::atomic<ResultType*> result{nullptr};
     const Timestamp created = Timestamp::Now();
+    const gpr_cycle_counter created_cycles = gpr_get_cycle_counter();
   };
   using PendingCallPromises = std::shared_ptr<ActivityWaiter>;
-  std::queue<PendingCallFilterStack> pending_filter_stack_;
-  std::queue<PendingCallPromises> pending_promises_;
+
+  // Returns the overload detector for the pending queues, if either CoDel
+  // shedding or adaptive LIFO is configured.
+  static std::optional<ControlledDelay> MakeControlledDelay(
+      const ChannelArgs& args) {
+    const int target_ms =
+        args.GetInt(GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_TARGET_MS).value_or(0);
+    if (target_ms <= 0 &&
+        !args.GetBool(GRPC_ARG_SERVER_PENDING_QUEUE_ADAPTIVE_LIFO)
+             .value_or(false)) {
+      return std::nullopt;
+    }
+    const int interval_ms =
+        args.GetInt(GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_INTERVAL_MS)
+            .value_or(100);
+    return ControlledDelay(
+        Duration::Milliseconds(target_ms > 0 ? target_ms : 5),
+        Duration::Milliseconds(std::max(1, interval_ms)));
+  }
+
+  static Duration AgeOf(PendingCallFilterStack& pending) {
+    return pending.Age();
+  }
+  static Duration AgeOf(const PendingCallPromises& pending) {
+    return pending->Age();
+  }
+  static gpr_cycle_counter CreatedCyclesOf(
+      const PendingCallFilterStack& pending) {
+    return pending.created_cycles;
+  }
+  static gpr_cycle_counter CreatedCyclesOf(const PendingCallPromises& pending) {
+    return pending->created_cycles;
+  }
+
+  // Removes and returns the next request to serve from `queue`: the oldest
+  // one normally, or the newest one while overloaded in adaptive LIFO mode.
+  // Requires server_->mu_call_.
+  template <typename T>
+  T TakeNextLocked(std::deque<T>& queue) {
+    const bool lifo =
+        adaptive_lifo_ && codel_.has_value() && codel_->overloaded();
+    T next = std::move(lifo ? queue.back() : queue.front());
+    if (lifo) {
+      queue.pop_back();
+    } else {
+      queue.pop_front();
+    }
+    if (codel_.has_value()) {
+      const Duration sojourn = AgeOf(next);
+      codel_->OnDequeue(sojourn, Timestamp::Now());
+      if (metrics_storage_ != nullptr) {
+        const gpr_timespec precise_sojourn = gpr_cycle_counter_sub(
+            gpr_get_cycle_counter(), CreatedCyclesOf(next));
+        metrics_storage_->Increment(
+            ServerPendingRequestsDomain::kSojournTime,
+            precise_sojourn.tv_sec * GPR_US_PER_SEC +
+                precise_sojourn.tv_nsec / GPR_NS_PER_US);
+      }
+    }
+    return next;
+  }
+
+  // Decides whether a call that found no requested call waiting may join a
+  // pending queue of the given size, according to the method's priority.
+  bool RejectPendingLocked(size_t pending_size)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(server_->mu_call_) {
+    RandomEarlyDetection& protector = server_->pending_backlog_protector_;
+    switch (priority_) {
+      case MethodPriority::kCritical:
+        return protector.MustReject(pending_size);
+      case MethodPriority::kSheddable:
+        return pending_size >= protector.soft_limit();
+      case MethodPriority::kDefault:
+        break;
+    }
+    return protector.Reject(pending_size, SharedBitGen());
+  }
+
+  // Filter-stack calls shed from the pending queue.  They are cancelled when
+  // this is destroyed, which must be after server_->mu_call_ is released.
+  class ShedCalls {
+   public:
+    ShedCalls() = default;
+    ShedCalls(const ShedCalls&) = delete;
+    ShedCalls& operator=(const ShedCalls&) = delete;
+    ~ShedCalls() {
+      for (CallData* calld : calls_) {
+        calld->Shed(absl::ResourceExhaustedError(
+            "Server overloaded: request shed from pending queue"));
+      }
+    }
+
+    void Add(CallData* calld) { calls_.push_back(calld); }
+
+   private:
+    std::vector<CallData*> calls_;
+  };
+
+  // While overloaded, drops requests from the head of the pending queues that
+  // have waited longer than the CoDel shed threshold.  Requires
+  // server_->mu_call_.
+  void ShedOverloadedLocked(ShedCalls& shed) {
+    if (!codel_shedding_) return;
+    while (!pending_filter_stack_.empty() &&
+           codel_->ShouldShed(pending_filter_stack_.front().Age())) {
+      shed.Add(pending_filter_stack_.front().calld);
+      pending_filter_stack_.pop_front();
+      if (metrics_storage_ != nullptr) {
+        metrics_storage_->Increment(ServerPendingRequestsDomain::kShed);
+      }
+    }
+    while (!pending_promises_.empty() &&
+           codel_->ShouldShed(pending_promises_.front()->Age())) {
+      pending_promises_.front()->Finish(absl::ResourceExhaustedError(
+          "Server overloaded: request shed from pending queue"));
+      pending_promises_.pop_front();
+      if (metrics_storage_ != nullptr) {
+        metrics_storage_->Increment(ServerPendingRequestsDomain::kShed);
+      }
+    }
+  }
+
+  const MethodPriority priority_;
+  std::deque<PendingCallFilterStack> pending_filter_stack_;
+  std::deque<PendingCallPromises> pending_promises_;
+  // Overload detection for the pending queues; see
+  // GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_TARGET_MS and
+  // GRPC_ARG_SERVER_PENDING_QUEUE_ADAPTIVE_LIFO.  Guarded by
+  // server_->mu_call_.
+  std::optional<ControlledDelay> codel_;
+  const bool codel_shedding_;
+  const bool adaptive_lifo_;
+  InstrumentStorageRefPtr<ServerPendingRequestsDomain> metrics_storage_;
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
   bool zombified_ = false;
 };
@@ -1131,6 +1304,27 @@ auto Server::MatchAndPublishCall(CallHandler call_handler) {
         call_handler.UntilCallCompletes(TrySeq(
             // Wait for initial metadata to pass through all filters
             Map(call_handler.PullClientInitialMetadata(), CheckClientMetadata),
+            // Apply the method's concurrency limit, if it has one
+            [call_handler](ClientMetadataHandle md) mutable
+                -> absl::StatusOr<ClientMetadataHandle> {
+              auto* registered_method = static_cast<RegisteredMethod*>(
+                  md->get(GrpcRegisteredMethod()).value_or(nullptr));
+              if (registered_method == nullptr ||
+                  registered_method->admission == nullptr) {
+                return std::move(md);
+              }
+              RefCountedPtr<MethodAdmission> admission =
+                  registered_method->admission;
+              if (!admission->TryAdmit()) {
+                return absl::ResourceExhaustedError(
+                    "Too many concurrent calls to this method");
+              }
+              if (!call_handler.OnDone(
+                      [admission](bool) { admission->Release(); })) {
+                admission->Release();
+              }
+              return std::move(md);
+            },
             // Match request with requested call
             [this, call_handler](ClientMetadataHandle md) mutable {
               return MatchRequestAndMaybeReadFirstMessage(
@@ -1273,9 +1467,31 @@ void Server::Start() {
   if (unregistered_request_matcher_ == nullptr) {
     unregistered_request_matcher_ = std::make_unique<RealRequestMatcher>(this);
   }
+  std::optional<MethodAdmissionConfig> admission_config;
+  if (auto json = channel_args_.GetString(
+          GRPC_ARG_SERVER_METHOD_ADMISSION_CONFIG);
+      json.has_value()) {
+    auto config = MethodAdmissionConfig::Parse(*json);
+    if (config.ok()) {
+      admission_config = std::move(*config);
+    } else {
+      LOG(ERROR) << "Ignoring invalid method admission config: "
+                 << config.status();
+    }
+  }
   for (auto& rm : registered_methods_) {
+    MethodPriority priority = MethodPriority::kDefault;
+    if (admission_config.has_value()) {
+      const MethodAdmissionConfig::Entry* entry =
+          admission_config->Lookup(rm.second->method);
+      if (entry != nullptr) {
+        rm.second->admission = MakeRefCounted<MethodAdmission>(
+            rm.second->method, *entry, channel_args_);
+        priority = entry->priority;
+      }
+    }
     if (rm.second->matcher == nullptr) {
-      rm.second->matcher = std::make_unique<RealRequestMatcher>(this);
+      rm.second->matcher = std::make_unique<RealRequestMatcher>(this, priority);
     }
   }
   {
@@ -1906,6 +2122,7 @@ Server::CallData::~CallData() {
   GRPC_CHECK(state_.load(std::memory_order_relaxed) != CallState::PENDING);
   grpc_metadata_array_destroy(&initial_metadata_);
   grpc_byte_buffer_destroy(payload_);
+  if (admission_ != nullptr) admission_->Release();
 
   if (server_ != nullptr) {
     // TODO(snohria): Add the same for Call-V3 as well.
@@ -1924,6 +2141,14 @@ bool Server::CallData::MaybeActivate() {
                                         std::memory_order_relaxed);
 }
 
+void Server::CallData::Shed(absl::Status status) {
+  // Give the client an explicit status, as for calls rejected by admission,
+  // before destroying the call.
+  Call::FromC(call_)->CancelWithError(std::move(status));
+  state_.store(CallState::ZOMBIED, std::memory_order_relaxed);
+  KillZombie();
+}
+
 void Server::CallData::FailCallCreation() {
   CallState expected_not_started = CallState::NOT_STARTED;
   CallState expected_pending = CallState::PENDING;
@@ -2024,6 +2249,17 @@ void Server::CallData::StartNewRpc(grpc_call_element* elem) {
     RegisteredMethod* rm = static_cast<RegisteredMethod*>(
         recv_initial_metadata_->get(GrpcRegisteredMethod()).value_or(nullptr));
     if (rm != nullptr) {
+      if (rm->admission != nullptr) {
+        if (!rm->admission->TryAdmit()) {
+          // Give the client an explicit status, as the promise-based path
+          // does, rather than the bare cancellation of a failed call.
+          Call::FromC(call_)->CancelWithError(absl::ResourceExhaustedError(
+              "Too many concurrent calls to this method"));
+          FailCallCreation();
+          return;
+        }
+        admission_ = rm->admission;
+      }
       matcher_ = rm->matcher.get();
       payload_handling = rm->payload_handling;
     }
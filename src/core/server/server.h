@@ -56,6 +56,7 @@
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/server/method_admission.h"
 #include "src/core/server/server_interface.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/cpp_impl_of.h"
@@ -70,6 +71,7 @@
 #include "absl/container/flat_hash_set.h"
 #include "absl/hash/hash.h"
 #include "absl/random/random.h"
+#include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
@@ -506,6 +508,10 @@ class Server : public ServerInterface,
 
     void KillZombie();
 
+    // Cancels a call removed from a pending queue with the given status,
+    // and destroys it.
+    void Shed(absl::Status status);
+
     void FailCallCreation();
 
     // Filter vtable functions.
@@ -543,6 +549,9 @@ class Server : public ServerInterface,
     grpc_completion_queue* cq_new_ = nullptr;
 
     RequestMatcherInterface* matcher_ = nullptr;
+    // Set if the call was admitted against its method's concurrency limit;
+    // released when the call is destroyed.
+    RefCountedPtr<MethodAdmission> admission_;
     grpc_byte_buffer* payload_ = nullptr;
 
     grpc_closure kill_zombie_closure_;
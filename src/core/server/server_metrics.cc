@@ -0,0 +1,40 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/server/server_metrics.h"
+
+#include "src/core/telemetry/instrument.h"
+
+namespace grpc_core {
+
+ServerPendingRequestsDomain::CounterHandle ServerPendingRequestsDomain::kShed =
+    ServerPendingRequestsDomain::RegisterCounter(
+        "grpc.server.pending_requests.shed",
+        "EXPERIMENTAL.  Number of requests dropped from the server's pending "
+        "queue because it was overloaded.",
+        "{request}");
+
+ServerPendingRequestsDomain::HistogramHandle<ExponentialHistogramShape>
+    ServerPendingRequestsDomain::kSojournTime =
+        ServerPendingRequestsDomain::RegisterHistogram<
+            ExponentialHistogramShape>(
+            "grpc.server.pending_requests.sojourn_time",
+            "EXPERIMENTAL.  Time requests spent in the server's pending queue "
+            "before being matched to an application request, in "
+            "microseconds.",
+            "{us}", 1 << 24, 100);  // Max bucket is 16 seconds.
+
+}  // namespace grpc_core
@@ -0,0 +1,39 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_SERVER_SERVER_METRICS_H
+#define GRPC_SRC_CORE_SERVER_SERVER_METRICS_H
+
+#include "src/core/telemetry/instrument.h"
+
+namespace grpc_core {
+
+// Metrics for requests waiting in the server's pending queue for the
+// application to request a call.
+class ServerPendingRequestsDomain final
+    : public InstrumentDomain<ServerPendingRequestsDomain> {
+ public:
+  using Backend = LowContentionBackend;
+  static constexpr absl::string_view kName = "server_pending_requests";
+  GRPC_EMPTY_INSTRUMENT_DOMAIN_LABELS();
+
+  static CounterHandle kShed;
+  static HistogramHandle<ExponentialHistogramShape> kSojournTime;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_SERVER_SERVER_METRICS_H
@@ -418,6 +418,7 @@ class XdsServerConfigFetcher::ListenerWatcher::XdsConnectionManager::
     // Points inside of XdsServerConfigSelector::route_config_.
     const std::vector<std::string>* domains;
     std::vector<Route> routes;
+    XdsRouting::RouteTable route_table;
   };
 
   class VirtualHostListIterator final
@@ -446,6 +447,7 @@ class XdsServerConfigFetcher::ListenerWatcher::XdsConnectionManager::
 
   std::shared_ptr<const XdsRouteConfigResource> route_config_;
   std::vector<VirtualHost> virtual_hosts_;
+  XdsRouting::VirtualHostTable virtual_host_table_;
 };
 
 //
@@ -1269,7 +1271,11 @@ XdsServerConfigFetcher::ListenerWatcher::XdsConnectionManager::L4FilterChain::
       config_selector_route.filter_list =
           filter_list->TakeAsSubclass<const FilterList>();
     }
+    virtual_host.route_table = XdsRouting::RouteTable(
+        VirtualHost::RouteListIterator(virtual_host.routes));
   }
+  config_selector->virtual_host_table_ = XdsRouting::VirtualHostTable(
+      VirtualHostListIterator(config_selector->virtual_hosts_));
   config_selector->route_config_ = std::move(route_config);
   return config_selector;
 }
@@ -1318,16 +1324,15 @@ XdsServerConfigFetcher::ListenerWatcher::XdsConnectionManager::L4FilterChain::
   }
   absl::string_view authority =
       metadata->get_pointer(HttpAuthorityMetadata())->as_string_view();
-  auto vhost_index = XdsRouting::FindVirtualHostForDomain(
-      VirtualHostListIterator(virtual_hosts_), authority);
+  auto vhost_index = virtual_host_table_.Find(authority);
   if (!vhost_index.has_value()) {
     return absl::UnavailableError(
         absl::StrCat("could not find VirtualHost for ", authority,
                      " in RouteConfiguration"));
   }
   auto& virtual_host = virtual_hosts_[vhost_index.value()];
-  auto route_index = XdsRouting::GetRouteForRequest(
-      VirtualHost::RouteListIterator(virtual_host.routes), path, metadata);
+  auto route_index =
+      virtual_host.route_table.GetRouteForRequest(path, metadata);
   if (!route_index.has_value()) {
     return absl::UnavailableError("no route matched");
   }
@@ -20,7 +20,11 @@
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
+#include <atomic>
+
+#include "src/core/lib/slice/slice.h"
 #include "src/core/service_config/service_config_parser.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/useful.h"
@@ -79,6 +83,81 @@ class ServiceConfig : public RefCounted<ServiceConfig> {
   /// is tied to the lifetime of the ServiceConfig object.
   virtual const ServiceConfigParser::ParsedConfigVector*
   GetMethodParsedConfigVector(const grpc_slice& path) const = 0;
+
+  /// Identifies this ServiceConfig.  No two ServiceConfig objects created
+  /// in the process share a generation, even if one reuses the address of
+  /// another that has been destroyed.
+  uint64_t generation() const { return generation_; }
+
+ protected:
+  ServiceConfig() : generation_(NextGeneration()) {}
+
+ private:
+  static uint64_t NextGeneration() {
+    static std::atomic<uint64_t> next_generation{1};
+    return next_generation.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  const uint64_t generation_;
+};
+
+// The method config vector of one registered method (see
+// grpc_channel_register_call()) for the last service config it was looked
+// up in.  Held by the channel's registration of the method, and carried to
+// the client filters in the GrpcRegisteredMethod metadata, so that calls
+// to the method resolve their config without hashing their path.
+//
+// Lookups take no lock.  The cached vector is returned only if the service
+// config has the same address and generation as the one it was looked up
+// in; otherwise, the path is looked up again and the result replaces it.
+class RegisteredMethodConfigCache {
+ public:
+  RegisteredMethodConfigCache() = default;
+  RegisteredMethodConfigCache(const RegisteredMethodConfigCache&) = delete;
+  RegisteredMethodConfigCache& operator=(const RegisteredMethodConfigCache&) =
+      delete;
+
+  /// Returns service_config.GetMethodParsedConfigVector(path), where path
+  /// must be the path of the registered method.
+  const ServiceConfigParser::ParsedConfigVector* Get(
+      const ServiceConfig& service_config, const Slice& path) {
+    uint32_t seq = seq_.load(std::memory_order_acquire);
+    if ((seq & 1) == 0) {
+      const ServiceConfig* cached_config =
+          service_config_.load(std::memory_order_relaxed);
+      const uint64_t generation = generation_.load(std::memory_order_relaxed);
+      const ServiceConfigParser::ParsedConfigVector* method_configs =
+          method_configs_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_.load(std::memory_order_relaxed) == seq &&
+          cached_config == &service_config &&
+          generation == service_config.generation()) {
+        return method_configs;
+      }
+    }
+    const ServiceConfigParser::ParsedConfigVector* method_configs =
+        service_config.GetMethodParsedConfigVector(path.c_slice());
+    // If another call is writing the entry, leave it to that call.
+    if ((seq & 1) == 0 &&
+        seq_.compare_exchange_strong(seq, seq + 1, std::memory_order_relaxed,
+                                     std::memory_order_relaxed)) {
+      std::atomic_thread_fence(std::memory_order_release);
+      service_config_.store(&service_config, std::memory_order_relaxed);
+      generation_.store(service_config.generation(),
+                        std::memory_order_relaxed);
+      method_configs_.store(method_configs, std::memory_order_relaxed);
+      seq_.store(seq + 2, std::memory_order_release);
+    }
+    return method_configs;
+  }
+
+ private:
+  // Odd while the entry is being written.
+  std::atomic<uint32_t> seq_{0};
+  std::atomic<const ServiceConfig*> service_config_{nullptr};
+  std::atomic<uint64_t> generation_{0};
+  std::atomic<const ServiceConfigParser::ParsedConfigVector*> method_configs_{
+      nullptr};
 };
 
 }  // namespace grpc_core
@@ -44,8 +44,16 @@ void ServiceConfigChannelArgFilter::Call::OnClientInitialMetadata(
       "ServiceConfigChannelArgFilter::Call::OnClientInitialMetadata");
   const ServiceConfigParser::ParsedConfigVector* method_configs = nullptr;
   if (filter->service_config_ != nullptr) {
-    method_configs = filter->service_config_->GetMethodParsedConfigVector(
-        md.get_pointer(HttpPathMetadata())->c_slice());
+    const Slice* path = md.get_pointer(HttpPathMetadata());
+    auto* registered_method = static_cast<RegisteredMethodConfigCache*>(
+        md.get(GrpcRegisteredMethod()).value_or(nullptr));
+    if (registered_method != nullptr) {
+      method_configs =
+          registered_method->Get(*filter->service_config_, *path);
+    } else {
+      method_configs =
+          filter->service_config_->GetMethodParsedConfigVector(path->c_slice());
+    }
   }
   auto* arena = GetContext<Arena>();
   auto* service_config_call_data = arena->New<ServiceConfigCallData>(arena);
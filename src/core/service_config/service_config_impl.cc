@@ -17,8 +17,10 @@
 #include "src/core/service_config/service_config_impl.h"
 
 #include <grpc/support/port_platform.h>
-#include <string.h>
 
+#include <stdint.h>
+
+#include <list>
 #include <optional>
 #include <string>
 #include <utility>
@@ -27,13 +29,18 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/service_config/service_config_parser.h"
+#include "src/core/telemetry/instrument.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_args.h"
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/json/json_reader.h"
 #include "src/core/util/json/json_writer.h"
-#include "src/core/util/memory.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
 #include "src/core/util/validation_errors.h"
+#include "src/core/util/xxhash_inline.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -80,8 +87,111 @@ struct MethodConfig {
 
 }  // namespace
 
+ServiceConfigCacheDomain::CounterHandle ServiceConfigCacheDomain::kCacheHits =
+    ServiceConfigCacheDomain::RegisterCounter(
+        "grpc.service_config_cache.hits",
+        "EXPERIMENTAL.  Number of service configs shared with an identical "
+        "one that was already parsed.",
+        "{service_config}");
+ServiceConfigCacheDomain::CounterHandle
+    ServiceConfigCacheDomain::kDeduplicatedBytes =
+        ServiceConfigCacheDomain::RegisterCounter(
+            "grpc.service_config_cache.deduplicated_bytes",
+            "EXPERIMENTAL.  Total JSON size of the service configs shared "
+            "with an identical one that was already parsed.",
+            "By");
+
+// A process-wide map of the service configs created from a JSON string.
+// When many channels get the same service config from their resolvers,
+// it is parsed only once.
+//
+// Entries are keyed by a 128-bit hash of the JSON string, the values of the
+// channel args the parsers depend on, and the parser registry.  They hold
+// no refs: each service config removes its own entry when destroyed.
+class ServiceConfigImpl::Cache final {
+ public:
+  static Cache& Get() {
+    static NoDestruct<Cache> cache;
+    return *cache;
+  }
+
+  static std::string MakeKey(const ChannelArgs& args,
+                             absl::string_view json_string) {
+    const ServiceConfigParser& parser =
+        CoreConfiguration::Get().service_config_parser();
+    XXH128_hash_t hash = XXH3_128bits(json_string.data(), json_string.size());
+    std::string key = absl::StrCat(
+        absl::Hex(reinterpret_cast<uintptr_t>(&parser)), ":",
+        absl::Hex(hash.high64, absl::kZeroPad16),
+        absl::Hex(hash.low64, absl::kZeroPad16), ":", json_string.size());
+    std::list<std::string> backing;
+    for (const std::string& name : parser.channel_arg_keys()) {
+      const ChannelArgs::Value* value = args.Get(name);
+      if (value == nullptr) continue;
+      absl::string_view value_string = value->ToString(backing);
+      absl::StrAppend(&key, ",", name, "=", value_string.size(), ":",
+                      value_string);
+    }
+    return key;
+  }
+
+  // Returns null if there is no live service config for key.
+  RefCountedPtr<ServiceConfig> Lookup(const std::string& key) {
+    MutexLock lock(&mu_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return nullptr;
+    // Fails if the service config is being destroyed.
+    auto service_config = it->second->RefIfNonZero();
+    if (service_config != nullptr) RecordHit(it->second);
+    return service_config;
+  }
+
+  // Adds service_config, unless a live one with the same key was added
+  // concurrently, in which case that one is returned instead.
+  RefCountedPtr<ServiceConfig> Insert(
+      RefCountedPtr<ServiceConfigImpl> service_config) {
+    MutexLock lock(&mu_);
+    ServiceConfigImpl*& entry = entries_[service_config->cache_key_];
+    if (entry != nullptr) {
+      auto existing = entry->RefIfNonZero();
+      if (existing != nullptr) {
+        RecordHit(entry);
+        return existing;
+      }
+    }
+    entry = service_config.get();
+    return std::move(service_config);
+  }
+
+  void Remove(const ServiceConfigImpl* service_config) {
+    MutexLock lock(&mu_);
+    auto it = entries_.find(service_config->cache_key_);
+    // The entry may have been replaced while service_config was being
+    // destroyed.
+    if (it != entries_.end() && it->second == service_config) {
+      entries_.erase(it);
+    }
+  }
+
+ private:
+  void RecordHit(const ServiceConfigImpl* service_config) {
+    metrics_storage_->Increment(ServiceConfigCacheDomain::kCacheHits);
+    metrics_storage_->Increment(ServiceConfigCacheDomain::kDeduplicatedBytes,
+                                service_config->json_string_.size());
+  }
+
+  const InstrumentStorageRefPtr<ServiceConfigCacheDomain> metrics_storage_ =
+      ServiceConfigCacheDomain::GetStorage(GlobalCollectionScope());
+  Mutex mu_;
+  absl::flat_hash_map<std::string, ServiceConfigImpl*> entries_
+      ABSL_GUARDED_BY(mu_);
+};
+
 absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::Create(
     const ChannelArgs& args, absl::string_view json_string) {
+  std::string cache_key = Cache::MakeKey(args, json_string);
+  auto cached = Cache::Get().Lookup(cache_key);
+  if (cached != nullptr) return cached;
   auto json = JsonParse(json_string);
   if (!json.ok()) return json.status();
   ValidationErrors errors;
@@ -90,7 +200,10 @@ absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::Create(
     return errors.status(absl::StatusCode::kInvalidArgument,
                          "errors validating service config");
   }
-  return service_config;
+  auto service_config_impl =
+      service_config.TakeAsSubclass<ServiceConfigImpl>();
+  service_config_impl->cache_key_ = std::move(cache_key);
+  return Cache::Get().Insert(std::move(service_config_impl));
 }
 
 RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
@@ -167,6 +280,7 @@ RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
 }
 
 ServiceConfigImpl::~ServiceConfigImpl() {
+  if (!cache_key_.empty()) Cache::Get().Remove(this);
   for (auto& p : parsed_method_configs_map_) {
     CSliceUnref(p.first);
   }
@@ -181,12 +295,13 @@ ServiceConfigImpl::GetMethodParsedConfigVector(const grpc_slice& path) const {
   auto it = parsed_method_configs_map_.find(path);
   if (it != parsed_method_configs_map_.end()) return it->second;
   // If we didn't find a match for the path, try looking for a wildcard
-  // entry (i.e., change "/service/method" to "/service/").
-  UniquePtr<char> path_str(grpc_slice_to_c_string(path));
-  char* sep = strrchr(path_str.get(), '/');
-  if (sep == nullptr) return nullptr;  // Shouldn't ever happen.
-  sep[1] = '\0';
-  grpc_slice wildcard_path = grpc_slice_from_static_string(path_str.get());
+  // entry (i.e., change "/service/method" to "/service/").  The key
+  // refers to the path's own bytes, so that no copy is needed.
+  absl::string_view path_str = StringViewFromSlice(path);
+  size_t sep = path_str.rfind('/');
+  if (sep == absl::string_view::npos) return nullptr;  // Shouldn't happen.
+  grpc_slice wildcard_path =
+      grpc_slice_from_static_buffer(path_str.data(), sep + 1);
   it = parsed_method_configs_map_.find(wildcard_path);
   if (it != parsed_method_configs_map_.end()) return it->second;
   // Try default method config, if set.
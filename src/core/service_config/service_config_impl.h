@@ -30,6 +30,7 @@
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/service_config/service_config.h"
 #include "src/core/service_config/service_config_parser.h"
+#include "src/core/telemetry/instrument.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -63,9 +64,25 @@
 
 namespace grpc_core {
 
+class ServiceConfigCacheDomain final
+    : public InstrumentDomain<ServiceConfigCacheDomain> {
+ public:
+  using Backend = LowContentionBackend;
+  static constexpr absl::string_view kName = "service_config_cache";
+  GRPC_EMPTY_INSTRUMENT_DOMAIN_LABELS();
+
+  // Service configs shared with an existing one instead of being parsed.
+  static CounterHandle kCacheHits;
+  // Total JSON size of those service configs.
+  static CounterHandle kDeduplicatedBytes;
+};
+
 class ServiceConfigImpl final : public ServiceConfig {
  public:
   /// Creates a new service config from parsing \a json_string.
+  /// While a service config created this way is in use, calls with the
+  /// same \a json_string and the same values for the channel args listed
+  /// by the registered parsers return that same service config.
   static absl::StatusOr<RefCountedPtr<ServiceConfig>> Create(
       const ChannelArgs& args, absl::string_view json_string);
 
@@ -98,6 +115,10 @@ class ServiceConfigImpl final : public ServiceConfig {
       const grpc_slice& path) const override;
 
  private:
+  class Cache;
+
+  // Key of this service config in Cache, or empty if it is not cached.
+  std::string cache_key_;
   std::string json_string_;
   Json json_;
 
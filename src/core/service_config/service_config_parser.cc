@@ -19,7 +19,9 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <string>
+#include <utility>
 
 #include "absl/log/log.h"
 
@@ -29,6 +31,19 @@ ServiceConfigParser ServiceConfigParser::Builder::Build() {
   return ServiceConfigParser(std::move(registered_parsers_));
 }
 
+ServiceConfigParser::ServiceConfigParser(
+    ServiceConfigParserList registered_parsers)
+    : registered_parsers_(std::move(registered_parsers)) {
+  for (const auto& parser : registered_parsers_) {
+    for (absl::string_view key : parser->ChannelArgKeys()) {
+      if (std::find(channel_arg_keys_.begin(), channel_arg_keys_.end(),
+                    key) == channel_arg_keys_.end()) {
+        channel_arg_keys_.emplace_back(key);
+      }
+    }
+  }
+}
+
 void ServiceConfigParser::Builder::RegisterParser(
     std::unique_ptr<Parser> parser) {
   for (const auto& registered_parser : registered_parsers_) {
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -61,6 +62,14 @@ class ServiceConfigParser {
         ValidationErrors* /*errors*/) {
       return nullptr;
     }
+
+    /// Returns the names of the channel args that the parse results depend
+    /// on.  A parsed service config is shared by all channels with the
+    /// same JSON and the same values for these args, so a parser that reads
+    /// any channel arg MUST list it here.
+    virtual std::vector<absl::string_view> ChannelArgKeys() const {
+      return {};
+    }
   };
 
   using ServiceConfigParserList = std::vector<std::unique_ptr<Parser>>;
@@ -92,10 +101,16 @@ class ServiceConfigParser {
   // If there is an error, return -1.
   size_t GetParserIndex(absl::string_view name) const;
 
+  // The channel args that any registered parser depends on.
+  const std::vector<std::string>& channel_arg_keys() const {
+    return channel_arg_keys_;
+  }
+
  private:
-  explicit ServiceConfigParser(ServiceConfigParserList registered_parsers)
-      : registered_parsers_(std::move(registered_parsers)) {}
+  explicit ServiceConfigParser(ServiceConfigParserList registered_parsers);
+
   ServiceConfigParserList registered_parsers_;
+  std::vector<std::string> channel_arg_keys_;
 };
 
 }  // namespace grpc_core
@@ -44,6 +44,10 @@ std::unique_ptr<GsecKeyInterface> GsecKeyFactory::Create() const {
   return std::make_unique<GsecKey>(key_, is_rekey_);
 }
 
+std::unique_ptr<GsecKeyFactoryInterface> GsecKeyFactory::Clone() const {
+  return std::make_unique<GsecKeyFactory>(key_, is_rekey_);
+}
+
 GsecKey::GsecKey(absl::Span<const uint8_t> key, bool is_rekey)
     : is_rekey_(is_rekey) {
   if (is_rekey_) {
@@ -633,6 +637,53 @@ static grpc_status_code gsec_aes_gcm_aead_crypter_decrypt_iovec(
   return GRPC_STATUS_OK;
 }
 
+static grpc_status_code aes_gcm_check_batch(size_t nonce_length,
+                                            const gsec_aead_frame* frames,
+                                            size_t num_frames,
+                                            char** error_details) {
+  if (num_frames > 0 && frames == nullptr) {
+    aes_gcm_format_errors("Non-zero num_frames but frames is nullptr.",
+                          error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (kAesGcmNonceLength != nonce_length) {
+    aes_gcm_format_errors("Nonce buffer has the wrong length.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  return GRPC_STATUS_OK;
+}
+
+// BoringSSL has no multi-buffer AES-GCM entry point, so batches still seal
+// one frame at a time, but on the same cipher context and without going
+// through the crypter vtable for every frame.
+static grpc_status_code gsec_aes_gcm_aead_crypter_encrypt_batch(
+    gsec_aead_crypter* crypter, size_t nonce_length, gsec_aead_frame* frames,
+    size_t num_frames, char** error_details) {
+  grpc_status_code status =
+      aes_gcm_check_batch(nonce_length, frames, num_frames, error_details);
+  for (size_t i = 0; status == GRPC_STATUS_OK && i < num_frames; ++i) {
+    status = gsec_aes_gcm_aead_crypter_encrypt_iovec(
+        crypter, frames[i].nonce, nonce_length, /*aad_vec=*/nullptr,
+        /*aad_vec_length=*/0, frames[i].input_vec, frames[i].input_vec_length,
+        frames[i].output, &frames[i].bytes_written, error_details);
+  }
+  return status;
+}
+
+static grpc_status_code gsec_aes_gcm_aead_crypter_decrypt_batch(
+    gsec_aead_crypter* crypter, size_t nonce_length, gsec_aead_frame* frames,
+    size_t num_frames, char** error_details) {
+  grpc_status_code status =
+      aes_gcm_check_batch(nonce_length, frames, num_frames, error_details);
+  for (size_t i = 0; status == GRPC_STATUS_OK && i < num_frames; ++i) {
+    status = gsec_aes_gcm_aead_crypter_decrypt_iovec(
+        crypter, frames[i].nonce, nonce_length, /*aad_vec=*/nullptr,
+        /*aad_vec_length=*/0, frames[i].input_vec, frames[i].input_vec_length,
+        frames[i].output, &frames[i].bytes_written, error_details);
+  }
+  return status;
+}
+
 static void gsec_aes_gcm_aead_crypter_destroy(gsec_aead_crypter* crypter) {
   gsec_aes_gcm_aead_crypter* aes_gcm_crypter =
       reinterpret_cast<gsec_aes_gcm_aead_crypter*>(
@@ -644,6 +695,8 @@ static void gsec_aes_gcm_aead_crypter_destroy(gsec_aead_crypter* crypter) {
 static const gsec_aead_crypter_vtable vtable = {
     gsec_aes_gcm_aead_crypter_encrypt_iovec,
     gsec_aes_gcm_aead_crypter_decrypt_iovec,
+    gsec_aes_gcm_aead_crypter_encrypt_batch,
+    gsec_aes_gcm_aead_crypter_decrypt_batch,
     gsec_aes_gcm_aead_crypter_max_ciphertext_and_tag_length,
     gsec_aes_gcm_aead_crypter_max_plaintext_length,
     gsec_aes_gcm_aead_crypter_nonce_length,
@@ -111,6 +111,60 @@ grpc_status_code gsec_aead_crypter_decrypt_iovec(
   return GRPC_STATUS_INVALID_ARGUMENT;
 }
 
+grpc_status_code gsec_aead_crypter_encrypt_batch(gsec_aead_crypter* crypter,
+                                                 size_t nonce_length,
+                                                 gsec_aead_frame* frames,
+                                                 size_t num_frames,
+                                                 char** error_details) {
+  if (crypter != nullptr && crypter->vtable != nullptr) {
+    if (crypter->vtable->encrypt_batch != nullptr) {
+      return crypter->vtable->encrypt_batch(crypter, nonce_length, frames,
+                                            num_frames, error_details);
+    }
+    if (crypter->vtable->encrypt_iovec != nullptr) {
+      for (size_t i = 0; i < num_frames; ++i) {
+        grpc_status_code status = crypter->vtable->encrypt_iovec(
+            crypter, frames[i].nonce, nonce_length, /*aad_vec=*/nullptr,
+            /*aad_vec_length=*/0, frames[i].input_vec,
+            frames[i].input_vec_length, frames[i].output,
+            &frames[i].bytes_written, error_details);
+        if (status != GRPC_STATUS_OK) return status;
+      }
+      return GRPC_STATUS_OK;
+    }
+  }
+  // An error occurred.
+  maybe_copy_error_msg(vtable_error_msg, error_details);
+  return GRPC_STATUS_INVALID_ARGUMENT;
+}
+
+grpc_status_code gsec_aead_crypter_decrypt_batch(gsec_aead_crypter* crypter,
+                                                 size_t nonce_length,
+                                                 gsec_aead_frame* frames,
+                                                 size_t num_frames,
+                                                 char** error_details) {
+  if (crypter != nullptr && crypter->vtable != nullptr) {
+    if (crypter->vtable->decrypt_batch != nullptr) {
+      return crypter->vtable->decrypt_batch(crypter, nonce_length, frames,
+                                            num_frames, error_details);
+    }
+    if (crypter->vtable->decrypt_iovec != nullptr) {
+      for (size_t i = 0; i < num_frames; ++i) {
+        grpc_status_code status = crypter->vtable->decrypt_iovec(
+            crypter, frames[i].nonce, nonce_length, /*aad_vec=*/nullptr,
+            /*aad_vec_length=*/0, frames[i].input_vec,
+            frames[i].input_vec_length, frames[i].output,
+            &frames[i].bytes_written, error_details);
+        if (status != GRPC_STATUS_OK) return status;
+      }
+      return GRPC_STATUS_OK;
+    }
+  }
+  // An error occurred.
+  maybe_copy_error_msg(vtable_error_msg, error_details);
+  return GRPC_STATUS_INVALID_ARGUMENT;
+}
+
 grpc_status_code gsec_aead_crypter_max_ciphertext_and_tag_length(
     const gsec_aead_crypter* crypter, size_t plaintext_length,
     size_t* max_ciphertext_and_tag_length_to_return, char** error_details) {
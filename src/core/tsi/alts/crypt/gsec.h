@@ -57,6 +57,9 @@ class GsecKeyFactoryInterface {
 
   // Creates identical and independent GsecKeyInterface objects.
   virtual std::unique_ptr<GsecKeyInterface> Create() const = 0;
+
+  // Creates a factory that outlives this one and creates the same keys.
+  virtual std::unique_ptr<GsecKeyFactoryInterface> Clone() const = 0;
 };
 
 class GsecKeyFactory : public GsecKeyFactoryInterface {
@@ -66,6 +69,7 @@ class GsecKeyFactory : public GsecKeyFactoryInterface {
   ~GsecKeyFactory() override = default;
 
   std::unique_ptr<GsecKeyInterface> Create() const override;
+  std::unique_ptr<GsecKeyFactoryInterface> Clone() const override;
 
  private:
   std::vector<uint8_t> key_;
@@ -127,6 +131,19 @@ const size_t kAes128GcmRekeyKeyLength = 44;
 
 typedef struct gsec_aead_crypter gsec_aead_crypter;
 
+// One frame of a batched AEAD operation, authenticated without aad. For
+// encryption, input_vec holds the plaintext and output receives the
+// ciphertext and tag; for decryption, input_vec holds the ciphertext and tag
+// and output receives the plaintext. bytes_written is set to the number of
+// bytes written to output.
+typedef struct gsec_aead_frame {
+  const uint8_t* nonce;
+  const struct iovec* input_vec;
+  size_t input_vec_length;
+  struct iovec output;
+  size_t bytes_written;
+} gsec_aead_frame;
+
 //
 // The gsec_aead_crypter is an API for different AEAD implementations such as
 // AES_GCM. It encapsulates all AEAD-related operations in the format of
@@ -228,6 +245,16 @@ typedef struct gsec_aead_crypter_vtable {
       const struct iovec* ciphertext_vec, size_t ciphertext_vec_length,
       struct iovec plaintext_vec, size_t* plaintext_bytes_written,
       char** error_details);
+  // Optional. If nullptr, batches are processed one frame at a time with
+  // encrypt_iovec and decrypt_iovec.
+  grpc_status_code (*encrypt_batch)(gsec_aead_crypter* crypter,
+                                    size_t nonce_length,
+                                    gsec_aead_frame* frames, size_t num_frames,
+                                    char** error_details);
+  grpc_status_code (*decrypt_batch)(gsec_aead_crypter* crypter,
+                                    size_t nonce_length,
+                                    gsec_aead_frame* frames, size_t num_frames,
+                                    char** error_details);
   grpc_status_code (*max_ciphertext_and_tag_length)(
       const gsec_aead_crypter* crypter, size_t plaintext_length,
       size_t* max_ciphertext_and_tag_length_to_return, char** error_details);
@@ -392,6 +419,59 @@ grpc_status_code gsec_aead_crypter_decrypt_iovec(
     struct iovec plaintext_vec, size_t* plaintext_bytes_written,
     char** error_details);
 
+//
+// This method performs AEAD encrypt operations on num_frames frames, in
+// order, each with its own nonce. It produces the same output as calling
+// gsec_aead_crypter_encrypt_iovec on every frame, but lets implementations
+// amortize the per-call setup across the batch.
+//
+//- crypter: AEAD crypter instance.
+//- nonce_length: size of every frame's nonce buffer, and must be equal to
+//  the value returned from method gsec_aead_crypter_nonce_length.
+//- frames: an array of num_frames frames. Their output buffers should not
+//  overlap any input buffer.
+//- num_frames: the array length of frames.
+//- error_details: a buffer containing an error message if the method does not
+//  function correctly. It is legal to pass nullptr into error_details, and
+//  otherwise, the parameter should be freed with gpr_free.
+//
+// On the success of encryption of every frame, the method returns
+// GRPC_STATUS_OK. Otherwise, it stops at the first frame that fails and
+// returns an error status code along with its details specified in
+// error_details (if error_details is not nullptr).
+//
+grpc_status_code gsec_aead_crypter_encrypt_batch(gsec_aead_crypter* crypter,
+                                                 size_t nonce_length,
+                                                 gsec_aead_frame* frames,
+                                                 size_t num_frames,
+                                                 char** error_details);
+
+//
+// This method performs AEAD decrypt operations on num_frames frames, in
+// order, each with its own nonce. It produces the same output as calling
+// gsec_aead_crypter_decrypt_iovec on every frame.
+//
+//- crypter: AEAD crypter instance.
+//- nonce_length: size of every frame's nonce buffer, and must be equal to
+//  the value returned from method gsec_aead_crypter_nonce_length.
+//- frames: an array of num_frames frames. Their output buffers should not
+//  overlap any input buffer.
+//- num_frames: the array length of frames.
+//- error_details: a buffer containing an error message if the method does not
+//  function correctly. It is legal to pass nullptr into error_details, and
+//  otherwise, the parameter should be freed with gpr_free.
+//
+// On the success of decryption of every frame, the method returns
+// GRPC_STATUS_OK. Otherwise, it stops at the first frame that fails and
+// returns an error status code along with its details specified in
+// error_details (if error_details is not nullptr).
+//
+grpc_status_code gsec_aead_crypter_decrypt_batch(gsec_aead_crypter* crypter,
+                                                 size_t nonce_length,
+                                                 gsec_aead_frame* frames,
+                                                 size_t num_frames,
+                                                 char** error_details);
+
 //
 // This method computes the size of ciphertext+tag buffer that must be passed
 // to gsec_aead_crypter_encrypt function to ensure correct encryption of a
@@ -325,7 +325,7 @@ static void alts_destroy(tsi_frame_protector* self) {
 }
 
 static const tsi_frame_protector_vtable alts_frame_protector_vtable = {
-    alts_protect, alts_protect_flush, alts_unprotect, alts_destroy};
+    alts_protect, alts_protect_flush, alts_unprotect, alts_destroy, nullptr};
 
 static grpc_status_code create_alts_crypters(const uint8_t* key,
                                              size_t key_size, bool is_client,
@@ -800,16 +800,21 @@ alts_handshaker_client* alts_grpc_handshaker_client_create(
   }
   client->preferred_transport_protocols = transport_protocols;
   client->error = error;
+  grpc_core::Channel* handshaker_channel = grpc_core::Channel::FromC(channel);
   client->call =
       strcmp(handshaker_service_url, ALTS_HANDSHAKER_SERVICE_URL_FOR_TESTING) ==
               0
           ? nullptr
-          : grpc_core::Channel::FromC(channel)->CreateCall(
+          : handshaker_channel->CreateCall(
                 /*parent_call=*/nullptr, GRPC_PROPAGATE_DEFAULTS,
                 /*cq=*/nullptr, interested_parties,
                 grpc_core::Slice::FromStaticString(ALTS_SERVICE_METHOD),
                 /*authority=*/std::nullopt, grpc_core::Timestamp::InfFuture(),
-                /*registered_method=*/true, std::nullopt);
+                /*registered_method=*/
+                &handshaker_channel
+                     ->RegisterCall(ALTS_SERVICE_METHOD, /*host=*/nullptr)
+                     ->config_cache,
+                std::nullopt);
   GRPC_CLOSURE_INIT(&client->on_handshaker_service_resp_recv, grpc_cb, client,
                     grpc_schedule_on_exec_ctx);
   GRPC_CLOSURE_INIT(&client->on_status_received, on_status_received, client,
@@ -23,6 +23,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <vector>
+
 #include "src/core/tsi/alts/frame_protector/alts_counter.h"
 #include "src/core/util/crash.h"
 
@@ -286,11 +288,11 @@ grpc_status_code alts_iovec_record_protocol_integrity_only_unprotect(
   return increment_counter(rp->ctr, error_details);
 }
 
-grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
-    alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
-    size_t unprotected_vec_length, iovec_t protected_frame,
+// Ensures rp may be used for privacy-integrity protect (if is_protect) or
+// unprotect operations.
+static grpc_status_code check_privacy_integrity_operation(
+    const alts_iovec_record_protocol* rp, bool is_protect,
     char** error_details) {
-  // Input sanity checks.
   if (rp == nullptr) {
     maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
                          error_details);
@@ -302,11 +304,26 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
         error_details);
     return GRPC_STATUS_FAILED_PRECONDITION;
   }
-  if (!rp->is_protect) {
+  if (is_protect && !rp->is_protect) {
     maybe_copy_error_msg("Protect operations are not allowed for this object.",
                          error_details);
     return GRPC_STATUS_FAILED_PRECONDITION;
   }
+  if (!is_protect && rp->is_protect) {
+    maybe_copy_error_msg(
+        "Unprotect operations are not allowed for this object.", error_details);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  return GRPC_STATUS_OK;
+}
+
+// Checks the size of protected_frame and writes its header. On success,
+// ciphertext is set to the part of protected_frame that receives the
+// encrypted data and tag.
+static grpc_status_code prepare_protected_frame(
+    const alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, iovec_t protected_frame,
+    iovec_t* ciphertext, char** error_details) {
   // Unprotected data should not be zero length.
   size_t data_length =
       get_total_length(unprotected_vec, unprotected_vec_length);
@@ -328,78 +345,201 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
   if (status != GRPC_STATUS_OK) {
     return status;
   }
+  ciphertext->iov_base = static_cast<unsigned char*>(protected_frame.iov_base) +
+                         alts_iovec_record_protocol_get_header_length();
+  ciphertext->iov_len = data_length + rp->tag_length;
+  return GRPC_STATUS_OK;
+}
+
+// Checks the sizes of a protected frame's parts and verifies its header.
+static grpc_status_code check_protected_frame(
+    const alts_iovec_record_protocol* rp, iovec_t header,
+    const iovec_t* protected_vec, size_t protected_vec_length,
+    iovec_t unprotected_data, char** error_details) {
+  // Protected data size should be no less than tag size.
+  size_t protected_data_length =
+      get_total_length(protected_vec, protected_vec_length);
+  if (protected_data_length < rp->tag_length) {
+    maybe_copy_error_msg(
+        "Protected data length should be more than the tag length.",
+        error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  // Ensures header has sufficient size.
+  if (header.iov_base == nullptr) {
+    maybe_copy_error_msg("Header is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (header.iov_len != alts_iovec_record_protocol_get_header_length()) {
+    maybe_copy_error_msg("Header length is incorrect.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  // Ensures unprotected data iovec has sufficient size.
+  if (unprotected_data.iov_len != protected_data_length - rp->tag_length) {
+    maybe_copy_error_msg("Unprotected data size is incorrect.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  // Verify frame header.
+  return verify_frame_header(protected_data_length,
+                             static_cast<unsigned char*>(header.iov_base),
+                             error_details);
+}
+
+// Seals unprotected_vec into protected_frame with the given counter value,
+// without advancing rp's own counter.
+static grpc_status_code privacy_integrity_protect_with_counter(
+    alts_iovec_record_protocol* rp, const unsigned char* counter,
+    size_t counter_size, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, iovec_t protected_frame,
+    char** error_details) {
+  // Input sanity checks.
+  grpc_status_code status = check_privacy_integrity_operation(
+      rp, /*is_protect=*/true, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  iovec_t ciphertext;
+  status = prepare_protected_frame(rp, unprotected_vec, unprotected_vec_length,
+                                   protected_frame, &ciphertext,
+                                   error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
   // Encrypt unprotected data by calling AEAD crypter.
-  unsigned char* ciphertext_buffer =
-      static_cast<unsigned char*>(protected_frame.iov_base) +
-      alts_iovec_record_protocol_get_header_length();
-  iovec_t ciphertext = {ciphertext_buffer, data_length + rp->tag_length};
   size_t bytes_written = 0;
   status = gsec_aead_crypter_encrypt_iovec(
-      rp->crypter, alts_counter_get_counter(rp->ctr),
-      alts_counter_get_size(rp->ctr), /* aad_vec = */ nullptr,
+      rp->crypter, counter, counter_size, /* aad_vec = */ nullptr,
       /* aad_vec_length = */ 0, unprotected_vec, unprotected_vec_length,
       ciphertext, &bytes_written, error_details);
   if (status != GRPC_STATUS_OK) {
     return status;
   }
-  if (bytes_written != data_length + rp->tag_length) {
+  if (bytes_written != ciphertext.iov_len) {
     maybe_copy_error_msg(
         "Bytes written expects to be data length plus tag length.",
         error_details);
     return GRPC_STATUS_INTERNAL;
   }
-  // Increments the crypter counter.
-  return increment_counter(rp->ctr, error_details);
+  return GRPC_STATUS_OK;
 }
 
-grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
-    alts_iovec_record_protocol* rp, iovec_t header,
-    const iovec_t* protected_vec, size_t protected_vec_length,
-    iovec_t unprotected_data, char** error_details) {
-  // Input sanity checks.
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
+    alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, iovec_t protected_frame,
+    char** error_details) {
   if (rp == nullptr) {
     maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
                          error_details);
     return GRPC_STATUS_INVALID_ARGUMENT;
   }
-  if (rp->is_integrity_only) {
-    maybe_copy_error_msg(
-        "Privacy-integrity operations are not allowed for this object.",
-        error_details);
-    return GRPC_STATUS_FAILED_PRECONDITION;
+  grpc_status_code status = privacy_integrity_protect_with_counter(
+      rp, alts_counter_get_counter(rp->ctr), alts_counter_get_size(rp->ctr),
+      unprotected_vec, unprotected_vec_length, protected_frame, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
   }
-  if (rp->is_protect) {
-    maybe_copy_error_msg(
-        "Unprotect operations are not allowed for this object.", error_details);
-    return GRPC_STATUS_FAILED_PRECONDITION;
+  // Increments the crypter counter.
+  return increment_counter(rp->ctr, error_details);
+}
+
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_frames(
+    alts_iovec_record_protocol* rp, const alts_iovec_protect_frame* frames,
+    size_t num_frames, char** error_details) {
+  // Input sanity checks.
+  grpc_status_code status = check_privacy_integrity_operation(
+      rp, /*is_protect=*/true, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
   }
-  // Protected data size should be no less than tag size.
-  size_t protected_data_length =
-      get_total_length(protected_vec, protected_vec_length);
-  if (protected_data_length < rp->tag_length) {
-    maybe_copy_error_msg(
-        "Protected data length should be more than the tag length.",
-        error_details);
+  if (num_frames > 0 && frames == nullptr) {
+    maybe_copy_error_msg("Frames is nullptr.", error_details);
     return GRPC_STATUS_INVALID_ARGUMENT;
   }
-  // Ensures header has sufficient size.
-  if (header.iov_base == nullptr) {
-    maybe_copy_error_msg("Header is nullptr.", error_details);
+  // Write every header and reserve every counter value up front, so that the
+  // whole batch is sealed by a single crypter call.
+  const size_t counter_size = alts_counter_get_size(rp->ctr);
+  std::vector<unsigned char> counters(num_frames * counter_size);
+  std::vector<gsec_aead_frame> aead_frames(num_frames);
+  for (size_t i = 0; i < num_frames; ++i) {
+    gsec_aead_frame& aead_frame = aead_frames[i];
+    status = prepare_protected_frame(
+        rp, frames[i].unprotected_vec, frames[i].unprotected_vec_length,
+        frames[i].protected_frame, &aead_frame.output, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+    status = alts_iovec_record_protocol_reserve_counter(
+        rp, &counters[i * counter_size], counter_size, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+    aead_frame.nonce = &counters[i * counter_size];
+    aead_frame.input_vec = frames[i].unprotected_vec;
+    aead_frame.input_vec_length = frames[i].unprotected_vec_length;
+    aead_frame.bytes_written = 0;
+  }
+  // Encrypt unprotected data by calling AEAD crypter.
+  status = gsec_aead_crypter_encrypt_batch(rp->crypter, counter_size,
+                                           aead_frames.data(), num_frames,
+                                           error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  for (const gsec_aead_frame& aead_frame : aead_frames) {
+    if (aead_frame.bytes_written != aead_frame.output.iov_len) {
+      maybe_copy_error_msg(
+          "Bytes written expects to be data length plus tag length.",
+          error_details);
+      return GRPC_STATUS_INTERNAL;
+    }
+  }
+  return GRPC_STATUS_OK;
+}
+
+grpc_status_code alts_iovec_record_protocol_reserve_counter(
+    alts_iovec_record_protocol* rp, unsigned char* counter,
+    size_t counter_size, char** error_details) {
+  if (rp == nullptr || counter == nullptr) {
+    maybe_copy_error_msg("Input iovec_record_protocol or counter is nullptr.",
+                         error_details);
     return GRPC_STATUS_INVALID_ARGUMENT;
   }
-  if (header.iov_len != alts_iovec_record_protocol_get_header_length()) {
-    maybe_copy_error_msg("Header length is incorrect.", error_details);
+  if (counter_size != alts_counter_get_size(rp->ctr)) {
+    maybe_copy_error_msg("Counter size is incorrect.", error_details);
     return GRPC_STATUS_INVALID_ARGUMENT;
   }
-  // Ensures unprotected data iovec has sufficient size.
-  if (unprotected_data.iov_len != protected_data_length - rp->tag_length) {
-    maybe_copy_error_msg("Unprotected data size is incorrect.", error_details);
+  memcpy(counter, alts_counter_get_counter(rp->ctr), counter_size);
+  return increment_counter(rp->ctr, error_details);
+}
+
+grpc_status_code
+alts_iovec_record_protocol_privacy_integrity_protect_with_counter(
+    alts_iovec_record_protocol* rp, const unsigned char* counter,
+    size_t counter_size, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, iovec_t protected_frame,
+    char** error_details) {
+  if (counter == nullptr) {
+    maybe_copy_error_msg("Counter is nullptr.", error_details);
     return GRPC_STATUS_INVALID_ARGUMENT;
   }
-  // Verify frame header.
-  grpc_status_code status = verify_frame_header(
-      protected_data_length, static_cast<unsigned char*>(header.iov_base),
-      error_details);
+  return privacy_integrity_protect_with_counter(
+      rp, counter, counter_size, unprotected_vec, unprotected_vec_length,
+      protected_frame, error_details);
+}
+
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
+    alts_iovec_record_protocol* rp, iovec_t header,
+    const iovec_t* protected_vec, size_t protected_vec_length,
+    iovec_t unprotected_data, char** error_details) {
+  // Input sanity checks.
+  grpc_status_code status = check_privacy_integrity_operation(
+      rp, /*is_protect=*/false, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  status = check_protected_frame(rp, header, protected_vec,
+                                 protected_vec_length, unprotected_data,
+                                 error_details);
   if (status != GRPC_STATUS_OK) {
     return status;
   }
@@ -414,7 +554,7 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
     maybe_append_error_msg(" Frame decryption failed.", error_details);
     return GRPC_STATUS_INTERNAL;
   }
-  if (bytes_written != protected_data_length - rp->tag_length) {
+  if (bytes_written != unprotected_data.iov_len) {
     maybe_copy_error_msg(
         "Bytes written expects to be protected data length minus tag length.",
         error_details);
@@ -424,6 +564,62 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
   return increment_counter(rp->ctr, error_details);
 }
 
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect_frames(
+    alts_iovec_record_protocol* rp, const alts_iovec_unprotect_frame* frames,
+    size_t num_frames, char** error_details) {
+  // Input sanity checks.
+  grpc_status_code status = check_privacy_integrity_operation(
+      rp, /*is_protect=*/false, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  if (num_frames > 0 && frames == nullptr) {
+    maybe_copy_error_msg("Frames is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  const size_t counter_size = alts_counter_get_size(rp->ctr);
+  std::vector<unsigned char> counters(num_frames * counter_size);
+  std::vector<gsec_aead_frame> aead_frames(num_frames);
+  for (size_t i = 0; i < num_frames; ++i) {
+    status = check_protected_frame(
+        rp, frames[i].header, frames[i].protected_vec,
+        frames[i].protected_vec_length, frames[i].unprotected_data,
+        error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+    status = alts_iovec_record_protocol_reserve_counter(
+        rp, &counters[i * counter_size], counter_size, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+    gsec_aead_frame& aead_frame = aead_frames[i];
+    aead_frame.nonce = &counters[i * counter_size];
+    aead_frame.input_vec = frames[i].protected_vec;
+    aead_frame.input_vec_length = frames[i].protected_vec_length;
+    aead_frame.output = frames[i].unprotected_data;
+    aead_frame.bytes_written = 0;
+  }
+  // Decrypt protected data by calling AEAD crypter.
+  status = gsec_aead_crypter_decrypt_batch(rp->crypter, counter_size,
+                                           aead_frames.data(), num_frames,
+                                           error_details);
+  if (status != GRPC_STATUS_OK) {
+    maybe_append_error_msg(" Frame decryption failed.", error_details);
+    return GRPC_STATUS_INTERNAL;
+  }
+  for (const gsec_aead_frame& aead_frame : aead_frames) {
+    if (aead_frame.bytes_written != aead_frame.output.iov_len) {
+      maybe_copy_error_msg(
+          "Bytes written expects to be protected data length minus tag "
+          "length.",
+          error_details);
+      return GRPC_STATUS_INTERNAL;
+    }
+  }
+  return GRPC_STATUS_OK;
+}
+
 grpc_status_code alts_iovec_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
     bool is_integrity_only, bool is_protect, alts_iovec_record_protocol** rp,
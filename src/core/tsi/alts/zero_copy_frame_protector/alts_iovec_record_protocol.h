@@ -40,6 +40,23 @@ typedef struct iovec iovec_t;
 
 typedef struct alts_iovec_record_protocol alts_iovec_record_protocol;
 
+// One frame of a batched privacy-integrity protect operation, see
+// alts_iovec_record_protocol_privacy_integrity_protect for the fields.
+typedef struct alts_iovec_protect_frame {
+  const iovec_t* unprotected_vec;
+  size_t unprotected_vec_length;
+  iovec_t protected_frame;
+} alts_iovec_protect_frame;
+
+// One frame of a batched privacy-integrity unprotect operation, see
+// alts_iovec_record_protocol_privacy_integrity_unprotect for the fields.
+typedef struct alts_iovec_unprotect_frame {
+  iovec_t header;
+  const iovec_t* protected_vec;
+  size_t protected_vec_length;
+  iovec_t unprotected_data;
+} alts_iovec_unprotect_frame;
+
 ///
 /// This method gets the length of record protocol frame header.
 ///
@@ -135,6 +152,75 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
     size_t unprotected_vec_length, iovec_t protected_frame,
     char** error_details);
 
+///
+/// This method performs privacy-integrity protect operations on num_frames
+/// frames, in order. It produces the same frames as calling
+/// alts_iovec_record_protocol_privacy_integrity_protect on each of them, but
+/// seals the whole batch with a single call into the AEAD crypter.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- frames: an array of num_frames frames to protect.
+///- num_frames: the array length of frames.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr), and rp should not be used anymore.
+///
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_frames(
+    alts_iovec_record_protocol* rp, const alts_iovec_protect_frame* frames,
+    size_t num_frames, char** error_details);
+
+///
+/// This method copies the counter value to be used by the next frame protected
+/// by rp into counter and advances rp's counter, so that the frame can be
+/// sealed later, possibly on another thread, by
+/// alts_iovec_record_protocol_privacy_integrity_protect_with_counter.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- counter: a buffer of counter_size bytes receiving the counter value.
+///- counter_size: the size of rp's counter, i.e. the crypter's nonce length.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr).
+///
+grpc_status_code alts_iovec_record_protocol_reserve_counter(
+    alts_iovec_record_protocol* rp, unsigned char* counter,
+    size_t counter_size, char** error_details);
+
+///
+/// This method is the same as
+/// alts_iovec_record_protocol_privacy_integrity_protect, except that it seals
+/// the frame with the given counter value instead of rp's own counter, which
+/// is left unchanged. Frames may be sealed in any order and concurrently, as
+/// long as concurrent calls use different rp instances created with the same
+/// key.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- counter: a counter value obtained from
+///  alts_iovec_record_protocol_reserve_counter.
+///- counter_size: the size of counter.
+///- unprotected_vec: an iovec array containing unprotected data.
+///- unprotected_vec_length: the array length of unprotected_vec.
+///- protected_frame: an iovec containing the output protected frame.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr).
+///
+grpc_status_code
+alts_iovec_record_protocol_privacy_integrity_protect_with_counter(
+    alts_iovec_record_protocol* rp, const unsigned char* counter,
+    size_t counter_size, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, iovec_t protected_frame,
+    char** error_details);
+
 ///
 /// This method performs privacy-integrity unprotect operation on a
 /// alts_iovec_record_protocol instance given a full protected frame, i.e.,
@@ -158,6 +244,26 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
     const iovec_t* protected_vec, size_t protected_vec_length,
     iovec_t unprotected_data, char** error_details);
 
+///
+/// This method performs privacy-integrity unprotect operations on num_frames
+/// full protected frames, in order. It produces the same data as calling
+/// alts_iovec_record_protocol_privacy_integrity_unprotect on each of them, but
+/// opens the whole batch with a single call into the AEAD crypter.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- frames: an array of num_frames frames to unprotect.
+///- num_frames: the array length of frames.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr), and rp should not be used anymore.
+///
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect_frames(
+    alts_iovec_record_protocol* rp, const alts_iovec_unprotect_frame* frames,
+    size_t num_frames, char** error_details);
+
 ///
 /// This method creates an alts_iovec_record_protocol instance, given a
 /// gsec_aead_crypter instance, a flag indicating if the created instance will
@@ -22,13 +22,17 @@
 #include <grpc/support/port_platform.h>
 #include <string.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/alts/crypt/gsec.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_integrity_only_record_protocol.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_privacy_integrity_record_protocol.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_record_protocol.h"
+#include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_record_protocol_common.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_iovec_record_protocol.h"
 #include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/grpc_check.h"
@@ -37,6 +41,11 @@
 constexpr size_t kMinFrameLength = 1024;
 constexpr size_t kDefaultFrameLength = 16 * 1024;
 constexpr size_t kMaxFrameLength = 16 * 1024 * 1024;
+constexpr size_t kMaxSealLanes = 16;
+// Limits on the frames sealed or opened by one batched crypter call, so that
+// the slice allocated for the batch stays a reasonable size.
+constexpr size_t kMaxBatchFrames = 32;
+constexpr size_t kMaxBatchDataSize = 1024 * 1024;
 
 ///
 /// Main struct for alts_zero_copy_grpc_protector.
@@ -55,6 +64,14 @@ typedef struct alts_zero_copy_grpc_protector {
   grpc_slice_buffer protected_sb;
   grpc_slice_buffer protected_staging_sb;
   uint32_t parsed_frame_size;
+  // Used by protect_parallel to create the seal lanes on first use. Owned.
+  grpc_core::GsecKeyFactoryInterface* key_factory;
+  bool is_client;
+  bool is_integrity_only;
+  // Record protocols sharing the key of record_protocol, each sealing the
+  // frames of one concurrent call of a parallel protect.
+  alts_iovec_record_protocol* seal_lanes[kMaxSealLanes];
+  size_t num_seal_lanes;
 } alts_zero_copy_grpc_protector;
 
 ///
@@ -144,6 +161,152 @@ static tsi_result create_alts_grpc_record_protocol(
   return TSI_OK;
 }
 
+// A frame of a batched protect or unprotect. For protect, data_sb holds the
+// plaintext; for unprotect, it holds the ciphertext and tag, and header the
+// frame header stripped from them.
+struct alts_batch_frame {
+  grpc_slice_buffer data_sb;
+  unsigned char header[kZeroCopyFrameHeaderSize];
+  size_t iovec_begin;
+};
+
+// Appends iovecs referencing the slices of sb to iovecs.
+static void append_iovecs(const grpc_slice_buffer* sb,
+                          std::vector<iovec_t>* iovecs) {
+  for (size_t i = 0; i < sb->count; ++i) {
+    const grpc_slice& slice = sb->slices[i];
+    iovecs->push_back({GRPC_SLICE_START_PTR(slice), GRPC_SLICE_LENGTH(slice)});
+  }
+}
+
+static grpc_slice allocate_batch_slice(alts_grpc_record_protocol* rp,
+                                       size_t size) {
+  return rp->alloc_cb != nullptr ? rp->alloc_cb(size, rp->alloc_user_data)
+                                 : GRPC_SLICE_MALLOC(size);
+}
+
+// Privacy-integrity protects unprotected_slices a batch of frames at a time,
+// sealing each batch into a single slice with a single crypter call.
+static tsi_result protect_frames_batched(
+    alts_zero_copy_grpc_protector* protector,
+    grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  alts_grpc_record_protocol* rp = protector->record_protocol;
+  const size_t frame_overhead = rp->header_length + rp->tag_length;
+  // Frames hold inlined slice buffers, so they must not be moved.
+  std::vector<alts_batch_frame> frames;
+  frames.reserve(kMaxBatchFrames);
+  std::vector<iovec_t> iovecs;
+  std::vector<alts_iovec_protect_frame> iovec_frames;
+  tsi_result result = TSI_OK;
+  while (result == TSI_OK && unprotected_slices->length > 0) {
+    size_t data_size = 0;
+    iovecs.clear();
+    while (unprotected_slices->length > 0 && frames.size() < kMaxBatchFrames &&
+           data_size < kMaxBatchDataSize) {
+      const size_t length = std::min(unprotected_slices->length,
+                                     protector->max_unprotected_data_size);
+      frames.emplace_back();
+      alts_batch_frame& frame = frames.back();
+      grpc_slice_buffer_init(&frame.data_sb);
+      grpc_slice_buffer_move_first(unprotected_slices, length, &frame.data_sb);
+      frame.iovec_begin = iovecs.size();
+      append_iovecs(&frame.data_sb, &iovecs);
+      data_size += length;
+    }
+    grpc_slice protected_slice =
+        allocate_batch_slice(rp, data_size + frames.size() * frame_overhead);
+    unsigned char* protected_frame = GRPC_SLICE_START_PTR(protected_slice);
+    iovec_frames.clear();
+    for (const alts_batch_frame& frame : frames) {
+      const size_t protected_frame_size = frame.data_sb.length + frame_overhead;
+      iovec_frames.push_back({iovecs.data() + frame.iovec_begin,
+                              frame.data_sb.count,
+                              {protected_frame, protected_frame_size}});
+      protected_frame += protected_frame_size;
+    }
+    char* error_details = nullptr;
+    if (alts_iovec_record_protocol_privacy_integrity_protect_frames(
+            rp->iovec_rp, iovec_frames.data(), iovec_frames.size(),
+            &error_details) == GRPC_STATUS_OK) {
+      grpc_slice_buffer_add(protected_slices, protected_slice);
+    } else {
+      LOG(ERROR) << "Failed to protect, " << error_details;
+      gpr_free(error_details);
+      grpc_core::CSliceUnref(protected_slice);
+      result = TSI_INTERNAL_ERROR;
+    }
+    for (alts_batch_frame& frame : frames) {
+      grpc_slice_buffer_destroy(&frame.data_sb);
+    }
+    frames.clear();
+  }
+  return result;
+}
+
+// Privacy-integrity unprotects the frame of protector->parsed_frame_size
+// bytes at the front of protector->protected_sb, together with the complete
+// frames following it, opening them into a single slice with a single crypter
+// call. Frames that are incomplete or malformed are left in protected_sb.
+static tsi_result unprotect_frames_batched(
+    alts_zero_copy_grpc_protector* protector,
+    grpc_slice_buffer* unprotected_slices) {
+  alts_grpc_record_protocol* rp = protector->unrecord_protocol;
+  const size_t frame_overhead = rp->header_length + rp->tag_length;
+  // Frames hold inlined slice buffers, so they must not be moved.
+  std::vector<alts_batch_frame> frames;
+  frames.reserve(kMaxBatchFrames);
+  std::vector<iovec_t> iovecs;
+  size_t data_size = 0;
+  uint32_t frame_size = protector->parsed_frame_size;
+  while (true) {
+    frames.emplace_back();
+    alts_batch_frame& frame = frames.back();
+    grpc_slice_buffer_init(&frame.data_sb);
+    grpc_slice_buffer_move_first(&protector->protected_sb, frame_size,
+                                 &frame.data_sb);
+    grpc_slice_buffer_move_first_into_buffer(&frame.data_sb, rp->header_length,
+                                             frame.header);
+    frame.iovec_begin = iovecs.size();
+    append_iovecs(&frame.data_sb, &iovecs);
+    data_size += frame_size - frame_overhead;
+    if (frames.size() == kMaxBatchFrames || data_size >= kMaxBatchDataSize ||
+        !read_frame_size(&protector->protected_sb, &frame_size) ||
+        frame_size < frame_overhead ||
+        frame_size > protector->protected_sb.length) {
+      break;
+    }
+  }
+  grpc_slice unprotected_slice = allocate_batch_slice(rp, data_size);
+  unsigned char* unprotected_data = GRPC_SLICE_START_PTR(unprotected_slice);
+  std::vector<alts_iovec_unprotect_frame> iovec_frames;
+  iovec_frames.reserve(frames.size());
+  for (alts_batch_frame& frame : frames) {
+    const size_t data_length = frame.data_sb.length - rp->tag_length;
+    iovec_frames.push_back({{frame.header, rp->header_length},
+                            iovecs.data() + frame.iovec_begin,
+                            frame.data_sb.count,
+                            {unprotected_data, data_length}});
+    unprotected_data += data_length;
+  }
+  char* error_details = nullptr;
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_unprotect_frames(
+          rp->iovec_rp, iovec_frames.data(), iovec_frames.size(),
+          &error_details);
+  for (alts_batch_frame& frame : frames) {
+    grpc_slice_buffer_destroy(&frame.data_sb);
+  }
+  if (status != GRPC_STATUS_OK) {
+    LOG(ERROR) << "Failed to unprotect, " << error_details;
+    gpr_free(error_details);
+    grpc_core::CSliceUnref(unprotected_slice);
+    return TSI_INTERNAL_ERROR;
+  }
+  grpc_slice_buffer_add(unprotected_slices, unprotected_slice);
+  return TSI_OK;
+}
+
 // --- tsi_zero_copy_grpc_protector methods implementation. ---
 
 static tsi_result alts_zero_copy_grpc_protector_protect(
@@ -156,6 +319,11 @@ static tsi_result alts_zero_copy_grpc_protector_protect(
   }
   alts_zero_copy_grpc_protector* protector =
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
+  if (!protector->is_integrity_only &&
+      unprotected_slices->length > protector->max_unprotected_data_size) {
+    return protect_frames_batched(protector, unprotected_slices,
+                                  protected_slices);
+  }
   // Calls alts_grpc_record_protocol protect repeatedly.
   while (unprotected_slices->length > protector->max_unprotected_data_size) {
     grpc_slice_buffer_move_first(unprotected_slices,
@@ -172,6 +340,144 @@ static tsi_result alts_zero_copy_grpc_protector_protect(
       protector->record_protocol, unprotected_slices, protected_slices);
 }
 
+// Creates seal lanes until there are at least num_lanes of them.
+static tsi_result ensure_seal_lanes(alts_zero_copy_grpc_protector* protector,
+                                    size_t num_lanes) {
+  while (protector->num_seal_lanes < num_lanes) {
+    std::unique_ptr<grpc_core::GsecKeyInterface> key =
+        protector->key_factory->Create();
+    const bool is_rekey = key->IsRekey();
+    gsec_aead_crypter* crypter = nullptr;
+    char* error_details = nullptr;
+    grpc_status_code status = gsec_aes_gcm_aead_crypter_create(
+        std::move(key), kAesGcmNonceLength, kAesGcmTagLength, &crypter,
+        &error_details);
+    if (status == GRPC_STATUS_OK) {
+      status = alts_iovec_record_protocol_create(
+          crypter,
+          is_rekey ? kAltsRecordProtocolRekeyFrameLimit
+                   : kAltsRecordProtocolFrameLimit,
+          protector->is_client, /*is_integrity_only=*/false,
+          /*is_protect=*/true,
+          &protector->seal_lanes[protector->num_seal_lanes], &error_details);
+      if (status != GRPC_STATUS_OK) gsec_aead_crypter_destroy(crypter);
+    }
+    if (status != GRPC_STATUS_OK) {
+      LOG(ERROR) << "Failed to create seal lane, " << error_details;
+      gpr_free(error_details);
+      return TSI_INTERNAL_ERROR;
+    }
+    ++protector->num_seal_lanes;
+  }
+  return TSI_OK;
+}
+
+// A frame of a parallel protect: its plaintext, the slice it is sealed into
+// and the counter reserved for it.
+struct alts_parallel_seal_frame {
+  grpc_slice_buffer unprotected_sb;
+  grpc_slice protected_slice;
+  unsigned char counter[kAesGcmNonceLength];
+};
+
+static tsi_result alts_zero_copy_grpc_protector_protect_parallel(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices, size_t max_parallelism,
+    tsi_zero_copy_grpc_protector_parallel_for parallel_for) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    LOG(ERROR) << "Invalid nullptr arguments to zero-copy grpc protect.";
+    return TSI_INVALID_ARGUMENT;
+  }
+  alts_zero_copy_grpc_protector* protector =
+      reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
+  const size_t num_frames =
+      (unprotected_slices->length + protector->max_unprotected_data_size - 1) /
+      protector->max_unprotected_data_size;
+  // Integrity-only frames reference the unprotected slices rather than
+  // copying them, so there is little work to spread.
+  if (protector->is_integrity_only || num_frames < 2) {
+    return alts_zero_copy_grpc_protector_protect(self, unprotected_slices,
+                                                 protected_slices);
+  }
+  const size_t num_lanes =
+      std::min({num_frames, max_parallelism, kMaxSealLanes});
+  tsi_result result = ensure_seal_lanes(protector, num_lanes);
+  if (result != TSI_OK) return result;
+  // Splits the data into frames, reserving their counters in order, so that
+  // the frames can then be sealed in any order.
+  alts_grpc_record_protocol* rp = protector->record_protocol;
+  std::vector<alts_parallel_seal_frame> frames(num_frames);
+  size_t num_prepared = 0;
+  for (; num_prepared < num_frames; ++num_prepared) {
+    alts_parallel_seal_frame& frame = frames[num_prepared];
+    const size_t length = std::min(unprotected_slices->length,
+                                   protector->max_unprotected_data_size);
+    char* error_details = nullptr;
+    if (alts_iovec_record_protocol_reserve_counter(
+            rp->iovec_rp, frame.counter, sizeof(frame.counter),
+            &error_details) != GRPC_STATUS_OK) {
+      LOG(ERROR) << "Failed to protect, " << error_details;
+      gpr_free(error_details);
+      result = TSI_INTERNAL_ERROR;
+      break;
+    }
+    grpc_slice_buffer_init(&frame.unprotected_sb);
+    grpc_slice_buffer_move_first(unprotected_slices, length,
+                                 &frame.unprotected_sb);
+    const size_t protected_frame_size =
+        length + rp->header_length + rp->tag_length;
+    frame.protected_slice = rp->alloc_cb != nullptr
+                                ? rp->alloc_cb(protected_frame_size,
+                                               rp->alloc_user_data)
+                                : GRPC_SLICE_MALLOC(protected_frame_size);
+  }
+  std::vector<grpc_status_code> lane_status(num_lanes, GRPC_STATUS_OK);
+  if (result == TSI_OK) {
+    // Each lane seals a contiguous run of frames with its own crypter.
+    parallel_for(num_lanes, [&](size_t lane) {
+      const size_t begin = num_frames * lane / num_lanes;
+      const size_t end = num_frames * (lane + 1) / num_lanes;
+      std::vector<iovec_t> unprotected_vec;
+      for (size_t i = begin; i < end; ++i) {
+        alts_parallel_seal_frame& frame = frames[i];
+        unprotected_vec.clear();
+        for (size_t j = 0; j < frame.unprotected_sb.count; ++j) {
+          grpc_slice& slice = frame.unprotected_sb.slices[j];
+          unprotected_vec.push_back(
+              {GRPC_SLICE_START_PTR(slice), GRPC_SLICE_LENGTH(slice)});
+        }
+        char* error_details = nullptr;
+        lane_status[lane] =
+            alts_iovec_record_protocol_privacy_integrity_protect_with_counter(
+                protector->seal_lanes[lane], frame.counter,
+                sizeof(frame.counter), unprotected_vec.data(),
+                unprotected_vec.size(),
+                {GRPC_SLICE_START_PTR(frame.protected_slice),
+                 GRPC_SLICE_LENGTH(frame.protected_slice)},
+                &error_details);
+        if (lane_status[lane] != GRPC_STATUS_OK) {
+          LOG(ERROR) << "Failed to protect, " << error_details;
+          gpr_free(error_details);
+          return;
+        }
+      }
+    });
+    for (grpc_status_code status : lane_status) {
+      if (status != GRPC_STATUS_OK) result = TSI_INTERNAL_ERROR;
+    }
+  }
+  for (size_t i = 0; i < num_prepared; ++i) {
+    grpc_slice_buffer_destroy(&frames[i].unprotected_sb);
+    if (result == TSI_OK) {
+      grpc_slice_buffer_add(protected_slices, frames[i].protected_slice);
+    } else {
+      grpc_core::CSliceUnref(frames[i].protected_slice);
+    }
+  }
+  return result;
+}
+
 static tsi_result alts_zero_copy_grpc_protector_unprotect(
     tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
@@ -196,7 +502,16 @@ static tsi_result alts_zero_copy_grpc_protector_unprotect(
     if (protector->protected_sb.length < protector->parsed_frame_size) break;
     // At this point, protected_sb contains at least one frame of data.
     tsi_result status;
-    if (protector->protected_sb.length == protector->parsed_frame_size) {
+    alts_grpc_record_protocol* unrecord_protocol = protector->unrecord_protocol;
+    if (!protector->is_integrity_only &&
+        protector->protected_sb.length > protector->parsed_frame_size &&
+        protector->parsed_frame_size >=
+            unrecord_protocol->header_length + unrecord_protocol->tag_length) {
+      // More data follows this frame, open it together with any other
+      // complete frames behind it.
+      status = unprotect_frames_batched(protector, unprotected_slices);
+    } else if (protector->protected_sb.length ==
+               protector->parsed_frame_size) {
       status = alts_grpc_record_protocol_unprotect(protector->unrecord_protocol,
                                                    &protector->protected_sb,
                                                    unprotected_slices);
@@ -234,6 +549,10 @@ static void alts_zero_copy_grpc_protector_destroy(
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
   alts_grpc_record_protocol_destroy(protector->record_protocol);
   alts_grpc_record_protocol_destroy(protector->unrecord_protocol);
+  for (size_t i = 0; i < protector->num_seal_lanes; ++i) {
+    alts_iovec_record_protocol_destroy(protector->seal_lanes[i]);
+  }
+  delete protector->key_factory;
   grpc_slice_buffer_destroy(&protector->unprotected_staging_sb);
   grpc_slice_buffer_destroy(&protector->protected_sb);
   grpc_slice_buffer_destroy(&protector->protected_staging_sb);
@@ -275,7 +594,8 @@ static const tsi_zero_copy_grpc_protector_vtable
         alts_zero_copy_grpc_protector_destroy,
         alts_zero_copy_grpc_protector_max_frame_size,
         alts_zero_copy_grpc_protector_read_frame_size,
-        alts_zero_copy_grpc_protector_set_allocator};
+        alts_zero_copy_grpc_protector_set_allocator,
+        alts_zero_copy_grpc_protector_protect_parallel};
 
 tsi_result alts_zero_copy_grpc_protector_create(
     const grpc_core::GsecKeyFactoryInterface& key_factory, bool is_client,
@@ -319,6 +639,9 @@ tsi_result alts_zero_copy_grpc_protector_create(
       grpc_slice_buffer_init(&impl->protected_sb);
       grpc_slice_buffer_init(&impl->protected_staging_sb);
       impl->parsed_frame_size = 0;
+      impl->key_factory = key_factory.Clone().release();
+      impl->is_client = is_client;
+      impl->is_integrity_only = is_integrity_only;
       impl->base.vtable = &alts_zero_copy_grpc_protector_vtable;
       *protector = &impl->base;
       return TSI_OK;
@@ -432,6 +432,7 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     fake_protector_protect_flush,
     fake_protector_unprotect,
     fake_protector_destroy,
+    nullptr,
 };
 
 // --- tsi_zero_copy_grpc_protector methods implementation. ---
@@ -545,7 +546,8 @@ static const tsi_zero_copy_grpc_protector_vtable
         fake_zero_copy_grpc_protector_destroy,
         fake_zero_copy_grpc_protector_max_frame_size,
         fake_zero_copy_grpc_protector_read_frame_size,
-        nullptr /* set_allocator */
+        nullptr /* set_allocator */,
+        nullptr /* protect_parallel */
 };
 
 // --- tsi_handshaker_result methods implementation. ---
@@ -21,8 +21,14 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/string_util.h>
 
+#include <map>
+#include <string>
+#include <utility>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_store.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/sync.h"
@@ -30,6 +36,26 @@
 
 namespace tsi {
 
+namespace {
+
+std::string SerializeSession(SSL_SESSION* session) {
+  int size = i2d_SSL_SESSION(session, nullptr);
+  if (size <= 0) return "";
+  std::string serialized(size, '\0');
+  unsigned char* out = reinterpret_cast<unsigned char*>(&serialized[0]);
+  if (i2d_SSL_SESSION(session, &out) != size) return "";
+  return serialized;
+}
+
+SslSessionPtr DeserializeSession(absl::string_view serialized) {
+  const unsigned char* in =
+      reinterpret_cast<const unsigned char*>(serialized.data());
+  return SslSessionPtr(
+      d2i_SSL_SESSION(nullptr, &in, static_cast<long>(serialized.size())));
+}
+
+}  // namespace
+
 /// Node for single cached session.
 class SslSessionLRUCache::Node {
  public:
@@ -61,11 +87,19 @@ class SslSessionLRUCache::Node {
   Node* prev_ = nullptr;
 };
 
-SslSessionLRUCache::SslSessionLRUCache(size_t capacity) : capacity_(capacity) {
+SslSessionLRUCache::SslSessionLRUCache(
+    size_t capacity, grpc_core::RefCountedPtr<SslSessionStore> store)
+    : capacity_(capacity), store_(std::move(store)) {
   if (capacity == 0) {
     LOG(ERROR) << "SslSessionLRUCache capacity is zero. SSL sessions cannot be "
                   "resumed.";
   }
+  if (store_ == nullptr) return;
+  grpc_core::MutexLock lock(&lock_);
+  for (const auto& [key, serialized] : store_->GetSessions()) {
+    SslSessionPtr session = DeserializeSession(serialized);
+    if (session != nullptr) PutLocked(key, std::move(session));
+  }
 }
 
 SslSessionLRUCache::~SslSessionLRUCache() {
@@ -101,7 +135,25 @@ void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
     LOG(ERROR) << "Attempted to put null SSL session in session cache.";
     return;
   }
-  grpc_core::MutexLock lock(&lock_);
+  std::string serialized;
+  if (store_ != nullptr) serialized = SerializeSession(session.get());
+  bool start_writer = false;
+  {
+    grpc_core::MutexLock lock(&lock_);
+    PutLocked(key, std::move(session));
+    if (!serialized.empty()) {
+      pending_writes_[key] = std::move(serialized);
+      start_writer = !std::exchange(writing_, true);
+    }
+  }
+  if (start_writer) {
+    grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+        [self = Ref()]() { self->WritePendingSessions(); });
+  }
+}
+
+void SslSessionLRUCache::PutLocked(const std::string& key,
+                                   SslSessionPtr session) {
   Node* node = FindLocked(key);
   if (node != nullptr) {
     node->SetSession(std::move(session));
@@ -122,6 +174,23 @@ void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
   }
 }
 
+void SslSessionLRUCache::WritePendingSessions() {
+  while (true) {
+    std::map<std::string, std::string> writes;
+    {
+      grpc_core::MutexLock lock(&lock_);
+      if (pending_writes_.empty()) {
+        writing_ = false;
+        return;
+      }
+      writes.swap(pending_writes_);
+    }
+    for (const auto& [key, serialized] : writes) {
+      store_->PutSession(key, serialized);
+    }
+  }
+}
+
 SslSessionPtr SslSessionLRUCache::Get(const char* key) {
   grpc_core::MutexLock lock(&lock_);
   // Key is only used for lookups.
@@ -26,8 +26,11 @@
 #include <openssl/ssl.h>
 
 #include <map>
+#include <string>
+#include <utility>
 
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_store.h"
 #include "src/core/util/cpp_impl_of.h"
 #include "src/core/util/memory.h"
 #include "src/core/util/ref_counted.h"
@@ -40,6 +43,11 @@
 /// name. Note that servers are required to share session ticket encryption keys
 /// in order for cache to be effective.
 ///
+/// If created with a SslSessionStore, the cache starts with the sessions in
+/// the store, and new sessions are written to it in the background, so that
+/// sessions survive restarts and are shared with processes started later.
+/// Lookups never touch the store.
+///
 /// This class is thread safe.
 
 namespace tsi {
@@ -49,13 +57,19 @@ class SslSessionLRUCache
                                   struct tsi_ssl_session_cache>,
       public grpc_core::RefCounted<SslSessionLRUCache> {
  public:
-  /// Create new LRU cache with the given capacity.
-  static grpc_core::RefCountedPtr<SslSessionLRUCache> Create(size_t capacity) {
-    return grpc_core::MakeRefCounted<SslSessionLRUCache>(capacity);
+  /// Create new LRU cache with the given capacity, optionally backed by
+  /// \a store.
+  static grpc_core::RefCountedPtr<SslSessionLRUCache> Create(
+      size_t capacity,
+      grpc_core::RefCountedPtr<SslSessionStore> store = nullptr) {
+    return grpc_core::MakeRefCounted<SslSessionLRUCache>(capacity,
+                                                         std::move(store));
   }
 
   // Use Create function instead of using this directly.
-  explicit SslSessionLRUCache(size_t capacity);
+  explicit SslSessionLRUCache(
+      size_t capacity,
+      grpc_core::RefCountedPtr<SslSessionStore> store = nullptr);
   ~SslSessionLRUCache() override;
 
   // Not copyable nor movable.
@@ -79,12 +93,21 @@ class SslSessionLRUCache
   class Node;
 
   Node* FindLocked(const std::string& key);
+  void PutLocked(const std::string& key, SslSessionPtr session)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Writes pending_writes_ to store_ until there are none left.
+  void WritePendingSessions();
   void Remove(Node* node);
   void PushFront(Node* node);
   void AssertInvariants();
 
   grpc_core::Mutex lock_;
   size_t capacity_;
+  const grpc_core::RefCountedPtr<SslSessionStore> store_;
+  // Serialized sessions not yet written to store_, by key.
+  std::map<std::string, std::string> pending_writes_ ABSL_GUARDED_BY(lock_);
+  // Whether WritePendingSessions() is scheduled or running.
+  bool writing_ ABSL_GUARDED_BY(lock_) = false;
 
   Node* use_order_list_head_ = nullptr;
   Node* use_order_list_tail_ = nullptr;
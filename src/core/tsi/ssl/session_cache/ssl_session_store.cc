@@ -0,0 +1,418 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/tsi/ssl/session_cache/ssl_session_store.h"
+
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "src/core/util/grpc_check.h"
+#include "absl/log/log.h"
+#include "absl/time/clock.h"
+
+#ifndef GPR_WINDOWS
+
+#include <errno.h>
+#include <fcntl.h>
+#include <openssl/rand.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <string>
+
+#include "src/core/util/directory_reader.h"
+#include "src/core/util/strerror.h"
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/strip.h"
+
+namespace tsi {
+namespace {
+
+constexpr absl::string_view kSessionFilePrefix = "session_";
+constexpr absl::string_view kTicketKeysFilePrefix = "ticket_keys_";
+
+// Creates \a path, which must not exist yet, readable by its owner only.
+absl::Status WriteNewFile(const std::string& path,
+                          absl::string_view contents) {
+  int fd = open(path.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    std::string message = absl::StrCat("Failed to create ", path, ": ",
+                                       grpc_core::StrError(errno));
+    return errno == EEXIST ? absl::AlreadyExistsError(message)
+                           : absl::InternalError(message);
+  }
+  FILE* file = fdopen(fd, "wb");
+  if (file == nullptr) {
+    close(fd);
+    remove(path.c_str());
+    return absl::InternalError(absl::StrCat(
+        "Failed to open ", path, ": ", grpc_core::StrError(errno)));
+  }
+  bool ok = fwrite(contents.data(), 1, contents.size(), file) ==
+            contents.size();
+  ok &= fclose(file) == 0;
+  if (!ok) {
+    remove(path.c_str());
+    return absl::InternalError(absl::StrCat("Failed to write ", path));
+  }
+  return absl::OkStatus();
+}
+
+// Reads \a path, unless users other than its owner may read it: such a file
+// was not created by this store, and its contents may have leaked.
+absl::StatusOr<std::string> ReadPrivateFile(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    std::string message = absl::StrCat("Failed to open ", path, ": ",
+                                       grpc_core::StrError(errno));
+    return errno == ENOENT ? absl::NotFoundError(message)
+                           : absl::InternalError(message);
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return absl::InternalError(absl::StrCat(
+        "Failed to stat ", path, ": ", grpc_core::StrError(errno)));
+  }
+  if ((st.st_mode & (S_IRWXG | S_IRWXO)) != 0) {
+    close(fd);
+    return absl::PermissionDeniedError(
+        absl::StrCat(path, " is accessible to other users"));
+  }
+  std::string contents;
+  char buffer[4096];
+  ssize_t bytes_read;
+  while ((bytes_read = read(fd, buffer, sizeof(buffer))) != 0) {
+    if (bytes_read < 0) {
+      if (errno == EINTR) continue;
+      close(fd);
+      return absl::InternalError(absl::StrCat(
+          "Failed to read ", path, ": ", grpc_core::StrError(errno)));
+    }
+    contents.append(buffer, static_cast<size_t>(bytes_read));
+  }
+  close(fd);
+  return contents;
+}
+
+std::string RandomBytes(size_t size) {
+  std::string bytes(size, '\0');
+  GRPC_CHECK_EQ(RAND_bytes(reinterpret_cast<uint8_t*>(&bytes[0]), size), 1);
+  return bytes;
+}
+
+class FileSslSessionStore final : public SslSessionStore {
+ public:
+  FileSslSessionStore(std::string directory,
+                      grpc_core::Duration ticket_key_rotation_period)
+      : directory_(std::move(directory)),
+        rotation_period_ms_(
+            std::max<int64_t>(ticket_key_rotation_period.millis(), 1)) {}
+
+  void PutSession(absl::string_view key, absl::string_view session) override {
+    const std::string path = SessionPath(key);
+    // Write to a private file first and then rename it over the previous
+    // session, so that readers never see a partially written one.
+    const std::string tmp_path =
+        absl::StrCat(path, ".", absl::BytesToHexString(RandomBytes(8)));
+    absl::Status status = WriteNewFile(tmp_path, session);
+    if (status.ok() && rename(tmp_path.c_str(), path.c_str()) != 0) {
+      status = absl::InternalError(absl::StrCat(
+          "Failed to rename ", tmp_path, ": ", grpc_core::StrError(errno)));
+      remove(tmp_path.c_str());
+    }
+    if (!status.ok()) {
+      LOG(ERROR) << "Failed to store SSL session: " << status;
+    }
+  }
+
+  std::map<std::string, std::string> GetSessions() override {
+    std::map<std::string, std::string> sessions;
+    absl::Status status = grpc_core::MakeDirectoryReader(directory_)->ForEach(
+        [&](absl::string_view name) {
+          // Skips the temporary files of PutSession, whose names have a
+          // suffix after a '.'.
+          if (!absl::ConsumePrefix(&name, kSessionFilePrefix) ||
+              name.empty() || name.size() % 2 != 0 ||
+              !std::all_of(name.begin(), name.end(), absl::ascii_isxdigit)) {
+            return;
+          }
+          std::string key = absl::HexStringToBytes(name);
+          auto session = ReadPrivateFile(SessionPath(key));
+          if (!session.ok()) {
+            LOG(ERROR) << "Failed to load SSL session: " << session.status();
+            return;
+          }
+          sessions.emplace(std::move(key), *std::move(session));
+        });
+    if (!status.ok()) {
+      LOG(ERROR) << "Failed to load SSL sessions: " << status;
+    }
+    return sessions;
+  }
+
+  absl::StatusOr<TicketKeys> GetTicketKeys(size_t size,
+                                           absl::Time time) override {
+    const int64_t period = absl::ToUnixMillis(time) / rotation_period_ms_;
+    auto current = GetOrCreateTicketKeys(period, size);
+    if (!current.ok()) return current.status();
+    TicketKeys keys;
+    keys.current = *std::move(current);
+    // Only present if some process used the previous period.
+    auto previous = ReadTicketKeys(period - 1, size);
+    if (previous.ok()) keys.previous = *std::move(previous);
+    keys.rotation_time =
+        absl::FromUnixMillis((period + 1) * rotation_period_ms_);
+    // The keys of the next period are fetched ahead of time, while the
+    // previous period's keys may still be in use.
+    const int64_t current_period =
+        absl::ToUnixMillis(absl::Now()) / rotation_period_ms_;
+    RemoveTicketKeysBefore(std::min(period, current_period) - 1);
+    return keys;
+  }
+
+ private:
+  std::string SessionPath(absl::string_view key) const {
+    // Keys are server names, hex encode them to get a valid file name.
+    return absl::StrCat(directory_, "/", kSessionFilePrefix,
+                        absl::BytesToHexString(key));
+  }
+
+  std::string TicketKeysPath(int64_t period) const {
+    return absl::StrCat(directory_, "/", kTicketKeysFilePrefix, period);
+  }
+
+  absl::StatusOr<std::string> GetOrCreateTicketKeys(int64_t period,
+                                                    size_t size) {
+    auto existing = ReadTicketKeys(period, size);
+    if (!absl::IsNotFound(existing.status())) return existing;
+    // Write the keys to a private file first and then link it into place,
+    // so that other processes never see partially written keys, and
+    // exactly one process is the author of the keys.
+    const std::string path = TicketKeysPath(period);
+    const std::string tmp_path =
+        absl::StrCat(path, ".", absl::BytesToHexString(RandomBytes(8)));
+    std::string keys = RandomBytes(size);
+    absl::Status status = WriteNewFile(tmp_path, keys);
+    if (!status.ok()) return status;
+    const int link_result = link(tmp_path.c_str(), path.c_str());
+    const int link_errno = errno;
+    remove(tmp_path.c_str());
+    if (link_result == 0) return keys;
+    // Another process created them first.
+    if (link_errno == EEXIST) return ReadTicketKeys(period, size);
+    return absl::InternalError(absl::StrCat("Failed to link ", path, ": ",
+                                            grpc_core::StrError(link_errno)));
+  }
+
+  absl::StatusOr<std::string> ReadTicketKeys(int64_t period, size_t size) {
+    const std::string path = TicketKeysPath(period);
+    auto contents = ReadPrivateFile(path);
+    if (!contents.ok()) return contents.status();
+    if (contents->size() < size) {
+      return absl::DataLossError(
+          absl::StrCat("Truncated session ticket keys in ", path));
+    }
+    return contents->substr(0, size);
+  }
+
+  // Removes keys that can no longer decrypt any ticket, along with the
+  // temporary files of processes that died while creating them. Failures
+  // are harmless, some other process may have removed them first.
+  void RemoveTicketKeysBefore(int64_t period) {
+    grpc_core::MakeDirectoryReader(directory_)
+        ->ForEach([&](absl::string_view name) {
+          const std::string path = absl::StrCat(directory_, "/", name);
+          int64_t file_period;
+          if (absl::ConsumePrefix(&name, kTicketKeysFilePrefix) &&
+              absl::SimpleAtoi(name.substr(0, name.find('.')),
+                               &file_period) &&
+              file_period < period) {
+            remove(path.c_str());
+          }
+        })
+        .IgnoreError();
+  }
+
+  const std::string directory_;
+  const int64_t rotation_period_ms_;
+};
+
+}  // namespace
+
+grpc_core::RefCountedPtr<SslSessionStore> CreateFileSslSessionStore(
+    std::string directory, grpc_core::Duration ticket_key_rotation_period) {
+  return grpc_core::MakeRefCounted<FileSslSessionStore>(
+      std::move(directory), ticket_key_rotation_period);
+}
+
+}  // namespace tsi
+
+#else  // GPR_WINDOWS
+
+namespace tsi {
+
+grpc_core::RefCountedPtr<SslSessionStore> CreateFileSslSessionStore(
+    std::string /*directory*/,
+    grpc_core::Duration /*ticket_key_rotation_period*/) {
+  LOG(ERROR) << "File SSL session stores are not supported on Windows.";
+  return nullptr;
+}
+
+}  // namespace tsi
+
+#endif  // GPR_WINDOWS
+
+namespace tsi {
+namespace {
+
+// How long before a rotation the keys of the next period are fetched.
+constexpr absl::Duration kFetchAheadOfRotation = absl::Minutes(1);
+// How long to wait before fetching keys again after the store failed.
+constexpr absl::Duration kFetchRetryDelay = absl::Seconds(10);
+
+}  // namespace
+
+absl::StatusOr<grpc_core::OrphanablePtr<SslTicketKeyRing>>
+SslTicketKeyRing::Create(
+    grpc_core::RefCountedPtr<SslSessionStore> store,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+        event_engine) {
+  auto keys = store->GetTicketKeys(kKeysSize, absl::Now());
+  if (!keys.ok()) return keys.status();
+  auto ring = grpc_core::MakeOrphanable<SslTicketKeyRing>(
+      std::move(store), std::move(event_engine));
+  ring->Install(*keys);
+  grpc_core::MutexLock lock(&ring->mu_);
+  ring->rotation_time_ = keys->rotation_time;
+  ring->ScheduleLocked(keys->rotation_time - kFetchAheadOfRotation,
+                       &SslTicketKeyRing::FetchNextKeys);
+  return ring;
+}
+
+SslTicketKeyRing::SslTicketKeyRing(
+    grpc_core::RefCountedPtr<SslSessionStore> store,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+        event_engine)
+    : store_(std::move(store)), event_engine_(std::move(event_engine)) {}
+
+void SslTicketKeyRing::Orphan() {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    shutdown_ = true;
+    if (timer_handle_.has_value()) event_engine_->Cancel(*timer_handle_);
+    timer_handle_.reset();
+  }
+  Unref();
+}
+
+void SslTicketKeyRing::Get(Keys* keys) const {
+  uint64_t words[kNumWords];
+  bool has_previous;
+  while (true) {
+    const uint32_t seq = seq_.load(std::memory_order_acquire);
+    // Install() is only a few stores long, wait for it to finish.
+    if ((seq & 1) != 0) continue;
+    for (size_t i = 0; i < kNumWords; ++i) {
+      words[i] = words_[i].load(std::memory_order_relaxed);
+    }
+    has_previous = has_previous_.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (seq_.load(std::memory_order_relaxed) == seq) break;
+  }
+  memcpy(keys->current, words, kKeysSize);
+  memcpy(keys->previous, words + kNumWords / 2, kKeysSize);
+  keys->has_previous = has_previous;
+}
+
+void SslTicketKeyRing::Install(const SslSessionStore::TicketKeys& keys) {
+  GRPC_CHECK_EQ(keys.current.size(), kKeysSize);
+  uint64_t words[kNumWords] = {};
+  memcpy(words, keys.current.data(), kKeysSize);
+  const bool has_previous = keys.previous.size() == kKeysSize;
+  if (has_previous) {
+    memcpy(words + kNumWords / 2, keys.previous.data(), kKeysSize);
+  }
+  // Only called by one thread at a time: on creation, then from the timer.
+  const uint32_t seq = seq_.load(std::memory_order_relaxed);
+  seq_.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  for (size_t i = 0; i < kNumWords; ++i) {
+    words_[i].store(words[i], std::memory_order_relaxed);
+  }
+  has_previous_.store(has_previous, std::memory_order_relaxed);
+  seq_.store(seq + 2, std::memory_order_release);
+}
+
+void SslTicketKeyRing::ScheduleLocked(absl::Time time,
+                                      void (SslTicketKeyRing::*callback)()) {
+  const absl::Duration delay =
+      std::max(time - absl::Now(), absl::ZeroDuration());
+  timer_handle_ = event_engine_->RunAfter(
+      absl::ToChronoNanoseconds(delay),
+      [self = Ref(), callback]() { ((*self).*callback)(); });
+}
+
+void SslTicketKeyRing::FetchNextKeys() {
+  absl::Time time;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (shutdown_) return;
+    timer_handle_.reset();
+    // If fetching failed until after the rotation, catch up with the
+    // current period.
+    time = std::max(rotation_time_, absl::Now());
+  }
+  auto keys = store_->GetTicketKeys(kKeysSize, time);
+  grpc_core::MutexLock lock(&mu_);
+  if (shutdown_) return;
+  if (!keys.ok()) {
+    // Keep using the keys we have: tickets they encrypt are still accepted
+    // by processes that moved on to the next period.
+    LOG(ERROR) << "Failed to fetch session ticket keys from the store: "
+               << keys.status();
+    ScheduleLocked(absl::Now() + kFetchRetryDelay,
+                   &SslTicketKeyRing::FetchNextKeys);
+    return;
+  }
+  const absl::Time start_time = rotation_time_;
+  next_keys_ = *std::move(keys);
+  ScheduleLocked(start_time, &SslTicketKeyRing::InstallNextKeys);
+}
+
+void SslTicketKeyRing::InstallNextKeys() {
+  grpc_core::MutexLock lock(&mu_);
+  if (shutdown_) return;
+  timer_handle_.reset();
+  Install(*next_keys_);
+  rotation_time_ = next_keys_->rotation_time;
+  next_keys_.reset();
+  ScheduleLocked(rotation_time_ - kFetchAheadOfRotation,
+                 &SslTicketKeyRing::FetchNextKeys);
+}
+
+}  // namespace tsi
@@ -0,0 +1,177 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_SESSION_STORE_H
+#define GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_SESSION_STORE_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "src/core/util/useful.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+
+// A pointer to a tsi::SslSessionStore. On servers, TLS session ticket
+// encryption keys are taken from the store so that tickets issued before a
+// restart, or by another worker process, can still be decrypted.
+#define GRPC_ARG_SSL_SESSION_STORE "grpc.experimental.ssl_session_store"
+
+namespace tsi {
+
+/// Storage for TLS resumption state that outlives a single process.
+///
+/// Client sessions are stored serialized, keyed by server name, behind the
+/// in-memory SslSessionLRUCache. Servers use the store to agree on session
+/// ticket encryption keys, so that a rolling restart does not force every
+/// client back to a full handshake.
+///
+/// Implementations must be thread safe.
+class SslSessionStore : public grpc_core::RefCounted<SslSessionStore> {
+ public:
+  /// Session ticket keys of the current and the previous rotation period.
+  struct TicketKeys {
+    /// Encrypts new tickets.
+    std::string current;
+    /// Only decrypts tickets issued before the last rotation. Empty if no
+    /// key was created for the previous period.
+    std::string previous;
+    /// When the next rotation period starts, and \a current stops
+    /// encrypting new tickets.
+    absl::Time rotation_time;
+  };
+
+  static absl::string_view ChannelArgName() {
+    return GRPC_ARG_SSL_SESSION_STORE;
+  }
+  static int ChannelArgsCompare(const SslSessionStore* a,
+                                const SslSessionStore* b) {
+    return grpc_core::QsortCompare(a, b);
+  }
+
+  /// Stores the serialized session \a session for \a key, replacing any
+  /// previous one. Failures are not fatal and are only logged. May block on
+  /// I/O, so it is not called on the handshake path.
+  virtual void PutSession(absl::string_view key, absl::string_view session) = 0;
+  /// Returns every stored serialized session, by key. May block on I/O.
+  virtual std::map<std::string, std::string> GetSessions() = 0;
+  /// Returns the session ticket keys, each \a size bytes long, of the
+  /// rotation period that contains the wall-clock time \a time. Every
+  /// caller, in this or another process sharing the store, gets the same
+  /// keys. May block on I/O, so it is only called through SslTicketKeyRing,
+  /// off the handshake path.
+  virtual absl::StatusOr<TicketKeys> GetTicketKeys(size_t size,
+                                                   absl::Time time) = 0;
+};
+
+/// Holds the session ticket keys of a server's SslSessionStore in memory,
+/// for the handshake path. Shortly before each rotation, the keys of the
+/// next period are fetched from the store on an EventEngine timer, and they
+/// replace the ones in use when the period starts. Handshakes read the keys
+/// without taking a lock and never wait for the store.
+class SslTicketKeyRing final
+    : public grpc_core::InternallyRefCounted<SslTicketKeyRing> {
+ public:
+  /// A 16 byte key name, followed by 16 byte HMAC and AES keys.
+  static constexpr size_t kKeysSize = 48;
+
+  struct Keys {
+    /// Encrypts new tickets.
+    uint8_t current[kKeysSize];
+    /// Only decrypts tickets issued before the last rotation.
+    uint8_t previous[kKeysSize];
+    bool has_previous;
+  };
+
+  /// Fetches the keys of the current period from \a store, and fails if
+  /// the store does.
+  static absl::StatusOr<grpc_core::OrphanablePtr<SslTicketKeyRing>> Create(
+      grpc_core::RefCountedPtr<SslSessionStore> store,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+
+  SslTicketKeyRing(
+      grpc_core::RefCountedPtr<SslSessionStore> store,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+
+  void Orphan() override;
+
+  /// Copies the keys in use to \a keys.
+  void Get(Keys* keys) const;
+
+ private:
+  static constexpr size_t kNumWords = 2 * kKeysSize / sizeof(uint64_t);
+
+  void Install(const SslSessionStore::TicketKeys& keys);
+  void ScheduleLocked(absl::Time time, void (SslTicketKeyRing::*callback)())
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void FetchNextKeys();
+  void InstallNextKeys();
+
+  const grpc_core::RefCountedPtr<SslSessionStore> store_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  grpc_core::Mutex mu_;
+  bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      timer_handle_ ABSL_GUARDED_BY(mu_);
+  // When the keys in use stop encrypting new tickets.
+  absl::Time rotation_time_ ABSL_GUARDED_BY(mu_);
+  // The keys of the next period, once fetched.
+  std::optional<SslSessionStore::TicketKeys> next_keys_ ABSL_GUARDED_BY(mu_);
+  // The keys in use, read by Get() without a lock: the current keys
+  // followed by the previous ones.  seq_ is odd while they are replaced.
+  std::atomic<uint32_t> seq_{0};
+  std::atomic<uint64_t> words_[kNumWords] = {};
+  std::atomic<bool> has_previous_{false};
+};
+
+/// Creates a store that keeps one file per entry in \a directory, which
+/// must already exist and should only be accessible to the server's user
+/// since it holds ticket keys. Point it at a tmpfs such as /dev/shm to share
+/// state between worker processes without touching disk, or at persistent
+/// storage to also survive host reboots.
+///
+/// Files are created readable by their owner only, and files that others
+/// can read are ignored. Ticket keys rotate every \a ticket_key_rotation_period
+/// of wall-clock time, so that processes sharing the store rotate together.
+///
+/// Returns null on platforms without POSIX file permissions.
+grpc_core::RefCountedPtr<SslSessionStore> CreateFileSslSessionStore(
+    std::string directory,
+    grpc_core::Duration ticket_key_rotation_period =
+        grpc_core::Duration::Hours(12));
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_SESSION_STORE_H
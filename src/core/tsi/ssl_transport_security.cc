@@ -51,11 +51,35 @@
 #include <openssl/crypto.h>  // For OPENSSL_free
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#if !defined(OPENSSL_IS_BORINGSSL) && OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
+
+// Offloading record protection to the kernel needs the TLS 1.3 traffic
+// secrets, which only BoringSSL exposes, and Linux kernel TLS.
+#if defined(GPR_LINUX) && defined(OPENSSL_IS_BORINGSSL) && \
+    defined(__has_include)
+#if __has_include(<linux/tls.h>)
+#include <errno.h>
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <openssl/digest.h>
+#include <openssl/hkdf.h>
+#include <openssl/mem.h>
+#define TSI_SSL_KERNEL_TLS_SUPPORTED
+#endif
+#endif
+
 #include <memory>
 #include <optional>
 #include <string>
@@ -65,11 +89,13 @@
 #include "src/core/credentials/transport/tls/spiffe_utils.h"
 #include "src/core/credentials/transport/tls/ssl_utils.h"
 #include "src/core/lib/debug/trace_impl.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/surface/init.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_store.h"
 #include "src/core/tsi/ssl_telemetry_utils.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
@@ -79,6 +105,7 @@
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/match.h"
 #include "src/core/util/memory.h"
+#include "src/core/util/orphanable.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/status_helper.h"
@@ -191,6 +218,8 @@ struct tsi_ssl_server_handshaker_factory {
 #if defined(OPENSSL_IS_BORINGSSL)
   std::shared_ptr<grpc_core::CertificateSelector> certificate_selector;
 #endif  // defined(OPENSSL_IS_BORINGSSL)
+  // Provides the session ticket keys, if set.
+  grpc_core::OrphanablePtr<tsi::SslTicketKeyRing> ticket_key_ring;
 };
 
 // Tracks the arguments for a pending call to tsi_handshaker_next().
@@ -279,6 +308,8 @@ struct tsi_ssl_handshaker : public tsi_handshaker,
   std::string target;
   std::string locality;
   std::string backend_service;
+  // Whether a cached session was offered to the server for resumption.
+  bool session_offered = false;
   bool metric_recorded ABSL_GUARDED_BY(mu) = false;
 
   void MaybeRecordTelemetry(const SslHandshakeResult& handshake_result)
@@ -347,6 +378,14 @@ void tsi_ssl_handshaker::MaybeRecordTelemetry(
         backend_service);
     storage->Increment(
         grpc_core::TlsClientHandshakeTelemetryDomain::kHandshakes);
+    // A full handshake despite an offered session usually means that the
+    // server lost its session ticket keys, e.g. when it was restarted.
+    if (session_offered &&
+        result == grpc_core::TlsTelemetryHandshakeResult::kSuccess &&
+        resumed == "false") {
+      storage->Increment(grpc_core::TlsClientHandshakeTelemetryDomain::
+                             kRejectedSessionResumptions);
+    }
   } else {
     auto storage = grpc_core::TlsServerHandshakeTelemetryDomain::GetStorage(
         collection_scope, status_str, resumed);
@@ -366,6 +405,8 @@ struct tsi_ssl_frame_protector {
   unsigned char* buffer;
   size_t buffer_size;
   size_t buffer_offset;
+  // Set once outgoing records are protected by the kernel rather than by ssl.
+  bool protect_offloaded_to_kernel;
   // Ensures that protect, protect_flush, and unprotect are not called
   // concurrently.
   gpr_mu mu;
@@ -562,7 +603,12 @@ static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
 static int g_ssl_ctx_ex_factory_index = -1;
 static int g_ssl_ctx_ex_crl_provider_index = -1;
 static int g_ssl_ctx_ex_spiffe_bundle_map_index = -1;
+static int g_ssl_ctx_ex_ticket_key_ring_index = -1;
 static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
+// Layout of the session ticket keys taken from a tsi::SslTicketKeyRing: a 16
+// byte key name followed by 16 byte HMAC and AES keys.
+static const size_t kSslTicketKeyNameSize = 16;
+static const size_t kSslTicketHmacKeySize = 16;
 static int g_ssl_ex_verified_root_cert_index = -1;
 static int g_ssl_ex_handshaker_index = -1;
 
@@ -960,6 +1006,10 @@ static void init_openssl(void) {
       SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
   GRPC_CHECK_NE(g_ssl_ctx_ex_spiffe_bundle_map_index, -1);
 
+  g_ssl_ctx_ex_ticket_key_ring_index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  GRPC_CHECK_NE(g_ssl_ctx_ex_ticket_key_ring_index, -1);
+
   g_ssl_ex_verified_root_cert_index = SSL_get_ex_new_index(
       0, nullptr, nullptr, nullptr, verified_root_cert_free);
   GRPC_CHECK_NE(g_ssl_ex_verified_root_cert_index, -1);
@@ -2132,6 +2182,10 @@ static tsi_result ssl_protector_protect(tsi_frame_protector* self,
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
   gpr_mu_lock(&impl->mu);
+  if (impl->protect_offloaded_to_kernel) {
+    gpr_mu_unlock(&impl->mu);
+    return TSI_FAILED_PRECONDITION;
+  }
   tsi_result result = tsi::SslProtectorProtect(
       unprotected_bytes, impl->buffer_size, impl->buffer_offset, impl->buffer,
       impl->ssl, impl->network_io, unprotected_bytes_size,
@@ -2146,6 +2200,10 @@ static tsi_result ssl_protector_protect_flush(
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
   gpr_mu_lock(&impl->mu);
+  if (impl->protect_offloaded_to_kernel) {
+    gpr_mu_unlock(&impl->mu);
+    return TSI_FAILED_PRECONDITION;
+  }
   tsi_result result = tsi::SslProtectorProtectFlush(
       impl->buffer_offset, impl->buffer, impl->ssl, impl->network_io,
       protected_output_frames, protected_output_frames_size,
@@ -2164,10 +2222,150 @@ static tsi_result ssl_protector_unprotect(
   tsi_result result = tsi::SslProtectorUnprotect(
       protected_frames_bytes, impl->ssl, impl->network_io,
       protected_frames_bytes_size, unprotected_bytes, unprotected_bytes_size);
+  if (result == TSI_OK && impl->protect_offloaded_to_kernel &&
+      BIO_pending(impl->network_io) > 0) {
+    // ssl wants to answer the peer (a KeyUpdate request or an alert), but its
+    // write state no longer matches the record sequence of the kernel, so the
+    // reply cannot be sent. Fail the connection instead of diverging.
+    LOG(ERROR) << "Peer message needs a reply that cannot be protected once "
+                  "writes are offloaded to kernel TLS.";
+    result = TSI_PROTOCOL_FAILURE;
+  }
   gpr_mu_unlock(&impl->mu);
   return result;
 }
 
+#ifdef TSI_SSL_KERNEL_TLS_SUPPORTED
+
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+
+namespace {
+
+// HKDF-Expand-Label (RFC 8446, section 7.1) with an empty context.
+bool Tls13HkdfExpandLabel(const EVP_MD* digest,
+                          bssl::Span<const uint8_t> secret,
+                          absl::string_view label, uint8_t* out,
+                          size_t out_len) {
+  constexpr absl::string_view kLabelPrefix = "tls13 ";
+  std::vector<uint8_t> info;
+  info.reserve(4 + kLabelPrefix.size() + label.size());
+  info.push_back(static_cast<uint8_t>(out_len >> 8));
+  info.push_back(static_cast<uint8_t>(out_len));
+  info.push_back(static_cast<uint8_t>(kLabelPrefix.size() + label.size()));
+  info.insert(info.end(), kLabelPrefix.begin(), kLabelPrefix.end());
+  info.insert(info.end(), label.begin(), label.end());
+  info.push_back(0);
+  return HKDF_expand(out, out_len, digest, secret.data(), secret.size(),
+                     info.data(), info.size()) == 1;
+}
+
+// Derives the write key and IV of a TLS 1.3 AES-GCM connection from its
+// write traffic secret and installs them, with the next record sequence
+// number, as the TLS_TX state of fd. CryptoInfo is one of the kernel's
+// tls12_crypto_info_aes_gcm_* structs, which TLS 1.3 shares.
+template <typename CryptoInfo>
+tsi_result InstallKernelTlsTx(int fd, SSL* ssl, const EVP_MD* digest,
+                              bssl::Span<const uint8_t> write_secret,
+                              uint16_t cipher_type) {
+  CryptoInfo crypto_info;
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  crypto_info.info.version = TLS_1_3_VERSION;
+  crypto_info.info.cipher_type = cipher_type;
+  // The 12 byte TLS 1.3 IV is split into the kernel's salt and IV.
+  uint8_t iv[sizeof(crypto_info.salt) + sizeof(crypto_info.iv)];
+  if (!Tls13HkdfExpandLabel(digest, write_secret, "key", crypto_info.key,
+                            sizeof(crypto_info.key)) ||
+      !Tls13HkdfExpandLabel(digest, write_secret, "iv", iv, sizeof(iv))) {
+    OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+    return TSI_INTERNAL_ERROR;
+  }
+  memcpy(crypto_info.salt, iv, sizeof(crypto_info.salt));
+  memcpy(crypto_info.iv, iv + sizeof(crypto_info.salt),
+         sizeof(crypto_info.iv));
+  OPENSSL_cleanse(iv, sizeof(iv));
+  uint64_t sequence = SSL_get_write_sequence(ssl);
+  for (size_t i = sizeof(crypto_info.rec_seq); i > 0; --i) {
+    crypto_info.rec_seq[i - 1] = static_cast<uint8_t>(sequence);
+    sequence >>= 8;
+  }
+  tsi_result result = TSI_OK;
+  // A socket with the tls ULP attached but no TLS_TX state still sends
+  // plaintext as is, so failing after the first call leaves it usable by the
+  // userspace protector.
+  if (setsockopt(fd, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    VLOG(2) << "Kernel TLS unavailable on fd " << fd << ": "
+            << strerror(errno);
+    result = TSI_UNIMPLEMENTED;
+  } else if (setsockopt(fd, SOL_TLS, TLS_TX, &crypto_info,
+                        sizeof(crypto_info)) != 0) {
+    VLOG(2) << "Installing kernel TLS write keys on fd " << fd
+            << " failed: " << strerror(errno);
+    result = TSI_UNIMPLEMENTED;
+  }
+  OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+  return result;
+}
+
+tsi_result OffloadSslProtectToKernelLocked(tsi_ssl_frame_protector* impl,
+                                           int fd) {
+  if (impl->protect_offloaded_to_kernel) return TSI_FAILED_PRECONDITION;
+  // Records ssl has already produced would be reordered with respect to the
+  // ones the kernel produces.
+  if (impl->buffer_offset != 0 || BIO_pending(impl->network_io) > 0) {
+    return TSI_FAILED_PRECONDITION;
+  }
+  if (SSL_version(impl->ssl) != TLS1_3_VERSION) return TSI_UNIMPLEMENTED;
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(impl->ssl);
+  bssl::Span<const uint8_t> read_secret;
+  bssl::Span<const uint8_t> write_secret;
+  if (cipher == nullptr ||
+      !bssl::SSL_get_traffic_secrets(impl->ssl, &read_secret,
+                                     &write_secret)) {
+    return TSI_UNIMPLEMENTED;
+  }
+  tsi_result result;
+  switch (SSL_CIPHER_get_protocol_id(cipher)) {
+    case 0x1301:  // TLS_AES_128_GCM_SHA256
+      result = InstallKernelTlsTx<tls12_crypto_info_aes_gcm_128>(
+          fd, impl->ssl, EVP_sha256(), write_secret, TLS_CIPHER_AES_GCM_128);
+      break;
+    case 0x1302:  // TLS_AES_256_GCM_SHA384
+      result = InstallKernelTlsTx<tls12_crypto_info_aes_gcm_256>(
+          fd, impl->ssl, EVP_sha384(), write_secret, TLS_CIPHER_AES_GCM_256);
+      break;
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  if (result == TSI_OK) impl->protect_offloaded_to_kernel = true;
+  return result;
+}
+
+}  // namespace
+
+#endif  // TSI_SSL_KERNEL_TLS_SUPPORTED
+
+// Only the write direction is offloaded: ssl keeps decrypting incoming
+// records, which lets it process post-handshake messages such as session
+// tickets and KeyUpdates without the kernel's control message interface.
+static tsi_result ssl_protector_offload_protect_to_kernel(
+    [[maybe_unused]] tsi_frame_protector* self, [[maybe_unused]] int fd) {
+#ifdef TSI_SSL_KERNEL_TLS_SUPPORTED
+  tsi_ssl_frame_protector* impl =
+      reinterpret_cast<tsi_ssl_frame_protector*>(self);
+  gpr_mu_lock(&impl->mu);
+  tsi_result result = OffloadSslProtectToKernelLocked(impl, fd);
+  gpr_mu_unlock(&impl->mu);
+  return result;
+#else
+  return TSI_UNIMPLEMENTED;
+#endif
+}
+
 static void ssl_protector_destroy(tsi_frame_protector* self) {
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
@@ -2183,6 +2381,7 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_protect_flush,
     ssl_protector_unprotect,
     ssl_protector_destroy,
+    ssl_protector_offload_protect_to_kernel,
 };
 
 // --- tsi_server_handshaker_factory methods implementation. ---
@@ -2882,17 +3081,19 @@ static const tsi_handshaker_vtable handshaker_vtable = {
 
 // --- tsi_ssl_handshaker_factory common methods. ---
 
-static void tsi_ssl_handshaker_resume_session(
+// Returns true if a cached session was set on \a ssl.
+static bool tsi_ssl_handshaker_resume_session(
     SSL* ssl, tsi::SslSessionLRUCache* session_cache) {
   const char* server_name = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
   if (server_name == nullptr) {
-    return;
+    return false;
   }
   tsi::SslSessionPtr session = session_cache->Get(server_name);
-  if (session != nullptr) {
-    // SSL_set_session internally increments reference counter.
-    SSL_set_session(ssl, session.get());
+  if (session == nullptr) {
+    return false;
   }
+  // SSL_set_session internally increments reference counter.
+  return SSL_set_session(ssl, session.get()) == 1;
 }
 
 static tsi_result create_tsi_ssl_handshaker(
@@ -2960,6 +3161,7 @@ static tsi_result create_tsi_ssl_handshaker(
     }
   }
 #endif  // TSI_OPENSSL_ALPN_SUPPORT
+  bool session_offered = false;
   if (is_client) {
     int ssl_result;
     SSL_set_connect_state(ssl);
@@ -2978,8 +3180,8 @@ static tsi_result create_tsi_ssl_handshaker(
     tsi_ssl_client_handshaker_factory* client_factory =
         reinterpret_cast<tsi_ssl_client_handshaker_factory*>(factory);
     if (client_factory->session_cache != nullptr) {
-      tsi_ssl_handshaker_resume_session(ssl,
-                                        client_factory->session_cache.get());
+      session_offered = tsi_ssl_handshaker_resume_session(
+          ssl, client_factory->session_cache.get());
     }
     ERR_clear_error();
     ssl_result = SSL_do_handshake(ssl);
@@ -3001,6 +3203,7 @@ static tsi_result create_tsi_ssl_handshaker(
       tsi_ssl_handshaker_factory_ref(factory), std::move(collection_scope),
       is_client, std::move(key_signer), std::move(target), std::move(locality),
       std::move(backend_service));
+  impl->session_offered = session_offered;
   *handshaker = impl;
 
   if (!SSL_set_ex_data(ssl, g_ssl_ex_handshaker_index, impl)) {
@@ -3493,6 +3696,76 @@ tsi_result tsi_create_ssl_server_handshaker_factory_ex(
                                                                factory);
 }
 
+#if !defined(OPENSSL_IS_BORINGSSL) && OPENSSL_VERSION_NUMBER >= 0x30000000L
+using TicketHmacCtx = EVP_MAC_CTX;
+#else
+using TicketHmacCtx = HMAC_CTX;
+#endif
+
+static bool init_ticket_hmac(TicketHmacCtx* hmac_ctx, const char* key) {
+#if !defined(OPENSSL_IS_BORINGSSL) && OPENSSL_VERSION_NUMBER >= 0x30000000L
+  OSSL_PARAM params[] = {
+      OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                       const_cast<char*>("SHA256"), 0),
+      OSSL_PARAM_construct_end()};
+  return EVP_MAC_init(hmac_ctx, reinterpret_cast<const unsigned char*>(key),
+                      kSslTicketHmacKeySize, params) == 1;
+#else
+  return HMAC_Init_ex(hmac_ctx, key, kSslTicketHmacKeySize, EVP_sha256(),
+                      nullptr) == 1;
+#endif
+}
+
+// Encrypts session tickets with the current keys of the server's
+// tsi::SslTicketKeyRing, and decrypts them with the current or the previous
+// keys, so that tickets stay valid across one key rotation. Tickets issued
+// with the previous keys are renewed.
+static int ssl_server_ticket_key_callback(SSL* ssl, uint8_t* key_name,
+                                          uint8_t* iv,
+                                          EVP_CIPHER_CTX* cipher_ctx,
+                                          TicketHmacCtx* hmac_ctx,
+                                          int encrypt) {
+  auto* ring = static_cast<tsi::SslTicketKeyRing*>(SSL_CTX_get_ex_data(
+      SSL_get_SSL_CTX(ssl), g_ssl_ctx_ex_ticket_key_ring_index));
+  tsi::SslTicketKeyRing::Keys ticket_keys;
+  ring->Get(&ticket_keys);
+  const EVP_CIPHER* cipher = EVP_aes_128_cbc();
+  if (encrypt) {
+    const char* keys = reinterpret_cast<const char*>(ticket_keys.current);
+    memcpy(key_name, keys, kSslTicketKeyNameSize);
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(cipher)) != 1 ||
+        !init_ticket_hmac(hmac_ctx, keys + kSslTicketKeyNameSize) ||
+        EVP_EncryptInit_ex(cipher_ctx, cipher, nullptr,
+                           reinterpret_cast<const uint8_t*>(
+                               keys + kSslTicketKeyNameSize +
+                               kSslTicketHmacKeySize),
+                           iv) != 1) {
+      return -1;
+    }
+    return 1;
+  }
+  for (const uint8_t* key_bytes :
+       {ticket_keys.current,
+        ticket_keys.has_previous ? ticket_keys.previous : nullptr}) {
+    if (key_bytes == nullptr ||
+        CRYPTO_memcmp(key_name, key_bytes, kSslTicketKeyNameSize) != 0) {
+      continue;
+    }
+    const char* keys = reinterpret_cast<const char*>(key_bytes);
+    if (!init_ticket_hmac(hmac_ctx, keys + kSslTicketKeyNameSize) ||
+        EVP_DecryptInit_ex(cipher_ctx, cipher, nullptr,
+                           reinterpret_cast<const uint8_t*>(
+                               keys + kSslTicketKeyNameSize +
+                               kSslTicketHmacKeySize),
+                           iv) != 1) {
+      return -1;
+    }
+    return key_bytes == ticket_keys.current ? 1 : 2;
+  }
+  // Unknown key: the ticket is ignored and a full handshake follows.
+  return 0;
+}
+
 tsi_result tsi_configure_server_ssl_context(
     const tsi_ssl_server_handshaker_options* options,
     const grpc_core::PemKeyCertPair* pem_key_cert_pair,
@@ -3547,6 +3820,33 @@ tsi_result tsi_configure_server_ssl_context(
       LOG(ERROR) << "Invalid STEK size.";
       return TSI_INVALID_ARGUMENT;
     }
+  } else if (options->session_store != nullptr) {
+    // All the contexts of the factory share one ring.
+    if (impl->ticket_key_ring == nullptr) {
+      auto ring = tsi::SslTicketKeyRing::Create(
+          options->session_store,
+          grpc_event_engine::experimental::GetDefaultEventEngine());
+      if (ring.ok()) {
+        impl->ticket_key_ring = *std::move(ring);
+      } else {
+        // Fall back to per-process keys: clients can still resume sessions
+        // with this process, just not across restarts.
+        LOG(ERROR) << "Failed to get session ticket keys from the store: "
+                   << ring.status();
+      }
+    }
+    if (impl->ticket_key_ring != nullptr) {
+      SSL_CTX_set_ex_data(ssl_context.ssl_ctx,
+                          g_ssl_ctx_ex_ticket_key_ring_index,
+                          impl->ticket_key_ring.get());
+#if !defined(OPENSSL_IS_BORINGSSL) && OPENSSL_VERSION_NUMBER >= 0x30000000L
+      SSL_CTX_set_tlsext_ticket_key_evp_cb(ssl_context.ssl_ctx,
+                                           ssl_server_ticket_key_callback);
+#else
+      SSL_CTX_set_tlsext_ticket_key_cb(ssl_context.ssl_ctx,
+                                       ssl_server_ticket_key_callback);
+#endif
+    }
   }
   if (options->root_cert_info != nullptr) {
     grpc_core::Match(
@@ -35,6 +35,7 @@
 #include "src/core/credentials/transport/tls/spiffe_utils.h"
 #include "src/core/telemetry/metrics.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_store.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "src/core/util/ref_counted_ptr.h"
@@ -385,6 +386,11 @@ struct tsi_ssl_server_handshaker_options {
   const char* session_ticket_key;
   // session_ticket_key_size is a size of session ticket encryption key.
   size_t session_ticket_key_size;
+  // session_store, if set and session_ticket_key is not, provides the session
+  // ticket encryption keys. They are shared with every server using the same
+  // store, so that their tickets stay valid across restarts, and rotate
+  // periodically; tickets issued before the last rotation are still accepted.
+  grpc_core::RefCountedPtr<tsi::SslSessionStore> session_store;
   // The min and max TLS versions that will be negotiated by the handshaker.
   tsi_tls_version min_tls_version;
   tsi_tls_version max_tls_version;
@@ -23,6 +23,14 @@ TlsClientHandshakeTelemetryDomain::CounterHandle
         "grpc.client.tls.handshakes",
         "Total number of client-side TLS handshakes", "{handshake}");
 
+TlsClientHandshakeTelemetryDomain::CounterHandle
+    TlsClientHandshakeTelemetryDomain::kRejectedSessionResumptions =
+        RegisterCounter("grpc.client.tls.rejected_session_resumptions",
+                        "Number of client-side TLS handshakes that fell back "
+                        "to a full handshake although a cached session was "
+                        "offered",
+                        "{handshake}");
+
 TlsServerHandshakeTelemetryDomain::CounterHandle
     TlsServerHandshakeTelemetryDomain::kHandshakes = RegisterCounter(
         "grpc.server.tls.handshakes",
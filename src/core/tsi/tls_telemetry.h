@@ -29,6 +29,8 @@ class TlsClientHandshakeTelemetryDomain final
   static constexpr absl::string_view kName = "tls_client_security_handshaker";
 
   static CounterHandle kHandshakes;
+  // Successful full handshakes in which the client offered a cached session.
+  static CounterHandle kRejectedSessionResumptions;
 };
 
 class TlsServerHandshakeTelemetryDomain final
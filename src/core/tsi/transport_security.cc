@@ -126,6 +126,17 @@ tsi_result tsi_frame_protector_unprotect(
                                  unprotected_bytes_size);
 }
 
+tsi_result tsi_frame_protector_offload_protect_to_kernel(
+    tsi_frame_protector* self, int fd) {
+  if (self == nullptr || self->vtable == nullptr || fd < 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->offload_protect_to_kernel == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->offload_protect_to_kernel(self, fd);
+}
+
 void tsi_frame_protector_destroy(tsi_frame_protector* self) {
   if (self == nullptr) return;
   self->vtable->destroy(self);
@@ -47,6 +47,8 @@ struct tsi_frame_protector_vtable {
                           unsigned char* unprotected_bytes,
                           size_t* unprotected_bytes_size);
   void (*destroy)(tsi_frame_protector* self);
+  // May be null if the protector cannot hand record protection to the kernel.
+  tsi_result (*offload_protect_to_kernel)(tsi_frame_protector* self, int fd);
 };
 struct tsi_frame_protector {
   const tsi_frame_protector_vtable* vtable;
@@ -49,6 +49,23 @@ tsi_result tsi_zero_copy_grpc_protector_protect(
   return self->vtable->protect(self, unprotected_slices, protected_slices);
 }
 
+tsi_result tsi_zero_copy_grpc_protector_protect_parallel(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices, size_t max_parallelism,
+    tsi_zero_copy_grpc_protector_parallel_for parallel_for) {
+  if (self == nullptr || self->vtable == nullptr ||
+      unprotected_slices == nullptr || protected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->protect_parallel == nullptr || max_parallelism <= 1) {
+    return tsi_zero_copy_grpc_protector_protect(self, unprotected_slices,
+                                                protected_slices);
+  }
+  return self->vtable->protect_parallel(self, unprotected_slices,
+                                        protected_slices, max_parallelism,
+                                        parallel_for);
+}
+
 tsi_result tsi_zero_copy_grpc_protector_unprotect(
     tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
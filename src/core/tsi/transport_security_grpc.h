@@ -23,6 +23,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/tsi/transport_security.h"
+#include "absl/functional/function_ref.h"
 
 typedef grpc_slice (*tsi_zero_copy_grpc_protector_allocator_cb)(
     size_t size, void* user_data);
@@ -47,6 +48,21 @@ tsi_result tsi_zero_copy_grpc_protector_protect(
     tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices);
 
+// Runs seal(i) exactly once for every i in [0, n), possibly concurrently, and
+// returns once all calls have returned.
+using tsi_zero_copy_grpc_protector_parallel_for =
+    absl::FunctionRef<void(size_t n, absl::FunctionRef<void(size_t)> seal)>;
+
+// Same as tsi_zero_copy_grpc_protector_protect, but lets the protector seal
+// independent frames concurrently through parallel_for, using at most
+// max_parallelism concurrent calls. Protectors that cannot seal frames
+// independently protect sequentially without calling parallel_for.
+// - Cannot be called concurrently with tsi_zero_copy_grpc_protector_protect.
+tsi_result tsi_zero_copy_grpc_protector_protect_parallel(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices, size_t max_parallelism,
+    tsi_zero_copy_grpc_protector_parallel_for parallel_for);
+
 // Outputs unprotected bytes.
 // - protected_slices is the bytes of protected frames.
 // - unprotected_slices is the unprotected output data.
@@ -107,6 +123,11 @@ struct tsi_zero_copy_grpc_protector_vtable {
   void (*set_allocator)(tsi_zero_copy_grpc_protector* self,
                         tsi_zero_copy_grpc_protector_allocator_cb alloc_cb,
                         void* user_data);
+  // May be null, in which case protect is used.
+  tsi_result (*protect_parallel)(
+      tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+      grpc_slice_buffer* protected_slices, size_t max_parallelism,
+      tsi_zero_copy_grpc_protector_parallel_for parallel_for);
 };
 
 struct tsi_zero_copy_grpc_protector {
@@ -214,6 +214,22 @@ tsi_result tsi_frame_protector_unprotect(
     size_t* protected_frames_bytes_size, unsigned char* unprotected_bytes,
     size_t* unprotected_bytes_size);
 
+// Hands protection of outgoing records to the kernel TLS implementation of
+// the connected socket fd, so that plaintext written to fd is encrypted by
+// the kernel. Unprotect keeps working as before.
+// - Returns TSI_OK if the kernel took over; from then on the caller must
+//   write plaintext to fd and must not call tsi_frame_protector_protect or
+//   tsi_frame_protector_protect_flush again.
+// - Returns TSI_UNIMPLEMENTED if the protector, the negotiated cipher or the
+//   platform does not support it, or another error if installing the keys
+//   failed. In both cases the protector is left unchanged and the caller
+//   keeps protecting in userspace.
+//
+// Must be called before any data has been protected, and cannot be called
+// concurrently with any other method.
+tsi_result tsi_frame_protector_offload_protect_to_kernel(
+    tsi_frame_protector* self, int fd);
+
 // Destroys the tsi_frame_protector object.
 void tsi_frame_protector_destroy(tsi_frame_protector* self);
 
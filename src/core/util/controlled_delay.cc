@@ -0,0 +1,38 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/controlled_delay.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+namespace grpc_core {
+
+bool ControlledDelay::OnDequeue(Duration sojourn, Timestamp now) {
+  if (now >= interval_end_) {
+    // Start a new interval, deciding whether we are overloaded based on the
+    // smallest sojourn time seen during the one that just ended.  The very
+    // first interval has nothing to go on, so is never overloaded.
+    overloaded_ =
+        interval_end_ != Timestamp::InfPast() && min_sojourn_ > target_;
+    interval_end_ = now + interval_;
+    min_sojourn_ = sojourn;
+  } else {
+    min_sojourn_ = std::min(min_sojourn_, sojourn);
+  }
+  return ShouldShed(sojourn);
+}
+
+}  // namespace grpc_core
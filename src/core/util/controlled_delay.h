@@ -0,0 +1,67 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_CONTROLLED_DELAY_H
+#define GRPC_SRC_CORE_UTIL_CONTROLLED_DELAY_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Implements the overload detector from the CoDel (controlled delay) queue
+// management algorithm, in the simplified form commonly used for RPC queues:
+// the queue is overloaded if the minimum time items spent queued (their
+// sojourn time) over the last interval was above the target.  While
+// overloaded, items that have been queued for more than twice the target
+// should be shed rather than served.
+//
+// Not thread safe: callers must provide their own synchronization.
+class ControlledDelay {
+ public:
+  ControlledDelay(Duration target, Duration interval)
+      : target_(target), interval_(interval) {}
+
+  // Records that an item queued for `sojourn` is leaving the queue at `now`.
+  // Returns true if the item should be shed.
+  bool OnDequeue(Duration sojourn, Timestamp now);
+
+  // Records that the queue was found empty at `now`, which counts as a zero
+  // sojourn time for the current interval.
+  void OnQueueEmpty(Timestamp now) { OnDequeue(Duration::Zero(), now); }
+
+  // Returns true if an item queued for `sojourn` should be shed, without
+  // recording it.  Used to prune stale items from the head of the queue.
+  bool ShouldShed(Duration sojourn) const {
+    return overloaded_ && sojourn > shed_threshold();
+  }
+
+  // True if the queue was overloaded as of the end of the last interval.
+  bool overloaded() const { return overloaded_; }
+  Duration target() const { return target_; }
+  Duration interval() const { return interval_; }
+  Duration shed_threshold() const { return target_ * 2; }
+
+ private:
+  const Duration target_;
+  const Duration interval_;
+  Timestamp interval_end_ = Timestamp::InfPast();
+  Duration min_sojourn_ = Duration::Zero();
+  bool overloaded_ = false;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_CONTROLLED_DELAY_H
@@ -17,8 +17,12 @@
 #include <grpc/support/json.h>
 #include <grpc/support/port_platform.h>
 
+#include <cstdint>
+#include <string>
 #include <utility>
 
+#include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/strip.h"
@@ -26,6 +30,14 @@
 namespace grpc_core {
 namespace json_detail {
 
+using Token = JsonTokenReader::Token;
+
+void LoaderInterface::LoadFromTokens(JsonTokenReader* reader, Token first,
+                                     const JsonArgs& args, void* dst,
+                                     ValidationErrors* errors) const {
+  LoadInto(reader->ReadValue(first), args, dst, errors);
+}
+
 void LoadScalar::LoadInto(const Json& json, const JsonArgs& /*args*/, void* dst,
                           ValidationErrors* errors) const {
   // We accept either kString or kNumber for numeric values, as per
@@ -39,6 +51,18 @@ void LoadScalar::LoadInto(const Json& json, const JsonArgs& /*args*/, void* dst,
   return LoadInto(json.string(), dst, errors);
 }
 
+void LoadScalar::LoadFromTokens(JsonTokenReader* reader, Token first,
+                                const JsonArgs& /*args*/, void* dst,
+                                ValidationErrors* errors) const {
+  if (first != Token::kString && (!IsNumber() || first != Token::kNumber)) {
+    errors->AddError(
+        absl::StrCat("is not a ", IsNumber() ? "number" : "string"));
+    reader->SkipValue(first);
+    return;
+  }
+  return LoadInto(reader->value(), dst, errors);
+}
+
 bool LoadString::IsNumber() const { return false; }
 
 void LoadString::LoadInto(const std::string& value, void* dst,
@@ -99,6 +123,17 @@ void LoadBool::LoadInto(const Json& json, const JsonArgs&, void* dst,
   *static_cast<bool*>(dst) = json.boolean();
 }
 
+void LoadBool::LoadFromTokens(JsonTokenReader* reader, Token first,
+                              const JsonArgs&, void* dst,
+                              ValidationErrors* errors) const {
+  if (first != Token::kTrue && first != Token::kFalse) {
+    errors->AddError("is not a boolean");
+    reader->SkipValue(first);
+    return;
+  }
+  *static_cast<bool*>(dst) = first == Token::kTrue;
+}
+
 void LoadUnprocessedJsonObject::LoadInto(const Json& json, const JsonArgs&,
                                          void* dst,
                                          ValidationErrors* errors) const {
@@ -134,6 +169,24 @@ void LoadVector::LoadInto(const Json& json, const JsonArgs& args, void* dst,
   }
 }
 
+void LoadVector::LoadFromTokens(JsonTokenReader* reader, Token first,
+                                const JsonArgs& args, void* dst,
+                                ValidationErrors* errors) const {
+  if (first != Token::kArrayBegin) {
+    errors->AddError("is not an array");
+    reader->SkipValue(first);
+    return;
+  }
+  const LoaderInterface* element_loader = ElementLoader();
+  for (size_t i = 0;; ++i) {
+    Token token = reader->Next();
+    if (token == Token::kArrayEnd || token == Token::kError) return;
+    ValidationErrors::ScopedField field(errors, absl::StrCat("[", i, "]"));
+    void* element = EmplaceBack(dst);
+    element_loader->LoadFromTokens(reader, token, args, element, errors);
+  }
+}
+
 void AutoLoader<std::vector<bool>>::LoadInto(const Json& json,
                                              const JsonArgs& args, void* dst,
                                              ValidationErrors* errors) const {
@@ -152,6 +205,26 @@ void AutoLoader<std::vector<bool>>::LoadInto(const Json& json,
   }
 }
 
+void AutoLoader<std::vector<bool>>::LoadFromTokens(
+    JsonTokenReader* reader, Token first, const JsonArgs& args, void* dst,
+    ValidationErrors* errors) const {
+  if (first != Token::kArrayBegin) {
+    errors->AddError("is not an array");
+    reader->SkipValue(first);
+    return;
+  }
+  const LoaderInterface* element_loader = LoaderForType<bool>();
+  std::vector<bool>* vec = static_cast<std::vector<bool>*>(dst);
+  for (size_t i = 0;; ++i) {
+    Token token = reader->Next();
+    if (token == Token::kArrayEnd || token == Token::kError) return;
+    ValidationErrors::ScopedField field(errors, absl::StrCat("[", i, "]"));
+    bool elem = false;
+    element_loader->LoadFromTokens(reader, token, args, &elem, errors);
+    vec->push_back(elem);
+  }
+}
+
 void LoadMap::LoadInto(const Json& json, const JsonArgs& args, void* dst,
                        ValidationErrors* errors) const {
   if (json.type() != Json::Type::kObject) {
@@ -162,11 +235,36 @@ void LoadMap::LoadInto(const Json& json, const JsonArgs& args, void* dst,
   for (const auto& [key, value] : json.object()) {
     ValidationErrors::ScopedField field(errors,
                                         absl::StrCat("[\"", key, "\"]"));
-    void* element = Insert(key, dst);
+    void* element = Insert(key, dst).first;
     element_loader->LoadInto(value, args, element, errors);
   }
 }
 
+void LoadMap::LoadFromTokens(JsonTokenReader* reader, Token first,
+                             const JsonArgs& args, void* dst,
+                             ValidationErrors* errors) const {
+  if (first != Token::kObjectBegin) {
+    errors->AddError("is not an object");
+    reader->SkipValue(first);
+    return;
+  }
+  const LoaderInterface* element_loader = ElementLoader();
+  // Anything but a key is the end of the object or an error.
+  while (reader->Next() == Token::kKey) {
+    // The map itself tells whether the key is a duplicate.
+    auto [element, inserted] = Insert(reader->value(), dst);
+    if (!inserted) {
+      reader->ReportDuplicateKey();
+      reader->SkipValue(reader->Next());
+      continue;
+    }
+    ValidationErrors::ScopedField field(
+        errors, absl::StrCat("[\"", reader->value(), "\"]"));
+    element_loader->LoadFromTokens(reader, reader->Next(), args, element,
+                                   errors);
+  }
+}
+
 void LoadWrapped::LoadInto(const Json& json, const JsonArgs& args, void* dst,
                            ValidationErrors* errors) const {
   void* element = Emplace(dst);
@@ -175,6 +273,15 @@ void LoadWrapped::LoadInto(const Json& json, const JsonArgs& args, void* dst,
   if (errors->size() > starting_error_size) Reset(dst);
 }
 
+void LoadWrapped::LoadFromTokens(JsonTokenReader* reader, Token first,
+                                 const JsonArgs& args, void* dst,
+                                 ValidationErrors* errors) const {
+  void* element = Emplace(dst);
+  size_t starting_error_size = errors->size();
+  ElementLoader()->LoadFromTokens(reader, first, args, element, errors);
+  if (errors->size() > starting_error_size) Reset(dst);
+}
+
 bool LoadObject(const Json& json, const JsonArgs& args, const Element* elements,
                 size_t num_elements, void* dst, ValidationErrors* errors) {
   if (json.type() != Json::Type::kObject) {
@@ -200,6 +307,72 @@ bool LoadObject(const Json& json, const JsonArgs& args, const Element* elements,
   return true;
 }
 
+bool LoadObjectFromTokens(JsonTokenReader* reader, Token first,
+                          const JsonArgs& args, const Element* elements,
+                          size_t num_elements, void* dst,
+                          ValidationErrors* errors) {
+  if (first != Token::kObjectBegin) {
+    errors->AddError("is not an object");
+    reader->SkipValue(first);
+    return false;
+  }
+  // Whether the key of each element was seen, and if so, whether its
+  // value was loaded.  This is enough to detect duplicates of these keys.
+  enum class Present : uint8_t { kNo, kNull, kLoaded };
+  absl::InlinedVector<Present, 16> present(num_elements, Present::kNo);
+  // Only the keys that match no element are kept to detect their
+  // duplicates; the set does not allocate until there is one.
+  absl::flat_hash_set<std::string> unknown_keys;
+  while (true) {
+    Token token = reader->Next();
+    if (token == Token::kObjectEnd) break;
+    if (token == Token::kError) return false;
+    size_t i = 0;
+    for (; i < num_elements; ++i) {
+      const Element& element = elements[i];
+      if (reader->value() == element.name &&
+          (element.enable_key == nullptr ||
+           args.IsEnabled(element.enable_key))) {
+        break;
+      }
+    }
+    const bool duplicate = i == num_elements
+                               ? !unknown_keys.insert(reader->value()).second
+                               : present[i] != Present::kNo;
+    if (duplicate) {
+      reader->ReportDuplicateKey();
+      reader->SkipValue(reader->Next());
+      continue;
+    }
+    token = reader->Next();
+    if (i == num_elements) {
+      reader->SkipValue(token);
+      continue;
+    }
+    if (token == Token::kNull) {
+      present[i] = Present::kNull;
+      continue;
+    }
+    const Element& element = elements[i];
+    present[i] = Present::kLoaded;
+    ValidationErrors::ScopedField field(errors,
+                                        absl::StrCat(".", element.name));
+    char* field_dst = static_cast<char*>(dst) + element.member_offset;
+    element.loader->LoadFromTokens(reader, token, args, field_dst, errors);
+  }
+  for (size_t i = 0; i < num_elements; ++i) {
+    const Element& element = elements[i];
+    if (present[i] == Present::kLoaded || element.optional) continue;
+    if (element.enable_key != nullptr && !args.IsEnabled(element.enable_key)) {
+      continue;
+    }
+    ValidationErrors::ScopedField field(errors,
+                                        absl::StrCat(".", element.name));
+    errors->AddError("field not present");
+  }
+  return true;
+}
+
 const Json* GetJsonObjectField(const Json::Object& json,
                                absl::string_view field,
                                ValidationErrors* errors, bool required) {
@@ -211,5 +384,16 @@ const Json* GetJsonObjectField(const Json::Object& json,
   return &it->second;
 }
 
+absl::Status LoadFromJsonString(absl::string_view json_str,
+                                const JsonArgs& args,
+                                const LoaderInterface* loader, void* dst,
+                                ValidationErrors* errors) {
+  JsonTokenReader reader(json_str);
+  loader->LoadFromTokens(&reader, reader.Next(), args, dst, errors);
+  // Read any trailing input.
+  reader.Next();
+  return reader.status();
+}
+
 }  // namespace json_detail
 }  // namespace grpc_core
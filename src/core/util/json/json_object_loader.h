@@ -23,10 +23,13 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_reader.h"
 #include "src/core/util/no_destruct.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/time.h"
@@ -69,6 +72,12 @@
 //   };
 // Now we can load Foo objects from JSON:
 //   absl::StatusOr<Foo> foo = LoadFromJson<Foo>(json);
+// or directly from a JSON string, without first parsing it into a Json:
+//   absl::StatusOr<Foo> foo = LoadFromJsonString<Foo>(json_string);
+// LoadFromJsonString() still builds a Json for the values whose loaders need
+// one, such as objects whose JsonPostLoad() takes the source JSON. If the
+// post-processing does not need it, declare JsonPostLoad() as:
+//     void JsonPostLoad(const JsonArgs& args, ValidationErrors* errors);
 namespace grpc_core {
 
 namespace json_detail {
@@ -81,6 +90,14 @@ class LoaderInterface {
   virtual void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                         ValidationErrors* errors) const = 0;
 
+  // Like LoadInto(), but reads the value from reader.  first is the value's
+  // first token, already read from reader.  The default implementation
+  // reads the value into a Json and calls LoadInto().
+  virtual void LoadFromTokens(JsonTokenReader* reader,
+                              JsonTokenReader::Token first,
+                              const JsonArgs& args, void* dst,
+                              ValidationErrors* errors) const;
+
  protected:
   ~LoaderInterface() = default;
 };
@@ -90,6 +107,9 @@ class LoadScalar : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override;
 
  protected:
   ~LoadScalar() = default;
@@ -198,6 +218,9 @@ class LoadBool : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& /*args*/, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override;
 
  protected:
   ~LoadBool() = default;
@@ -228,6 +251,9 @@ class LoadVector : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override;
 
  protected:
   ~LoadVector() = default;
@@ -242,12 +268,17 @@ class LoadMap : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override;
 
  protected:
   ~LoadMap() = default;
 
  private:
-  virtual void* Insert(const std::string& name, void* dst) const = 0;
+  // Returns the element for name, and whether it was newly inserted.
+  virtual std::pair<void*, bool> Insert(const std::string& name,
+                                        void* dst) const = 0;
   virtual const LoaderInterface* ElementLoader() const = 0;
 };
 
@@ -256,6 +287,9 @@ class LoadWrapped : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override;
 
  protected:
   ~LoadWrapped() = default;
@@ -281,6 +315,11 @@ class AutoLoader final : public LoaderInterface {
                 ValidationErrors* errors) const override {
     T::JsonLoader(args)->LoadInto(json, args, dst, errors);
   }
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override {
+    T::JsonLoader(args)->LoadFromTokens(reader, first, args, dst, errors);
+  }
 
  private:
   ~AutoLoader() = default;
@@ -367,6 +406,9 @@ class AutoLoader<std::vector<bool>> final : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override;
 
  private:
   ~AutoLoader() = default;
@@ -376,10 +418,11 @@ class AutoLoader<std::vector<bool>> final : public LoaderInterface {
 template <typename T, typename C>
 class AutoLoader<std::map<std::string, T, C>> final : public LoadMap {
  private:
-  void* Insert(const std::string& name, void* dst) const final {
-    return &static_cast<std::map<std::string, T, C>*>(dst)
-                ->emplace(name, T())
-                .first->second;
+  std::pair<void*, bool> Insert(const std::string& name,
+                                void* dst) const final {
+    auto [it, inserted] =
+        static_cast<std::map<std::string, T, C>*>(dst)->emplace(name, T());
+    return {&it->second, inserted};
   };
   const LoaderInterface* ElementLoader() const final {
     return LoaderForType<T>();
@@ -507,6 +550,22 @@ class Vec<T, 0> {
 // Returns false if the JSON object was not of type Json::Type::kObject.
 bool LoadObject(const Json& json, const JsonArgs& args, const Element* elements,
                 size_t num_elements, void* dst, ValidationErrors* errors);
+// Like LoadObject(), but reads the object from reader.  Each key is loaded
+// into the first enabled element with that name.
+// Returns false if the value was not an object or was not valid JSON.
+bool LoadObjectFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                          const JsonArgs& args, const Element* elements,
+                          size_t num_elements, void* dst,
+                          ValidationErrors* errors);
+
+// Whether T::JsonPostLoad() takes the source JSON.
+template <typename T, typename = void>
+struct JsonPostLoadNeedsSource : std::true_type {};
+template <typename T>
+struct JsonPostLoadNeedsSource<
+    T, absl::void_t<decltype(std::declval<T&>().JsonPostLoad(
+           std::declval<const JsonArgs&>(),
+           std::declval<ValidationErrors*>()))>> : std::false_type {};
 
 // Adaptor type - takes a compile time computed list of elements and
 // implements LoaderInterface by calling LoadObject.
@@ -521,6 +580,13 @@ class FinishedJsonObjectLoader final : public LoaderInterface {
     LoadObject(json, args, elements_.data(), elements_.size(), dst, errors);
   }
 
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override {
+    LoadObjectFromTokens(reader, first, args, elements_.data(),
+                         elements_.size(), dst, errors);
+  }
+
  private:
   GPR_NO_UNIQUE_ADDRESS Vec<Element, kElemCount> elements_;
 };
@@ -539,7 +605,22 @@ class FinishedJsonObjectLoader<T, kElemCount,
     // Call JsonPostLoad() only if json is a JSON object.
     if (LoadObject(json, args, elements_.data(), elements_.size(), dst,
                    errors)) {
-      static_cast<T*>(dst)->JsonPostLoad(json, args, errors);
+      if constexpr (JsonPostLoadNeedsSource<T>::value) {
+        static_cast<T*>(dst)->JsonPostLoad(json, args, errors);
+      } else {
+        static_cast<T*>(dst)->JsonPostLoad(args, errors);
+      }
+    }
+  }
+
+  void LoadFromTokens(JsonTokenReader* reader, JsonTokenReader::Token first,
+                      const JsonArgs& args, void* dst,
+                      ValidationErrors* errors) const override {
+    if constexpr (JsonPostLoadNeedsSource<T>::value) {
+      LoaderInterface::LoadFromTokens(reader, first, args, dst, errors);
+    } else if (LoadObjectFromTokens(reader, first, args, elements_.data(),
+                                    elements_.size(), dst, errors)) {
+      static_cast<T*>(dst)->JsonPostLoad(args, errors);
     }
   }
 
@@ -594,6 +675,13 @@ const Json* GetJsonObjectField(const Json::Object& json,
                                absl::string_view field,
                                ValidationErrors* errors, bool required);
 
+// Loads json_str into dst with loader.  Returns the JsonParse() error if
+// json_str is not valid JSON, in which case dst and errors are unspecified.
+absl::Status LoadFromJsonString(absl::string_view json_str,
+                                const JsonArgs& args,
+                                const LoaderInterface* loader, void* dst,
+                                ValidationErrors* errors);
+
 }  // namespace json_detail
 
 template <typename T>
@@ -622,6 +710,32 @@ T LoadFromJson(const Json& json, const JsonArgs& args,
   return result;
 }
 
+template <typename T>
+absl::StatusOr<T> LoadFromJsonString(
+    absl::string_view json_str, const JsonArgs& args = JsonArgs(),
+    absl::string_view error_prefix = "errors validating JSON") {
+  ValidationErrors errors;
+  T result{};
+  absl::Status status = json_detail::LoadFromJsonString(
+      json_str, args, json_detail::LoaderForType<T>(), &result, &errors);
+  if (!status.ok()) return status;
+  if (!errors.ok()) {
+    return errors.status(absl::StatusCode::kInvalidArgument, error_prefix);
+  }
+  return std::move(result);
+}
+
+template <typename T>
+absl::StatusOr<T> LoadFromJsonString(absl::string_view json_str,
+                                     const JsonArgs& args,
+                                     ValidationErrors* errors) {
+  T result{};
+  absl::Status status = json_detail::LoadFromJsonString(
+      json_str, args, json_detail::LoaderForType<T>(), &result, errors);
+  if (!status.ok()) return status;
+  return std::move(result);
+}
+
 template <typename T>
 std::optional<T> LoadJsonObjectField(const Json::Object& json,
                                      const JsonArgs& args,
@@ -18,8 +18,14 @@
 #define GRPC_SRC_CORE_UTIL_JSON_JSON_READER_H
 
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
 
 #include "src/core/util/json/json.h"
+#include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
@@ -28,6 +34,145 @@ namespace grpc_core {
 // Parses JSON string from json_str.
 absl::StatusOr<Json> JsonParse(absl::string_view json_str);
 
+// Reads JSON from a string one token at a time, without building a Json
+// object for it.  Once the input is exhausted, Next() returns kEnd if the
+// input was valid JSON, or kError otherwise; after returning kError, it
+// keeps returning kError.
+class JsonTokenReader {
+ public:
+  enum class Token : uint8_t {
+    kObjectBegin,
+    kObjectEnd,
+    kArrayBegin,
+    kArrayEnd,
+    // An object key, in value().
+    kKey,
+    // A string value, in value().
+    kString,
+    // A number, in value().
+    kNumber,
+    kTrue,
+    kFalse,
+    kNull,
+    kEnd,
+    kError,
+  };
+
+  // Duplicate object keys are not detected among the tokens returned by
+  // Next(): the caller must detect them and report them with
+  // ReportDuplicateKey().  ReadValue() and SkipValue() detect them in the
+  // values they read.
+  explicit JsonTokenReader(absl::string_view input);
+
+  Token Next();
+
+  // The key, string or number returned by the last call to Next().  May be
+  // moved from.
+  std::string& value() { return value_; }
+
+  // Reports the key just returned by Next() as a duplicate.
+  void ReportDuplicateKey();
+
+  // Reads the value starting with token first into a Json.
+  Json ReadValue(Token first);
+  // Skips the value starting with token first.
+  void SkipValue(Token first);
+
+  // Returns the errors found in the input read so far, in the same form
+  // as JsonParse().
+  absl::Status status() const;
+
+ private:
+  enum class Status {
+    GRPC_JSON_CONTINUE,       // The parser has not reached the end yet.
+    GRPC_JSON_DONE,           // The parser finished successfully.
+    GRPC_JSON_PARSE_ERROR,    // The parser found an error in the json stream.
+    GRPC_JSON_INTERNAL_ERROR  // The parser got an internal error.
+  };
+
+  enum class State {
+    GRPC_JSON_STATE_OBJECT_KEY_BEGIN,
+    GRPC_JSON_STATE_OBJECT_KEY_STRING,
+    GRPC_JSON_STATE_OBJECT_KEY_END,
+    GRPC_JSON_STATE_VALUE_BEGIN,
+    GRPC_JSON_STATE_VALUE_STRING,
+    GRPC_JSON_STATE_STRING_ESCAPE,
+    GRPC_JSON_STATE_STRING_ESCAPE_U1,
+    GRPC_JSON_STATE_STRING_ESCAPE_U2,
+    GRPC_JSON_STATE_STRING_ESCAPE_U3,
+    GRPC_JSON_STATE_STRING_ESCAPE_U4,
+    GRPC_JSON_STATE_VALUE_NUMBER,
+    GRPC_JSON_STATE_VALUE_NUMBER_WITH_DECIMAL,
+    GRPC_JSON_STATE_VALUE_NUMBER_ZERO,
+    GRPC_JSON_STATE_VALUE_NUMBER_DOT,
+    GRPC_JSON_STATE_VALUE_NUMBER_E,
+    GRPC_JSON_STATE_VALUE_NUMBER_EPM,
+    GRPC_JSON_STATE_VALUE_TRUE_R,
+    GRPC_JSON_STATE_VALUE_TRUE_U,
+    GRPC_JSON_STATE_VALUE_TRUE_E,
+    GRPC_JSON_STATE_VALUE_FALSE_A,
+    GRPC_JSON_STATE_VALUE_FALSE_L,
+    GRPC_JSON_STATE_VALUE_FALSE_S,
+    GRPC_JSON_STATE_VALUE_FALSE_E,
+    GRPC_JSON_STATE_VALUE_NULL_U,
+    GRPC_JSON_STATE_VALUE_NULL_L1,
+    GRPC_JSON_STATE_VALUE_NULL_L2,
+    GRPC_JSON_STATE_VALUE_END,
+    GRPC_JSON_STATE_END
+  };
+
+  struct Container {
+    Json::Type type;
+  };
+
+  // Processes one character of input.
+  Status Step();
+  uint32_t ReadChar();
+  bool IsComplete();
+
+  size_t CurrentIndex() const { return input_ - original_input_ - 1; }
+
+  GRPC_MUST_USE_RESULT bool StringAddChar(uint32_t c);
+  GRPC_MUST_USE_RESULT bool StringAddUtf32(uint32_t c);
+
+  void AddError(std::string error);
+  void Emit(Token token) { pending_[pending_end_++] = token; }
+  bool StartContainer(Json::Type type);
+  void EndContainer();
+  void SetKey();
+  void SetString();
+  bool SetNumber();
+  void SetTrue();
+  void SetFalse();
+  void SetNull();
+
+  const uint8_t* original_input_;
+  const uint8_t* input_;
+  size_t remaining_input_;
+
+  Status status_ = Status::GRPC_JSON_CONTINUE;
+  State state_ = State::GRPC_JSON_STATE_VALUE_BEGIN;
+  bool escaped_string_was_key_ = false;
+  bool container_just_begun_ = false;
+  uint16_t unicode_char_ = 0;
+  uint16_t unicode_high_surrogate_ = 0;
+  std::vector<std::string> errors_;
+  bool truncated_errors_ = false;
+  uint8_t utf8_bytes_remaining_ = 0;
+  uint8_t utf8_first_byte_ = 0;
+
+  std::vector<Container> stack_;
+
+  std::string string_;
+  std::string value_;
+
+  // Tokens produced by the last call to Step() and not yet returned.  A
+  // single character can complete a number and close a container.
+  Token pending_[2];
+  uint8_t pending_begin_ = 0;
+  uint8_t pending_end_ = 0;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_UTIL_JSON_JSON_READER_H
@@ -139,9 +139,14 @@ class HeaderMatcher {
     return matcher_.string_matcher();
   }
 
+  // Valid for kExact, kPrefix, kSuffix and kContains.
+  bool case_sensitive() const { return matcher_.case_sensitive(); }
+
   // Valid for kSafeRegex.
   RE2* regex_matcher() const { return matcher_.regex_matcher(); }
 
+  bool invert_match() const { return invert_match_; }
+
   bool Match(const std::optional<absl::string_view>& value) const;
 
   std::string ToString() const;
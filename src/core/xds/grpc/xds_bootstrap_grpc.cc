@@ -22,7 +22,6 @@
 #include "src/core/config/experiment_env_var.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/json/json_object_loader.h"
-#include "src/core/util/json/json_reader.h"
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "absl/status/status.h"
@@ -207,12 +206,6 @@ void GrpcXdsBootstrap::AllowedGrpcService::JsonPostLoad(
 
 absl::StatusOr<std::unique_ptr<GrpcXdsBootstrap>> GrpcXdsBootstrap::Create(
     absl::string_view json_string) {
-  auto json = JsonParse(json_string);
-  if (!json.ok()) {
-    return absl::InvalidArgumentError(absl::StrCat(
-        "Failed to parse bootstrap JSON string: ", json.status().ToString()));
-  }
-  // Validate JSON.
   class XdsJsonArgs final : public JsonArgs {
    public:
     bool IsEnabled(absl::string_view key) const override {
@@ -221,7 +214,20 @@ absl::StatusOr<std::unique_ptr<GrpcXdsBootstrap>> GrpcXdsBootstrap::Create(
       return true;
     }
   };
-  return LoadFromJson<std::unique_ptr<GrpcXdsBootstrap>>(*json, XdsJsonArgs());
+  // Parse and validate JSON in one pass.
+  ValidationErrors errors;
+  auto bootstrap = LoadFromJsonString<std::unique_ptr<GrpcXdsBootstrap>>(
+      json_string, XdsJsonArgs(), &errors);
+  if (!bootstrap.ok()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Failed to parse bootstrap JSON string: ",
+                     bootstrap.status().ToString()));
+  }
+  if (!errors.ok()) {
+    return errors.status(absl::StatusCode::kInvalidArgument,
+                         "errors validating JSON");
+  }
+  return bootstrap;
 }
 
 const JsonLoaderInterface* GrpcXdsBootstrap::JsonLoader(const JsonArgs&) {
@@ -247,8 +253,7 @@ const JsonLoaderInterface* GrpcXdsBootstrap::JsonLoader(const JsonArgs&) {
   return loader;
 }
 
-void GrpcXdsBootstrap::JsonPostLoad(const Json& /*json*/,
-                                    const JsonArgs& /*args*/,
+void GrpcXdsBootstrap::JsonPostLoad(const JsonArgs& /*args*/,
                                     ValidationErrors* errors) {
   // Verify that there is at least one server present.
   {
@@ -125,8 +125,7 @@ class GrpcXdsBootstrap final : public XdsBootstrap {
   };
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
-  void JsonPostLoad(const Json& json, const JsonArgs& args,
-                    ValidationErrors* errors);
+  void JsonPostLoad(const JsonArgs& args, ValidationErrors* errors);
 
   std::string ToString() const override;
 
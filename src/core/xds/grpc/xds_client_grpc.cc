@@ -110,6 +110,17 @@ const auto kMetricResourceUpdatesInvalid =
                 kMetricLabelXdsResourceType)
         .Build();
 
+const auto kMetricResourceDecodesSkipped =
+    GlobalInstrumentsRegistry::RegisterUInt64Counter(
+        "grpc.xds_client.resource_decodes_skipped",
+        "EXPERIMENTAL.  A counter of valid resources received that did not "
+        "need to be decoded, because a decoded copy of the same bytes was "
+        "already available in this or another xDS client.",
+        "{resource}", false)
+        .Labels(kMetricLabelTarget, kMetricLabelXdsServer,
+                kMetricLabelXdsResourceType)
+        .Build();
+
 const auto kMetricServerFailure =
     GlobalInstrumentsRegistry::RegisterUInt64Counter(
         "grpc.xds_client.server_failure",
@@ -170,6 +181,14 @@ class GrpcXdsClient::MetricsReporter final : public XdsMetricsReporter {
         kMetricServerFailure, 1, {xds_client_.key_, xds_server}, {});
   }
 
+  void ReportResourceDecodesSkipped(absl::string_view xds_server,
+                                    absl::string_view resource_type,
+                                    uint64_t num_skipped) override {
+    xds_client_.stats_plugin_group_->AddCounter(
+        kMetricResourceDecodesSkipped, num_skipped,
+        {xds_client_.key_, xds_server, resource_type}, {});
+  }
+
  private:
   GrpcXdsClient& xds_client_;
 };
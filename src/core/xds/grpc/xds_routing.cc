@@ -23,17 +23,20 @@
 
 #include <algorithm>
 #include <cctype>
+#include <map>
 #include <utility>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/matchers.h"
 #include "src/core/xds/grpc/xds_http_filter.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/functional/function_ref.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/match.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
 
 namespace grpc_core {
@@ -139,8 +142,8 @@ namespace {
 
 bool HeadersMatch(const std::vector<HeaderMatcher>& header_matchers,
                   grpc_metadata_batch* initial_metadata) {
+  std::string concatenated_value;
   for (const auto& header_matcher : header_matchers) {
-    std::string concatenated_value;
     if (!header_matcher.Match(XdsRouting::GetHeaderValue(
             initial_metadata, header_matcher.name(), &concatenated_value))) {
       return false;
@@ -191,6 +194,160 @@ std::optional<absl::string_view> XdsRouting::GetHeaderValue(
   return initial_metadata->GetStringValue(header_name, concatenated_value);
 }
 
+//
+// XdsRouting::VirtualHostTable
+//
+
+XdsRouting::VirtualHostTable::VirtualHostTable(
+    const VirtualHostListIterator& vhost_iterator) {
+  // When several virtual hosts have the same domain pattern, the first one
+  // wins, so only the first index is recorded for each pattern.
+  for (size_t i = 0; i < vhost_iterator.Size(); ++i) {
+    for (const std::string& domain_pattern :
+         vhost_iterator.GetDomainsForVirtualHost(i)) {
+      const MatchType match_type = DomainPatternMatchType(domain_pattern);
+      // This should be caught by RouteConfigParse().
+      GRPC_CHECK(match_type != INVALID_MATCH);
+      std::string pattern = absl::AsciiStrToLower(domain_pattern);
+      switch (match_type) {
+        case EXACT_MATCH:
+          exact_domains_.emplace(std::move(pattern), i);
+          break;
+        case SUFFIX_MATCH:
+          pattern.erase(0, 1);
+          std::reverse(pattern.begin(), pattern.end());
+          if (domain_suffixes_.Lookup(pattern) == nullptr) {
+            domain_suffixes_.AddNode(pattern, i);
+          }
+          break;
+        case PREFIX_MATCH:
+          pattern.pop_back();
+          if (domain_prefixes_.Lookup(pattern) == nullptr) {
+            domain_prefixes_.AddNode(pattern, i);
+          }
+          break;
+        default:
+          if (!universe_.has_value()) universe_ = i;
+          break;
+      }
+    }
+  }
+}
+
+std::optional<size_t> XdsRouting::VirtualHostTable::Find(
+    absl::string_view domain) const {
+  // Same search order as FindVirtualHostForDomain(): exact, then the longest
+  // suffix, then the longest prefix, then universe match.
+  std::string host = absl::AsciiStrToLower(domain);
+  auto it = exact_domains_.find(host);
+  if (it != exact_domains_.end()) return it->second;
+  if (!host.empty()) {
+    // The asterisk must match at least one char, so the first char of the
+    // host cannot be part of the suffix, nor its last char of the prefix.
+    std::string reversed_host(host.rbegin(), host.rend() - 1);
+    const size_t* index = domain_suffixes_.LookupLongestPrefix(reversed_host);
+    if (index != nullptr) return *index;
+    index = domain_prefixes_.LookupLongestPrefix(
+        absl::string_view(host).substr(0, host.size() - 1));
+    if (index != nullptr) return *index;
+  }
+  return universe_;
+}
+
+//
+// XdsRouting::RouteTable
+//
+
+XdsRouting::RouteTable::RouteTable(
+    const RouteListIterator& route_list_iterator) {
+  std::map<std::string, std::vector<size_t>> path_prefixes;
+  routes_.reserve(route_list_iterator.Size());
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        route_list_iterator.GetMatchersForRoute(i);
+    Route& route = routes_.emplace_back();
+    route.matchers = &matchers;
+    route.match_path = false;
+    for (const HeaderMatcher& header_matcher : matchers.header_matchers) {
+      auto& groups = route.header_matchers;
+      auto group =
+          std::find_if(groups.begin(), groups.end(), [&](const auto& group) {
+            return group.first == header_matcher.name();
+          });
+      if (group == groups.end()) {
+        group = groups.emplace(groups.end(), header_matcher.name(),
+                               std::vector<const HeaderMatcher*>());
+      }
+      group->second.push_back(&header_matcher);
+    }
+    const StringMatcher& path_matcher = matchers.path_matcher;
+    if (path_matcher.case_sensitive() &&
+        path_matcher.type() == StringMatcher::Type::kExact) {
+      exact_paths_[path_matcher.string_matcher()].push_back(i);
+    } else if (path_matcher.case_sensitive() &&
+               path_matcher.type() == StringMatcher::Type::kPrefix &&
+               !path_matcher.string_matcher().empty()) {
+      path_prefixes[path_matcher.string_matcher()].push_back(i);
+    } else {
+      route.match_path = true;
+      unindexed_routes_.push_back(i);
+    }
+  }
+  for (auto& [prefix, indices] : path_prefixes) {
+    path_prefixes_.AddNode(prefix, std::move(indices));
+  }
+}
+
+bool XdsRouting::RouteTable::RouteMatches(
+    size_t index, absl::string_view path,
+    grpc_metadata_batch* initial_metadata,
+    std::string* concatenated_value) const {
+  const Route& route = routes_[index];
+  if (route.match_path && !route.matchers->path_matcher.Match(path)) {
+    return false;
+  }
+  for (const auto& [header_name, header_matchers] : route.header_matchers) {
+    std::optional<absl::string_view> value =
+        GetHeaderValue(initial_metadata, header_name, concatenated_value);
+    for (const HeaderMatcher* header_matcher : header_matchers) {
+      if (!header_matcher->Match(value)) return false;
+    }
+  }
+  return !route.matchers->fraction_per_million.has_value() ||
+         UnderFraction(*route.matchers->fraction_per_million);
+}
+
+std::optional<size_t> XdsRouting::RouteTable::GetRouteForRequest(
+    absl::string_view path, grpc_metadata_batch* initial_metadata) const {
+  // Gathers the sorted lists of candidate routes and merges them, evaluating
+  // the candidates in list order so that the first matching route wins.
+  using Candidates = std::pair<const size_t*, const size_t*>;
+  absl::InlinedVector<Candidates, 8> candidates;
+  auto add_candidates = [&](const std::vector<size_t>& indices) {
+    if (!indices.empty()) {
+      candidates.emplace_back(indices.data(), indices.data() + indices.size());
+    }
+  };
+  add_candidates(unindexed_routes_);
+  auto it = exact_paths_.find(path);
+  if (it != exact_paths_.end()) add_candidates(it->second);
+  path_prefixes_.ForEachPrefixMatch(path, add_candidates);
+  std::string concatenated_value;
+  while (!candidates.empty()) {
+    auto next = std::min_element(
+        candidates.begin(), candidates.end(),
+        [](const Candidates& a, const Candidates& b) {
+          return *a.first < *b.first;
+        });
+    const size_t index = *next->first;
+    if (RouteMatches(index, path, initial_metadata, &concatenated_value)) {
+      return index;
+    }
+    if (++next->first == next->second) candidates.erase(next);
+  }
+  return std::nullopt;
+}
+
 XdsRouting::RouteConfigFilterChainBuilder::RouteConfigFilterChainBuilder(
     const std::vector<XdsListenerResource::HttpConnectionManager::HttpFilter>&
         hcm_filter_configs,
@@ -24,13 +24,17 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/util/matchers.h"
+#include "src/core/util/trie_lookup.h"
 #include "src/core/xds/grpc/xds_http_filter_registry.h"
 #include "src/core/xds/grpc/xds_listener.h"
 #include "src/core/xds/grpc/xds_route_config.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
@@ -80,6 +84,71 @@ class XdsRouting final {
       grpc_metadata_batch* initial_metadata, absl::string_view header_name,
       std::string* concatenated_value);
 
+  // An index over the domains of a list of virtual hosts, built once per
+  // route config update, that finds the same virtual host as
+  // FindVirtualHostForDomain() with hash and trie lookups instead of matching
+  // every domain pattern.
+  class VirtualHostTable final {
+   public:
+    VirtualHostTable() = default;
+    explicit VirtualHostTable(const VirtualHostListIterator& vhost_iterator);
+
+    // Returns the index of the selected virtual host in the list the table
+    // was built from.
+    std::optional<size_t> Find(absl::string_view domain) const;
+
+   private:
+    // Keyed by the lower-cased domain.
+    absl::flat_hash_map<std::string, size_t> exact_domains_;
+    // Keyed by the lower-cased pattern without its leading '*', reversed.
+    TrieLookupTree<size_t> domain_suffixes_;
+    // Keyed by the lower-cased pattern without its trailing '*'.
+    TrieLookupTree<size_t> domain_prefixes_;
+    std::optional<size_t> universe_;
+  };
+
+  // An index over a list of routes, built once per route config update, that
+  // selects the same route as GetRouteForRequest() for a request. Exact and
+  // prefix path matchers are looked up in a hash map and a trie, so only the
+  // routes whose path matches, plus those with other path matchers, are
+  // evaluated, still in list order.
+  class RouteTable final {
+   public:
+    RouteTable() = default;
+    // The matchers of the routes must outlive the table.
+    explicit RouteTable(const RouteListIterator& route_list_iterator);
+
+    // Returns the index of the route to use in the list the table was built
+    // from, or nullopt if no route matches.
+    std::optional<size_t> GetRouteForRequest(
+        absl::string_view path, grpc_metadata_batch* initial_metadata) const;
+
+   private:
+    struct Route {
+      const XdsRouteConfigResource::Route::Matchers* matchers;
+      // False if the route's path matcher is enforced by the index.
+      bool match_path;
+      // The route's header matchers grouped by header name, so that each
+      // header is looked up once.
+      std::vector<std::pair<absl::string_view,
+                            std::vector<const HeaderMatcher*>>>
+          header_matchers;
+    };
+
+    // Returns true if the route at index matches the request.
+    bool RouteMatches(size_t index, absl::string_view path,
+                      grpc_metadata_batch* initial_metadata,
+                      std::string* concatenated_value) const;
+
+    std::vector<Route> routes_;
+    // Route indices, in list order, by exact path.
+    absl::flat_hash_map<std::string, std::vector<size_t>> exact_paths_;
+    // Route indices, in list order, by non-empty path prefix.
+    TrieLookupTree<std::vector<size_t>> path_prefixes_;
+    // Indices of routes with any other path matcher, in list order.
+    std::vector<size_t> unindexed_routes_;
+  };
+
   // Logic for building filter chains for each route within a
   // RouteConfiguration.  Caching is done to avoid unnecessary work while
   // iterating over the list of routes.
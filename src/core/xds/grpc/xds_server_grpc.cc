@@ -47,6 +47,8 @@ constexpr absl::string_view kServerFeatureResourceTimerIsTransientFailure =
 constexpr absl::string_view kServerFeatureTrustedXdsServer =
     "trusted_xds_server";
 
+constexpr absl::string_view kServerFeatureDeltaProtocol = "xds_delta_protocol";
+
 }  // namespace
 
 bool GrpcXdsServer::IgnoreResourceDeletion() const {
@@ -65,6 +67,11 @@ bool GrpcXdsServer::ResourceTimerIsTransientFailure() const {
          server_features_.end();
 }
 
+bool GrpcXdsServer::DeltaProtocol() const {
+  return server_features_.find(std::string(kServerFeatureDeltaProtocol)) !=
+         server_features_.end();
+}
+
 bool GrpcXdsServer::TrustedXdsServer() const {
   return server_features_.find(std::string(kServerFeatureTrustedXdsServer)) !=
          server_features_.end();
@@ -179,7 +186,8 @@ void GrpcXdsServer::JsonPostLoad(const Json& json, const JsonArgs& args,
                feature_json.string() == kServerFeatureFailOnDataErrors ||
                feature_json.string() ==
                    kServerFeatureResourceTimerIsTransientFailure ||
-               feature_json.string() == kServerFeatureTrustedXdsServer)) {
+               feature_json.string() == kServerFeatureTrustedXdsServer ||
+               feature_json.string() == kServerFeatureDeltaProtocol)) {
             server_features_.insert(feature_json.string());
           }
         }
@@ -90,7 +90,9 @@ GrpcXdsTransportFactory::GrpcXdsTransport::GrpcStreamingCall::GrpcStreamingCall(
       /*parent_call=*/nullptr, GRPC_PROPAGATE_DEFAULTS, /*cq=*/nullptr,
       factory_->interested_parties(), Slice::FromStaticString(method),
       /*authority=*/std::nullopt, deadline,
-      /*registered_method=*/true, /*arena_init_function=*/std::nullopt);
+      /*registered_method=*/
+      &channel->RegisterCall(method, /*host=*/nullptr)->config_cache,
+      /*arena_init_function=*/std::nullopt);
   GRPC_CHECK_NE(call_, nullptr);
   // Set call creds, if any.
   if (call_creds != nullptr) grpc_call_set_credentials(call_, call_creds);
@@ -108,25 +108,51 @@ LrsClient::ClusterDropStats::~ClusterDropStats() {
 LrsClient::ClusterDropStats::Snapshot
 LrsClient::ClusterDropStats::GetSnapshotAndReset() {
   Snapshot snapshot;
-  snapshot.uncategorized_drops = GetAndResetCounter(&uncategorized_drops_);
-  MutexLock lock(&mu_);
-  snapshot.categorized_drops = std::move(categorized_drops_);
+  for (auto& percpu_stats : stats_) {
+    Snapshot percpu_snapshot;
+    percpu_snapshot.uncategorized_drops =
+        GetAndResetCounter(&percpu_stats.uncategorized_drops);
+    {
+      MutexLock lock(&percpu_stats.mu);
+      percpu_snapshot.categorized_drops =
+          std::move(percpu_stats.categorized_drops);
+      percpu_stats.categorized_drops.clear();
+    }
+    snapshot += percpu_snapshot;
+  }
   return snapshot;
 }
 
 void LrsClient::ClusterDropStats::AddUncategorizedDrops() {
-  uncategorized_drops_.fetch_add(1);
+  stats_.this_cpu().uncategorized_drops.fetch_add(1,
+                                                  std::memory_order_relaxed);
 }
 
 void LrsClient::ClusterDropStats::AddCallDropped(const std::string& category) {
-  MutexLock lock(&mu_);
-  ++categorized_drops_[category];
+  Stats& stats = stats_.this_cpu();
+  MutexLock lock(&stats.mu);
+  ++stats.categorized_drops[category];
 }
 
 //
 // LrsClient::ClusterLocalityStats
 //
 
+void LrsClient::ClusterLocalityStats::AtomicBackendMetric::Add(double value) {
+  num_requests_finished_with_metric.fetch_add(1, std::memory_order_relaxed);
+  double total = total_metric_value.load(std::memory_order_relaxed);
+  while (!total_metric_value.compare_exchange_weak(
+      total, total + value, std::memory_order_relaxed)) {
+  }
+}
+
+LrsClient::ClusterLocalityStats::BackendMetric
+LrsClient::ClusterLocalityStats::AtomicBackendMetric::GetAndReset() {
+  return BackendMetric(
+      GetAndResetCounter(&num_requests_finished_with_metric),
+      total_metric_value.exchange(0, std::memory_order_relaxed));
+}
+
 LrsClient::ClusterLocalityStats::ClusterLocalityStats(
     RefCountedPtr<LrsClient> lrs_client, absl::string_view lrs_server,
     absl::string_view cluster_name, absl::string_view eds_service_name,
@@ -173,17 +199,14 @@ LrsClient::ClusterLocalityStats::GetSnapshotAndReset() {
         percpu_stats.total_requests_in_progress.load(std::memory_order_relaxed),
         GetAndResetCounter(&percpu_stats.total_error_requests),
         GetAndResetCounter(&percpu_stats.total_issued_requests),
-        {},
-        {},
-        {},
+        percpu_stats.cpu_utilization.GetAndReset(),
+        percpu_stats.mem_utilization.GetAndReset(),
+        percpu_stats.application_utilization.GetAndReset(),
         {}};
     {
       MutexLock lock(&percpu_stats.backend_metrics_mu);
-      percpu_snapshot.cpu_utilization = std::move(percpu_stats.cpu_utilization);
-      percpu_snapshot.mem_utilization = std::move(percpu_stats.mem_utilization);
-      percpu_snapshot.application_utilization =
-          std::move(percpu_stats.application_utilization);
       percpu_snapshot.backend_metrics = std::move(percpu_stats.backend_metrics);
+      percpu_stats.backend_metrics.clear();
     }
     snapshot += percpu_snapshot;
   }
@@ -204,8 +227,9 @@ void LrsClient::ClusterLocalityStats::AddCallFinished(
   to_increment.fetch_add(1, std::memory_order_relaxed);
   stats.total_requests_in_progress.fetch_add(-1, std::memory_order_acq_rel);
   if (backend_metrics == nullptr) return;
-  MutexLock lock(&stats.backend_metrics_mu);
   if (!XdsOrcaLrsPropagationChangesEnabled()) {
+    if (backend_metrics->named_metrics.empty()) return;
+    MutexLock lock(&stats.backend_metrics_mu);
     for (const auto& [name, value] : backend_metrics->named_metrics) {
       stats.backend_metrics[std::string(name)] += BackendMetric(1, value);
     }
@@ -213,20 +237,22 @@ void LrsClient::ClusterLocalityStats::AddCallFinished(
   }
   if (backend_metric_propagation_->propagation_bits &
       BackendMetricPropagation::kCpuUtilization) {
-    stats.cpu_utilization += BackendMetric(1, backend_metrics->cpu_utilization);
+    stats.cpu_utilization.Add(backend_metrics->cpu_utilization);
   }
   if (backend_metric_propagation_->propagation_bits &
       BackendMetricPropagation::kMemUtilization) {
-    stats.mem_utilization += BackendMetric(1, backend_metrics->mem_utilization);
+    stats.mem_utilization.Add(backend_metrics->mem_utilization);
   }
   if (backend_metric_propagation_->propagation_bits &
       BackendMetricPropagation::kApplicationUtilization) {
-    stats.application_utilization +=
-        BackendMetric(1, backend_metrics->application_utilization);
+    stats.application_utilization.Add(
+        backend_metrics->application_utilization);
   }
-  if (backend_metric_propagation_->propagation_bits &
-          BackendMetricPropagation::kNamedMetricsAll ||
-      !backend_metric_propagation_->named_metric_keys.empty()) {
+  if ((backend_metric_propagation_->propagation_bits &
+           BackendMetricPropagation::kNamedMetricsAll ||
+       !backend_metric_propagation_->named_metric_keys.empty()) &&
+      !backend_metrics->named_metrics.empty()) {
+    MutexLock lock(&stats.backend_metrics_mu);
     for (const auto& [name, value] : backend_metrics->named_metrics) {
       if (backend_metric_propagation_->propagation_bits &
               BackendMetricPropagation::kNamedMetricsAll ||
@@ -18,6 +18,7 @@
 #define GRPC_SRC_CORE_XDS_XDS_CLIENT_LRS_CLIENT_H
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
 
 #include <atomic>
 #include <map>
@@ -98,16 +99,23 @@ class LrsClient : public DualRefCounted<LrsClient> {
     void AddCallDropped(const std::string& category);
 
    private:
+    // Sharded so that pickers on different CPUs don't contend. Shards are
+    // cache-line aligned, so four CPUs share each one to bound the memory
+    // used per stats object on large machines.
+    struct alignas(GPR_CACHELINE_SIZE) Stats {
+      std::atomic<uint64_t> uncategorized_drops{0};
+      // Protects categorized_drops. A mutex is necessary because the map
+      // can be accessed by both the picker (from data plane mutex) and the
+      // load reporting thread (from the control plane combiner).
+      Mutex mu;
+      CategorizedDropsMap categorized_drops ABSL_GUARDED_BY(mu);
+    };
+
     RefCountedPtr<LrsClient> lrs_client_;
     absl::string_view lrs_server_;
     absl::string_view cluster_name_;
     absl::string_view eds_service_name_;
-    std::atomic<uint64_t> uncategorized_drops_{0};
-    // Protects categorized_drops_. A mutex is necessary because the length of
-    // dropped_requests can be accessed by both the picker (from data plane
-    // mutex) and the load reporting thread (from the control plane combiner).
-    Mutex mu_;
-    CategorizedDropsMap categorized_drops_ ABSL_GUARDED_BY(mu_);
+    PerCpu<Stats> stats_{PerCpuOptions().SetMaxShards(32).SetCpusPerShard(4)};
   };
 
   // Locality stats for an xds cluster.
@@ -205,16 +213,31 @@ class LrsClient : public DualRefCounted<LrsClient> {
     XdsLocalityName* locality_name() const { return name_.get(); }
 
    private:
-    struct Stats {
+    // A BackendMetric that can be updated without a lock.  The count and
+    // the total are reset separately, so a call racing with
+    // GetSnapshotAndReset() may have its count and value reported in
+    // adjacent intervals; this is the same guarantee as for the other
+    // counters.
+    struct AtomicBackendMetric {
+      std::atomic<uint64_t> num_requests_finished_with_metric{0};
+      std::atomic<double> total_metric_value{0};
+
+      void Add(double value);
+      BackendMetric GetAndReset();
+    };
+
+    struct alignas(GPR_CACHELINE_SIZE) Stats {
       std::atomic<uint64_t> total_successful_requests{0};
       std::atomic<uint64_t> total_requests_in_progress{0};
       std::atomic<uint64_t> total_error_requests{0};
       std::atomic<uint64_t> total_issued_requests{0};
+      AtomicBackendMetric cpu_utilization;
+      AtomicBackendMetric mem_utilization;
+      AtomicBackendMetric application_utilization;
 
+      // Named metrics are keyed by name, so they still need a lock, but
+      // it is only shared with calls on the same shard.
       Mutex backend_metrics_mu;
-      BackendMetric cpu_utilization ABSL_GUARDED_BY(backend_metrics_mu);
-      BackendMetric mem_utilization ABSL_GUARDED_BY(backend_metrics_mu);
-      BackendMetric application_utilization ABSL_GUARDED_BY(backend_metrics_mu);
       std::map<std::string, BackendMetric> backend_metrics
           ABSL_GUARDED_BY(backend_metrics_mu);
     };
@@ -70,6 +70,10 @@ class XdsBootstrap {
     virtual bool FailOnDataErrors() const = 0;
     virtual bool ResourceTimerIsTransientFailure() const = 0;
 
+    // Returns true if the server supports the incremental (delta) variant
+    // of the ADS protocol.
+    virtual bool DeltaProtocol() const = 0;
+
     virtual bool Equals(const XdsServer& other) const = 0;
 
     // Returns a key to be used for uniquely identifying this XdsServer.
@@ -48,6 +48,7 @@
 #include "src/core/xds/xds_client/xds_api.h"
 #include "src/core/xds/xds_client/xds_bootstrap.h"
 #include "src/core/xds/xds_client/xds_locality.h"
+#include "src/core/xds/xds_client/xds_resource_cache.h"
 #include "upb/base/string_view.h"
 #include "upb/mem/arena.h"
 #include "upb/reflection/def.h"
@@ -305,6 +306,13 @@ class XdsClient::XdsChannel::AdsCall final
     std::map<std::string /*authority*/,
              std::map<XdsResourceKey, OrphanablePtr<ResourceTimer>>>
         subscribed_resources;
+
+    // Used only for the delta protocol.
+    // The resource names that the server has been told we are subscribed
+    // to on this stream.
+    std::set<std::string> delta_subscribed_names;
+    // True once a request for this type has been sent on this stream.
+    bool delta_request_sent = false;
   };
 
   std::string CreateAdsRequest(absl::string_view type_url,
@@ -313,6 +321,12 @@ class XdsClient::XdsChannel::AdsCall final
                                const std::vector<std::string>& resource_names,
                                absl::Status status) const
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Creates a delta request subscribing to the resources added and
+  // unsubscribing from the resources removed since the last request for
+  // the type on this stream.
+  std::string CreateDeltaAdsRequest(const XdsResourceType* type,
+                                    ResourceTypeState& state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
@@ -321,6 +335,7 @@ class XdsClient::XdsChannel::AdsCall final
     upb::Arena arena;
     const XdsResourceType* type;
     std::string type_url;
+    // For delta responses, the version of the resource being parsed, if any.
     std::string version;
     std::string nonce;
     std::vector<std::string> errors;
@@ -328,6 +343,9 @@ class XdsClient::XdsChannel::AdsCall final
         resources_seen;
     uint64_t num_valid_resources = 0;
     uint64_t num_invalid_resources = 0;
+    // Number of resources that did not need to be decoded, because a
+    // decoded copy of the same bytes was already available.
+    uint64_t num_decodes_skipped = 0;
     Timestamp update_time = Timestamp::Now();
     RefCountedPtr<ReadDelayHandle> read_delay_handle;
   };
@@ -336,14 +354,29 @@ class XdsClient::XdsChannel::AdsCall final
                      absl::string_view serialized_resource,
                      DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  // Decodes a resource, reusing an already decoded copy if either this
+  // client or the process-wide XdsResourceCache has one for the same bytes.
+  XdsResourceType::DecodeResult DecodeResource(
+      absl::string_view resource_name, absl::string_view serialized_resource,
+      DecodeContext* context) ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   void HandleServerReportedResourceError(size_t idx,
                                          absl::string_view resource_name,
                                          absl::Status status,
                                          DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  void HandleServerReportedResourceErrors(
+      const envoy_service_discovery_v3_ResourceError* const* errors,
+      size_t num_errors, DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  void HandleRemovedResource(size_t idx, absl::string_view resource_name,
+                             DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
   absl::Status DecodeAdsResponse(absl::string_view encoded_response,
                                  DecodeContext* context)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  absl::Status DecodeDeltaAdsResponse(absl::string_view encoded_response,
+                                      DecodeContext* context)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void OnRequestSent(bool ok);
   void OnRecvMessage(absl::string_view payload);
@@ -359,6 +392,10 @@ class XdsClient::XdsChannel::AdsCall final
   // The owning RetryableCall<>.
   RefCountedPtr<RetryableCall<AdsCall>> retryable_call_;
 
+  // True if the call uses the incremental (delta) variant of the protocol,
+  // where requests and responses carry only the changed resources.
+  const bool delta_;
+
   OrphanablePtr<XdsTransportFactory::XdsTransport::StreamingCall>
       streaming_call_;
 
@@ -718,12 +755,15 @@ XdsClient::XdsChannel::AdsCall::AdsCall(
     RefCountedPtr<RetryableCall<AdsCall>> retryable_call)
     : InternallyRefCounted<AdsCall>(
           GRPC_TRACE_FLAG_ENABLED(xds_client_refcount) ? "AdsCall" : nullptr),
-      retryable_call_(std::move(retryable_call)) {
+      retryable_call_(std::move(retryable_call)),
+      delta_(xds_channel()->server_.DeltaProtocol()) {
   GRPC_CHECK_NE(xds_client(), nullptr);
   // Init the ADS call.
   const char* method =
-      "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
-      "StreamAggregatedResources";
+      delta_ ? "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+               "DeltaAggregatedResources"
+             : "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+               "StreamAggregatedResources";
   streaming_call_ = xds_channel()->transport_->CreateStreamingCall(
       method, std::make_unique<StreamEventHandler>(
                   // Passing the initial ref here.  This ref will go away when
@@ -734,7 +774,8 @@ XdsClient::XdsChannel::AdsCall::AdsCall(
   GRPC_TRACE_LOG(xds_client, INFO)
       << "[xds_client " << xds_client() << "] xds server "
       << xds_channel()->server_uri()
-      << ": starting ADS call (ads_call: " << this
+      << ": starting " << (delta_ ? "delta " : "")
+      << "ADS call (ads_call: " << this
       << ", streaming_call: " << streaming_call_.get() << ")";
   // If this is a reconnect, add any necessary subscriptions from what's
   // already in the cache.
@@ -836,6 +877,29 @@ std::string SerializeDiscoveryRequest(
   return std::string(output, output_length);
 }
 
+void MaybeLogDeltaDiscoveryRequest(
+    const XdsClient* client, upb_DefPool* def_pool,
+    const envoy_service_discovery_v3_DeltaDiscoveryRequest* request) {
+  if (GRPC_TRACE_FLAG_ENABLED(xds_client) && ABSL_VLOG_IS_ON(2)) {
+    const upb_MessageDef* msg_type =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_getmsgdef(def_pool);
+    char buf[10240];
+    upb_TextEncode(reinterpret_cast<const upb_Message*>(request), msg_type,
+                   nullptr, 0, buf, sizeof(buf));
+    VLOG(2) << "[xds_client " << client
+            << "] constructed delta ADS request: " << buf;
+  }
+}
+
+std::string SerializeDeltaDiscoveryRequest(
+    upb_Arena* arena,
+    envoy_service_discovery_v3_DeltaDiscoveryRequest* request) {
+  size_t output_length;
+  char* output = envoy_service_discovery_v3_DeltaDiscoveryRequest_serialize(
+      request, arena, &output_length);
+  return std::string(output, output_length);
+}
+
 }  // namespace
 
 std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
@@ -899,6 +963,89 @@ std::string XdsClient::XdsChannel::AdsCall::CreateAdsRequest(
   return SerializeDiscoveryRequest(arena.ptr(), request);
 }
 
+std::string XdsClient::XdsChannel::AdsCall::CreateDeltaAdsRequest(
+    const XdsResourceType* type, ResourceTypeState& state) {
+  upb::Arena arena;
+  // Create a request.
+  envoy_service_discovery_v3_DeltaDiscoveryRequest* request =
+      envoy_service_discovery_v3_DeltaDiscoveryRequest_new(arena.ptr());
+  // Set type_url.
+  std::string type_url_str =
+      absl::StrCat("type.googleapis.com/", type->type_url());
+  envoy_service_discovery_v3_DeltaDiscoveryRequest_set_type_url(
+      request, StdStringToUpbString(type_url_str));
+  // Set nonce.
+  if (!state.nonce.empty()) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_set_response_nonce(
+        request, StdStringToUpbString(state.nonce));
+  }
+  // Set error_detail if it's a NACK.
+  std::string error_string_storage;
+  if (!state.status.ok()) {
+    google_rpc_Status* error_detail =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_mutable_error_detail(
+            request, arena.ptr());
+    // Hard-code INVALID_ARGUMENT as the status code, as in CreateAdsRequest().
+    google_rpc_Status_set_code(error_detail, GRPC_STATUS_INVALID_ARGUMENT);
+    error_string_storage = std::string(state.status.message());
+    google_rpc_Status_set_message(error_detail,
+                                  StdStringToUpbString(error_string_storage));
+  }
+  // Populate node.
+  if (!sent_initial_message_) {
+    envoy_config_core_v3_Node* node_msg =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_mutable_node(
+            request, arena.ptr());
+    PopulateXdsNode(xds_client()->bootstrap_->node(),
+                    xds_client()->user_agent_name_,
+                    xds_client()->user_agent_version_, node_msg, arena.ptr());
+  }
+  // Subscribe to the resources not yet sent on this stream.
+  std::set<std::string> resource_names;
+  for (auto& [authority, resource_map] : state.subscribed_resources) {
+    for (auto& [resource_key, resource_timer] : resource_map) {
+      const std::string& resource_name =
+          *resource_names
+               .insert(XdsClient::ConstructFullXdsResourceName(
+                   authority, type->type_url(), resource_key))
+               .first;
+      resource_timer->MarkSubscriptionSendStarted();
+      if (state.delta_subscribed_names.count(resource_name) > 0) continue;
+      envoy_service_discovery_v3_DeltaDiscoveryRequest_add_resource_names_subscribe(
+          request, StdStringToUpbString(resource_name), arena.ptr());
+      // On the first request for the type on this stream, report the
+      // versions already in the cache, so that the server can skip
+      // resending them.
+      if (state.delta_request_sent) continue;
+      auto authority_it = xds_client()->authority_state_map_.find(authority);
+      if (authority_it == xds_client()->authority_state_map_.end()) continue;
+      auto type_it = authority_it->second.type_map.find(type);
+      if (type_it == authority_it->second.type_map.end()) continue;
+      auto res_it = type_it->second.find(resource_key);
+      if (res_it == type_it->second.end() || !res_it->second.HasResource()) {
+        continue;
+      }
+      envoy_service_discovery_v3_DeltaDiscoveryRequest_initial_resource_versions_set(
+          request, StdStringToUpbString(resource_name),
+          StdStringToUpbString(res_it->second.version()), arena.ptr());
+    }
+  }
+  // Unsubscribe from the resources that are no longer watched.
+  for (const std::string& resource_name : state.delta_subscribed_names) {
+    if (resource_names.count(resource_name) == 0) {
+      envoy_service_discovery_v3_DeltaDiscoveryRequest_add_resource_names_unsubscribe(
+          request, StdStringToUpbString(resource_name), arena.ptr());
+    }
+  }
+  MaybeLogDeltaDiscoveryRequest(xds_client(), xds_client()->def_pool_.ptr(),
+                                request);
+  std::string serialized_request =
+      SerializeDeltaDiscoveryRequest(arena.ptr(), request);
+  state.delta_subscribed_names = std::move(resource_names);
+  state.delta_request_sent = true;
+  return serialized_request;
+}
+
 void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
     const XdsResourceType* type)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_) {
@@ -910,9 +1057,12 @@ void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
   xds_client()->MaybeRemoveUnsubscribedCacheEntriesForTypeLocked(xds_channel(),
                                                                  type);
   auto& state = state_map_[type];
-  std::string serialized_message = CreateAdsRequest(
-      type->type_url(), xds_channel()->resource_type_version_map_[type],
-      state.nonce, ResourceNamesForRequest(type), state.status);
+  std::string serialized_message =
+      delta_ ? CreateDeltaAdsRequest(type, state)
+             : CreateAdsRequest(
+                   type->type_url(),
+                   xds_channel()->resource_type_version_map_[type],
+                   state.nonce, ResourceNamesForRequest(type), state.status);
   sent_initial_message_ = true;
   GRPC_TRACE_LOG(xds_client, INFO)
       << "[xds_client " << xds_client() << "] xds server "
@@ -973,11 +1123,8 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
     return;
   }
   // Parse the resource.
-  XdsResourceType::DecodeContext resource_type_context = {
-      xds_client(), xds_channel()->server_, xds_client()->def_pool_.ptr(),
-      context->arena.ptr()};
   XdsResourceType::DecodeResult decode_result =
-      context->type->Decode(resource_type_context, serialized_resource);
+      DecodeResource(resource_name, serialized_resource, context);
   // If we didn't already have the resource name from the Resource
   // wrapper, try to get it from the decoding result.
   if (resource_name.empty()) {
@@ -1064,8 +1211,9 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
   // Check if the resource has changed.
   const bool resource_identical =
       resource_state.HasResource() &&
-      context->type->ResourcesEqual(resource_state.resource().get(),
-                                    decode_result.resource->get());
+      (resource_state.resource() == *decode_result.resource ||
+       context->type->ResourcesEqual(resource_state.resource().get(),
+                                     decode_result.resource->get()));
   // If not changed, keep using the current decoded resource object.
   // This should avoid wasting memory, since external watchers may be
   // holding refs to the current object.
@@ -1094,6 +1242,54 @@ void XdsClient::XdsChannel::AdsCall::ParseResource(
                                                 context->read_delay_handle);
 }
 
+XdsResourceType::DecodeResult XdsClient::XdsChannel::AdsCall::DecodeResource(
+    absl::string_view resource_name, absl::string_view serialized_resource,
+    DecodeContext* context) {
+  // If the resource name is known up front and we already have a resource
+  // decoded from the same bytes, there is nothing to decode.
+  if (!resource_name.empty()) {
+    auto parsed_resource_name =
+        xds_client()->ParseXdsResourceName(resource_name, context->type);
+    if (parsed_resource_name.ok()) {
+      const ResourceState* resource_state = nullptr;
+      auto authority_it = xds_client()->authority_state_map_.find(
+          parsed_resource_name->authority);
+      if (authority_it != xds_client()->authority_state_map_.end()) {
+        auto type_it = authority_it->second.type_map.find(context->type);
+        if (type_it != authority_it->second.type_map.end()) {
+          auto res_it = type_it->second.find(parsed_resource_name->key);
+          if (res_it != type_it->second.end()) {
+            resource_state = &res_it->second;
+          }
+        }
+      }
+      if (resource_state != nullptr && resource_state->HasResource() &&
+          resource_state->serialized_proto() == serialized_resource) {
+        ++context->num_decodes_skipped;
+        return {std::nullopt, resource_state->resource()};
+      }
+    }
+  }
+  // Otherwise, check whether another XdsClient has already decoded it.
+  XdsResourceCache::Key key(context->type, xds_client()->bootstrap_,
+                            xds_channel()->server_, serialized_resource);
+  auto cached = XdsResourceCache::Get().Lookup(key);
+  if (cached.has_value()) {
+    ++context->num_decodes_skipped;
+    return {std::move(cached->name), std::move(cached->resource)};
+  }
+  XdsResourceType::DecodeContext resource_type_context = {
+      xds_client(), xds_channel()->server_, xds_client()->def_pool_.ptr(),
+      context->arena.ptr()};
+  XdsResourceType::DecodeResult decode_result =
+      context->type->Decode(resource_type_context, serialized_resource);
+  if (decode_result.name.has_value() && decode_result.resource.ok()) {
+    XdsResourceCache::Get().Insert(std::move(key), *decode_result.name,
+                                   *decode_result.resource);
+  }
+  return decode_result;
+}
+
 void XdsClient::XdsChannel::AdsCall::HandleServerReportedResourceError(
     size_t idx, absl::string_view resource_name, absl::Status status,
     DecodeContext* context) {
@@ -1179,6 +1375,91 @@ void XdsClient::XdsChannel::AdsCall::HandleServerReportedResourceError(
   }
 }
 
+void XdsClient::XdsChannel::AdsCall::HandleServerReportedResourceErrors(
+    const envoy_service_discovery_v3_ResourceError* const* errors,
+    size_t num_errors, DecodeContext* context) {
+  for (size_t i = 0; i < num_errors; ++i) {
+    absl::string_view name;
+    {
+      const envoy_service_discovery_v3_ResourceName* resource_name =
+          envoy_service_discovery_v3_ResourceError_resource_name(errors[i]);
+      if (resource_name != nullptr) {
+        name = UpbStringToAbsl(
+            envoy_service_discovery_v3_ResourceName_name(resource_name));
+      }
+    }
+    absl::Status status;
+    {
+      const google_rpc_Status* error_detail =
+          envoy_service_discovery_v3_ResourceError_error_detail(errors[i]);
+      if (error_detail != nullptr) {
+        status = absl::Status(
+            static_cast<absl::StatusCode>(google_rpc_Status_code(error_detail)),
+            UpbStringToAbsl(google_rpc_Status_message(error_detail)));
+      }
+    }
+    HandleServerReportedResourceError(i, name, std::move(status), context);
+  }
+}
+
+void XdsClient::XdsChannel::AdsCall::HandleRemovedResource(
+    size_t idx, absl::string_view resource_name, DecodeContext* context) {
+  // Check the resource name.
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, context->type);
+  if (!parsed_resource_name.ok()) {
+    context->errors.emplace_back(
+        absl::StrCat("removed_resources index ", idx, ": ", resource_name,
+                     ": Cannot parse xDS resource name"));
+    return;
+  }
+  // Cancel resource-does-not-exist timer, if needed.
+  auto timer_it = state_map_.find(context->type);
+  if (timer_it != state_map_.end()) {
+    auto it = timer_it->second.subscribed_resources.find(
+        parsed_resource_name->authority);
+    if (it != timer_it->second.subscribed_resources.end()) {
+      auto res_it = it->second.find(parsed_resource_name->key);
+      if (res_it != it->second.end()) {
+        res_it->second->MarkSeen();
+      }
+    }
+  }
+  // Lookup the authority in the cache.
+  auto authority_it =
+      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) {
+    return;  // Skip resource -- we don't have a subscription for it.
+  }
+  AuthorityState& authority_state = authority_it->second;
+  // Found authority, so look up type.
+  auto type_it = authority_state.type_map.find(context->type);
+  if (type_it == authority_state.type_map.end()) {
+    return;  // Skip resource -- we don't have a subscription for it.
+  }
+  auto& type_map = type_it->second;
+  // Found type, so look up resource key.
+  auto it = type_map.find(parsed_resource_name->key);
+  if (it == type_map.end()) {
+    return;  // Skip resource -- we don't have a subscription for it.
+  }
+  ResourceState& resource_state = it->second;
+  if (!resource_state.HasResource() &&
+      resource_state.client_status() == ResourceState::DOES_NOT_EXIST) {
+    return;  // Watchers already know that the resource does not exist.
+  }
+  // Unlike in SotW, deletions are explicit for all resource types, so
+  // they are handled the same way as LDS and CDS deletions in SotW.
+  const bool drop_cached_resource =
+      XdsDataErrorHandlingEnabled()
+          ? xds_channel()->server_.FailOnDataErrors()
+          : !xds_channel()->server_.IgnoreResourceDeletion();
+  resource_state.SetDoesNotExistOnLdsOrCdsDeletion(
+      context->version, context->update_time, drop_cached_resource);
+  xds_client()->NotifyWatchersOnError(resource_state,
+                                      context->read_delay_handle);
+}
+
 namespace {
 
 void MaybeLogDiscoveryResponse(
@@ -1194,6 +1475,20 @@ void MaybeLogDiscoveryResponse(
   }
 }
 
+void MaybeLogDeltaDiscoveryResponse(
+    const XdsClient* client, upb_DefPool* def_pool,
+    const envoy_service_discovery_v3_DeltaDiscoveryResponse* response) {
+  if (GRPC_TRACE_FLAG_ENABLED(xds_client) && ABSL_VLOG_IS_ON(2)) {
+    const upb_MessageDef* msg_type =
+        envoy_service_discovery_v3_DeltaDiscoveryResponse_getmsgdef(def_pool);
+    char buf[10240];
+    upb_TextEncode(reinterpret_cast<const upb_Message*>(response), msg_type,
+                   nullptr, 0, buf, sizeof(buf));
+    VLOG(2) << "[xds_client " << client
+            << "] received delta response: " << buf;
+  }
+}
+
 }  // namespace
 
 absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
@@ -1279,29 +1574,90 @@ absl::Status XdsClient::XdsChannel::AdsCall::DecodeAdsResponse(
     }
     ParseResource(i, type_url, resource_name, serialized_resource, context);
   }
-  // Process each error.
-  for (size_t i = 0; i < num_errors; ++i) {
-    absl::string_view name;
-    {
-      const envoy_service_discovery_v3_ResourceName* resource_name =
-          envoy_service_discovery_v3_ResourceError_resource_name(errors[i]);
-      if (resource_name != nullptr) {
-        name = UpbStringToAbsl(
-            envoy_service_discovery_v3_ResourceName_name(resource_name));
-      }
-    }
-    absl::Status status;
-    {
-      const google_rpc_Status* error_detail =
-          envoy_service_discovery_v3_ResourceError_error_detail(errors[i]);
-      if (error_detail != nullptr) {
-        status = absl::Status(
-            static_cast<absl::StatusCode>(google_rpc_Status_code(error_detail)),
-            UpbStringToAbsl(google_rpc_Status_message(error_detail)));
-      }
-    }
-    HandleServerReportedResourceError(i, name, std::move(status), context);
+  HandleServerReportedResourceErrors(errors, num_errors, context);
+  return absl::OkStatus();
+}
+
+absl::Status XdsClient::XdsChannel::AdsCall::DecodeDeltaAdsResponse(
+    absl::string_view encoded_response, DecodeContext* context) {
+  // Decode the response.
+  const envoy_service_discovery_v3_DeltaDiscoveryResponse* response =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_parse(
+          encoded_response.data(), encoded_response.size(),
+          context->arena.ptr());
+  // If decoding fails, report a fatal error and return.
+  if (response == nullptr) {
+    return absl::InvalidArgumentError("Can't decode DeltaDiscoveryResponse.");
   }
+  MaybeLogDeltaDiscoveryResponse(xds_client(), xds_client()->def_pool_.ptr(),
+                                 response);
+  // Get the type_url, version, nonce, number of resources, number of
+  // removed resources, and number of errors.
+  context->type_url = std::string(absl::StripPrefix(
+      UpbStringToAbsl(
+          envoy_service_discovery_v3_DeltaDiscoveryResponse_type_url(response)),
+      "type.googleapis.com/"));
+  const std::string system_version = UpbStringToStdString(
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_system_version_info(
+          response));
+  context->version = system_version;
+  context->nonce = UpbStringToStdString(
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_nonce(response));
+  size_t num_resources;
+  const envoy_service_discovery_v3_Resource* const* resources =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_resources(
+          response, &num_resources);
+  size_t num_removed;
+  const upb_StringView* removed_resources =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_removed_resources(
+          response, &num_removed);
+  size_t num_errors = 0;
+  const envoy_service_discovery_v3_ResourceError* const* errors = nullptr;
+  if (XdsDataErrorHandlingEnabled()) {
+    errors = envoy_service_discovery_v3_DeltaDiscoveryResponse_resource_errors(
+        response, &num_errors);
+  }
+  GRPC_TRACE_LOG(xds_client, INFO)
+      << "[xds_client " << xds_client() << "] xds server "
+      << xds_channel()->server_uri()
+      << ": received delta ADS response: type_url=" << context->type_url
+      << ", system_version=" << system_version << ", nonce=" << context->nonce
+      << ", num_resources=" << num_resources
+      << ", num_removed=" << num_removed << ", num_errors=" << num_errors;
+  context->type = xds_client()->GetResourceTypeLocked(context->type_url);
+  if (context->type == nullptr) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("unknown resource type ", context->type_url));
+  }
+  context->read_delay_handle = MakeRefCounted<AdsReadDelayHandle>(Ref());
+  // Process each resource.  Resources not in the response are unchanged,
+  // so they are neither decoded nor touched in the cache.
+  for (size_t i = 0; i < num_resources; ++i) {
+    const google_protobuf_Any* resource =
+        envoy_service_discovery_v3_Resource_resource(resources[i]);
+    if (resource == nullptr) {
+      context->errors.emplace_back(absl::StrCat(
+          "resource index ", i, ": No resource present in Resource proto"));
+      ++context->num_invalid_resources;
+      continue;
+    }
+    // In the delta protocol, each resource has its own version.
+    context->version = UpbStringToStdString(
+        envoy_service_discovery_v3_Resource_version(resources[i]));
+    ParseResource(
+        i,
+        absl::StripPrefix(
+            UpbStringToAbsl(google_protobuf_Any_type_url(resource)),
+            "type.googleapis.com/"),
+        UpbStringToAbsl(envoy_service_discovery_v3_Resource_name(resources[i])),
+        UpbStringToAbsl(google_protobuf_Any_value(resource)), context);
+  }
+  context->version = system_version;
+  // Process each removed resource.
+  for (size_t i = 0; i < num_removed; ++i) {
+    HandleRemovedResource(i, UpbStringToAbsl(removed_resources[i]), context);
+  }
+  HandleServerReportedResourceErrors(errors, num_errors, context);
   return absl::OkStatus();
 }
 
@@ -1312,7 +1668,8 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
   MutexLock lock(&xds_client()->mu_);
   if (!IsCurrentCallOnChannel()) return;
   // Parse and validate the response.
-  absl::Status status = DecodeAdsResponse(payload, &context);
+  absl::Status status = delta_ ? DecodeDeltaAdsResponse(payload, &context)
+                               : DecodeAdsResponse(payload, &context);
   if (!status.ok()) {
     // Ignore unparsable response.
     LOG(ERROR) << "[xds_client " << xds_client() << "] xds server "
@@ -1336,8 +1693,9 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
                  << ", will NACK: nonce=" << state.nonce
                  << " status=" << state.status;
     }
-    // Delete resources not seen in update if needed.
-    if (context.type->AllResourcesRequiredInSotW()) {
+    // Delete resources not seen in update if needed.  In the delta
+    // protocol, deletions are instead reported in removed_resources.
+    if (!delta_ && context.type->AllResourcesRequiredInSotW()) {
       for (auto& [authority, authority_state] :
            xds_client()->authority_state_map_) {
         // Skip authorities that are not using this xDS channel.
@@ -1386,6 +1744,11 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
     xds_client()->metrics_reporter_->ReportResourceUpdates(
         xds_channel()->server_uri(), context.type_url,
         context.num_valid_resources, context.num_invalid_resources);
+    if (context.num_decodes_skipped > 0) {
+      xds_client()->metrics_reporter_->ReportResourceDecodesSkipped(
+          xds_channel()->server_uri(), context.type_url,
+          context.num_decodes_skipped);
+    }
   }
 }
 
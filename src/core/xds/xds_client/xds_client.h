@@ -328,6 +328,8 @@ class XdsClient : public DualRefCounted<XdsClient> {
     std::shared_ptr<const XdsResourceType::ResourceData> resource() const {
       return resource_;
     }
+    const std::string& version() const { return version_; }
+    const std::string& serialized_proto() const { return serialized_proto_; }
 
     const absl::Status& failed_status() const { return failed_status_; }
 
@@ -34,6 +34,12 @@ class XdsMetricsReporter {
                                      uint64_t num_invalid) = 0;
 
   virtual void ReportServerFailure(absl::string_view xds_server) = 0;
+
+  // Reports resources that were received but did not need to be decoded,
+  // because a decoded copy of the same bytes was already available.
+  virtual void ReportResourceDecodesSkipped(absl::string_view xds_server,
+                                            absl::string_view resource_type,
+                                            uint64_t num_skipped) = 0;
 };
 
 }  // namespace grpc_core
@@ -0,0 +1,92 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/xds/xds_client/xds_resource_cache.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/xxhash_inline.h"
+
+namespace grpc_core {
+
+XdsResourceCache::Key::Key(const XdsResourceType* type,
+                           const std::shared_ptr<XdsBootstrap>& bootstrap,
+                           const XdsBootstrap::XdsServer& server,
+                           absl::string_view serialized_resource)
+    : type_(type),
+      bootstrap_(bootstrap.get()),
+      bootstrap_ref_(bootstrap),
+      server_key_(server.Key()),
+      size_(serialized_resource.size()) {
+  XXH128_hash_t hash =
+      XXH3_128bits(serialized_resource.data(), serialized_resource.size());
+  hash_ = {hash.low64, hash.high64};
+}
+
+XdsResourceCache& XdsResourceCache::Get() {
+  static NoDestruct<XdsResourceCache> cache;
+  return *cache;
+}
+
+std::optional<XdsResourceCache::Resource> XdsResourceCache::Lookup(
+    const Key& key) {
+  MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return std::nullopt;
+  // If the bootstrap config is gone, the one we were given merely reuses
+  // its address.
+  if (it->first.bootstrap_ref_.expired()) {
+    entries_.erase(it);
+    return std::nullopt;
+  }
+  auto resource = it->second.resource.lock();
+  if (resource == nullptr) {
+    entries_.erase(it);
+    return std::nullopt;
+  }
+  return Resource{it->second.name, std::move(resource)};
+}
+
+void XdsResourceCache::Insert(
+    Key key, std::string name,
+    const std::shared_ptr<const XdsResourceType::ResourceData>& resource) {
+  MutexLock lock(&mu_);
+  if (entries_.size() >= prune_threshold_) {
+    PruneLocked();
+    prune_threshold_ = std::max<size_t>(64, entries_.size() * 2);
+  }
+  entries_.insert_or_assign(std::move(key), Entry{std::move(name), resource});
+}
+
+size_t XdsResourceCache::TestOnlySize() {
+  MutexLock lock(&mu_);
+  return entries_.size();
+}
+
+void XdsResourceCache::PruneLocked() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->first.bootstrap_ref_.expired() || it->second.resource.expired()) {
+      entries_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,116 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_XDS_XDS_CLIENT_XDS_RESOURCE_CACHE_H
+#define GRPC_SRC_CORE_XDS_XDS_CLIENT_XDS_RESOURCE_CACHE_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "src/core/util/sync.h"
+#include "src/core/xds/xds_client/xds_bootstrap.h"
+#include "src/core/xds/xds_client/xds_resource_type.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// A process-wide cache of decoded xDS resources, shared by all XdsClient
+// instances.  When several XdsClients talk to the same server with the
+// same bootstrap config, they typically receive byte-identical resources,
+// which then need to be decoded only once.
+//
+// Entries are keyed by the resource type, the bootstrap config, the xDS
+// server, and a 128-bit hash of the serialized resource.  They hold only
+// weak refs to the decoded resource, so an entry stays usable only as long
+// as some XdsClient is still holding the resource.
+class XdsResourceCache final {
+ public:
+  class Key final {
+   public:
+    Key(const XdsResourceType* type,
+        const std::shared_ptr<XdsBootstrap>& bootstrap,
+        const XdsBootstrap::XdsServer& server,
+        absl::string_view serialized_resource);
+
+    bool operator==(const Key& other) const {
+      return type_ == other.type_ && bootstrap_ == other.bootstrap_ &&
+             server_key_ == other.server_key_ && hash_ == other.hash_ &&
+             size_ == other.size_;
+    }
+
+    template <typename H>
+    friend H AbslHashValue(H h, const Key& key) {
+      return H::combine(std::move(h), key.type_, key.bootstrap_,
+                        key.server_key_, key.hash_.first, key.hash_.second,
+                        key.size_);
+    }
+
+   private:
+    friend class XdsResourceCache;
+
+    const XdsResourceType* type_;
+    const XdsBootstrap* bootstrap_;
+    // Used to make sure that the bootstrap config has not been replaced
+    // by a different one at the same address.
+    std::weak_ptr<XdsBootstrap> bootstrap_ref_;
+    std::string server_key_;
+    std::pair<uint64_t, uint64_t> hash_;
+    size_t size_;
+  };
+
+  struct Resource {
+    std::string name;
+    std::shared_ptr<const XdsResourceType::ResourceData> resource;
+  };
+
+  static XdsResourceCache& Get();
+
+  // Returns the cached resource for key, if any.
+  std::optional<Resource> Lookup(const Key& key);
+
+  // Adds a resource that was just decoded successfully.
+  void Insert(Key key, std::string name,
+              const std::shared_ptr<const XdsResourceType::ResourceData>&
+                  resource);
+
+  size_t TestOnlySize();
+
+ private:
+  struct Entry {
+    std::string name;
+    std::weak_ptr<const XdsResourceType::ResourceData> resource;
+  };
+
+  // Removes entries whose resource or bootstrap config is gone.
+  void PruneLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  Mutex mu_;
+  absl::flat_hash_map<Key, Entry> entries_ ABSL_GUARDED_BY(mu_);
+  // Size at which PruneLocked() is next run.
+  size_t prune_threshold_ ABSL_GUARDED_BY(mu_) = 64;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_XDS_XDS_CLIENT_XDS_RESOURCE_CACHE_H
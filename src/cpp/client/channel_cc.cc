@@ -136,8 +136,8 @@ grpc::internal::Call Channel::CreateCallInternal(
         rc->authority.has_value()
             ? std::optional<grpc_core::Slice>(rc->authority->Ref())
             : std::nullopt,
-        context->raw_deadline(),
-        /*registered_method=*/true, [context](grpc_core::Arena* arena) {
+        context->raw_deadline(), /*registered_method=*/&rc->config_cache,
+        [context](grpc_core::Arena* arena) {
           impl::CallContextRegistry::Propagate(context->context_elements_,
                                                arena);
         });
@@ -162,7 +162,7 @@ grpc::internal::Call Channel::CreateCallInternal(
             ? std::nullopt
             : std::optional<grpc_core::Slice>(grpc_core::CSliceRef(host_slice)),
         context->raw_deadline(),
-        /*registered_method=*/false, [context](grpc_core::Arena* arena) {
+        /*registered_method=*/nullptr, [context](grpc_core::Arena* arena) {
           impl::CallContextRegistry::Propagate(context->context_elements_,
                                                arena);
         });
@@ -46,6 +46,8 @@
 #include <vector>
 
 #include "src/core/ext/transport/chttp2/server/chttp2_server.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/server/method_admission.h"
 #include "src/core/server/server.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/string.h"
@@ -191,6 +193,12 @@ void ServerBuilder::experimental_type::EnableCallMetricRecording(
   builder_->server_metric_recorder_ = server_metric_recorder;
 }
 
+void ServerBuilder::experimental_type::SetMethodAdmissionConfig(
+    const std::string& json_config) {
+  builder_->AddChannelArgument(GRPC_ARG_SERVER_METHOD_ADMISSION_CONFIG,
+                               json_config);
+}
+
 ServerBuilder& ServerBuilder::SetOption(
     std::unique_ptr<ServerBuilderOption> option) {
   options_.push_back(std::move(option));
@@ -330,6 +338,21 @@ ServerBuilder& ServerBuilder::SetEventEngine(
 std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
   ChannelArguments args = BuildChannelArgs();
 
+  // == Validate the method admission config, which core can only ignore ==
+  {
+    grpc_channel_args c_args = args.c_channel_args();
+    auto admission_config =
+        grpc_core::ChannelArgs::FromC(&c_args).GetString(
+            GRPC_ARG_SERVER_METHOD_ADMISSION_CONFIG);
+    if (admission_config.has_value()) {
+      auto config = grpc_core::MethodAdmissionConfig::Parse(*admission_config);
+      if (!config.ok()) {
+        LOG(ERROR) << "Invalid method admission config: " << config.status();
+        return nullptr;
+      }
+    }
+  }
+
   // == Determine if the server has any synchronous methods ==
   bool has_sync_methods = false;
   for (const auto& value : services_) {
@@ -472,6 +495,7 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
   }
 
   server->RegisterContextAllocator(std::move(context_allocator_));
+  if (arena_message_allocation_) server->EnableArenaMessageAllocation();
 
   for (const auto& value : services_) {
     if (!server->RegisterService(value->host.get(), value->service)) {
@@ -1081,6 +1081,9 @@ bool Server::RegisterService(const std::string* addr, grpc::Service* service) {
       }
     } else {
       has_callback_methods_ = true;
+      if (arena_message_allocation_) {
+        method->handler()->EnableArenaMessageAllocation();
+      }
       grpc::internal::RpcServiceMethod* method_value = method.get();
       grpc::CompletionQueue* cq = CallbackCQ();
       grpc_server_register_completion_queue(server_, cq->cq(), nullptr);
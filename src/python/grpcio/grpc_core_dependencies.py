@@ -51,6 +51,8 @@ CORE_SOURCE_FILES = [
     'src/core/client_channel/lb_metadata.cc',
     'src/core/client_channel/load_balanced_call_destination.cc',
     'src/core/client_channel/local_subchannel_pool.cc',
+    'src/core/client_channel/response_cache_interceptor.cc',
+    'src/core/client_channel/response_cache_service_config.cc',
     'src/core/client_channel/retry_filter.cc',
     'src/core/client_channel/retry_filter_legacy_call_data.cc',
     'src/core/client_channel/retry_interceptor.cc',
@@ -552,6 +554,7 @@ CORE_SOURCE_FILES = [
     'src/core/handshaker/http_connect/http_proxy_mapper.cc',
     'src/core/handshaker/http_connect/xds_http_proxy_mapper.cc',
     'src/core/handshaker/proxy_mapper_registry.cc',
+    'src/core/handshaker/security/handshake_offload_pool.cc',
     'src/core/handshaker/security/pipelined_secure_endpoint.cc',
     'src/core/handshaker/security/secure_endpoint.cc',
     'src/core/handshaker/security/security_handshaker.cc',
@@ -571,6 +574,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/debug/trace.cc',
     'src/core/lib/debug/trace_flags.cc',
     'src/core/lib/event_engine/ares_resolver.cc',
+    'src/core/lib/event_engine/caching_dns_resolver.cc',
     'src/core/lib/event_engine/cf_engine/cf_engine.cc',
     'src/core/lib/event_engine/cf_engine/cfsocket_listener.cc',
     'src/core/lib/event_engine/cf_engine/cfstream_endpoint.cc',
@@ -793,9 +797,11 @@ CORE_SOURCE_FILES = [
     'src/core/resolver/xds/xds_dependency_manager.cc',
     'src/core/resolver/xds/xds_resolver.cc',
     'src/core/server/add_port.cc',
+    'src/core/server/method_admission.cc',
     'src/core/server/server.cc',
     'src/core/server/server_call_tracer_filter.cc',
     'src/core/server/server_config_selector_filter.cc',
+    'src/core/server/server_metrics.cc',
     'src/core/server/xds_channel_stack_modifier.cc',
     'src/core/server/xds_server_config_fetcher.cc',
     'src/core/server/xds_server_config_fetcher_legacy.cc',
@@ -840,6 +846,7 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
+    'src/core/tsi/ssl/session_cache/ssl_session_store.cc',
     'src/core/tsi/ssl_telemetry_utils.cc',
     'src/core/tsi/ssl_transport_security.cc',
     'src/core/tsi/ssl_transport_security_utils.cc',
@@ -849,6 +856,7 @@ CORE_SOURCE_FILES = [
     'src/core/util/address_sorting_init.cc',
     'src/core/util/alloc.cc',
     'src/core/util/backoff.cc',
+    'src/core/util/controlled_delay.cc',
     'src/core/util/crash.cc',
     'src/core/util/dump_args.cc',
     'src/core/util/event_log.cc',
@@ -966,6 +974,7 @@ CORE_SOURCE_FILES = [
     'src/core/xds/xds_client/xds_backend_metric_propagation.cc',
     'src/core/xds/xds_client/xds_bootstrap.cc',
     'src/core/xds/xds_client/xds_client.cc',
+    'src/core/xds/xds_client/xds_resource_cache.cc',
     'third_party/abseil-cpp/absl/base/internal/cycleclock.cc',
     'third_party/abseil-cpp/absl/base/internal/low_level_alloc.cc',
     'third_party/abseil-cpp/absl/base/internal/raw_logging.cc',
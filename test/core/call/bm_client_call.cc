@@ -24,6 +24,7 @@
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/service_config/service_config.h"
 
 namespace grpc_core {
 namespace {
@@ -62,9 +63,9 @@ class Helper {
     arena->SetContext<grpc_event_engine::experimental::EventEngine>(
         event_engine_.get());
     return std::unique_ptr<grpc_call, void (*)(grpc_call*)>(
-        MakeClientCall(nullptr, 0, cq_, path_.Copy(), std::nullopt, true,
-                       Timestamp::InfFuture(), compression_options_,
-                       std::move(arena), destination_),
+        MakeClientCall(nullptr, 0, cq_, path_.Copy(), std::nullopt,
+                       &config_cache_, Timestamp::InfFuture(),
+                       compression_options_, std::move(arena), destination_),
         grpc_call_unref);
   }
 
@@ -75,6 +76,7 @@ class Helper {
  private:
   grpc_completion_queue* cq_ = grpc_completion_queue_create_for_next(nullptr);
   Slice path_ = Slice::FromStaticString("/foo/bar");
+  RegisteredMethodConfigCache config_cache_;
   const grpc_compression_options compression_options_ = {
       1,
       {0, GRPC_COMPRESS_LEVEL_NONE},
@@ -19,6 +19,7 @@
 
 #include "src/core/call/metadata.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/service_config/service_config.h"
 #include "src/core/util/debug_location.h"
 #include "test/core/call/batch_builder.h"
 #include "test/core/call/yodel/yodel_test.h"
@@ -41,7 +42,9 @@ class ClientCallTest : public YodelTest {
       return authority_.has_value() ? std::optional<Slice>(authority_->Copy())
                                     : std::nullopt;
     }
-    bool registered_method() const { return registered_method_; }
+    RegisteredMethodConfigCache* registered_method() const {
+      return registered_method_;
+    }
     Duration timeout() const { return timeout_; }
     grpc_compression_options compression_options() const {
       return compression_options_;
@@ -55,7 +58,7 @@ class ClientCallTest : public YodelTest {
    private:
     Slice path_ = Slice::FromCopiedString(kDefaultPath);
     std::optional<Slice> authority_;
-    bool registered_method_ = false;
+    RegisteredMethodConfigCache* registered_method_ = nullptr;
     Duration timeout_ = Duration::Infinity();
     grpc_compression_options compression_options_ = {
         1,
@@ -28,6 +28,12 @@ const Slice kTestPath = Slice::FromExternalString("/foo/bar");
 
 class LoadBalancedCallDestinationTraits {
  public:
+  // Makes every pick wait on the picker observable, as before picks used
+  // the per-CPU picker cache.
+  void DisableCachedPicker() {
+    picker_observable_.TestOnlyDisableCachedPicker();
+  }
+
   RefCountedPtr<UnstartedCallDestination> CreateCallDestination(
       RefCountedPtr<UnstartedCallDestination> final_destination) {
     picker_observable_.Set(MakeRefCounted<TestPicker>(
@@ -117,6 +123,57 @@ void BM_LoadBalancedCallDestination(benchmark::State& state) {
 }
 BENCHMARK(BM_LoadBalancedCallDestination);
 
+// Starts calls through one LoadBalancedCallDestination from many threads, so
+// that every call does an LB pick through the channel's picker.
+// Argument: whether picks use the per-CPU picker cache (1) or wait on the
+// picker observable (0).
+void BM_LoadBalancedCallDestinationPick(benchmark::State& state) {
+  class FinalDestination : public UnstartedCallDestination {
+   public:
+    void StartCall(UnstartedCallHandler) override {}
+    void Orphaned() override {}
+  };
+  static LoadBalancedCallDestinationTraits* traits;
+  static RefCountedPtr<UnstartedCallDestination>* destination;
+  static RefCountedPtr<CallArenaAllocator>* arena_allocator;
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  if (state.thread_index() == 0) {
+    traits = new LoadBalancedCallDestinationTraits();
+    if (state.range(0) == 0) traits->DisableCachedPicker();
+    destination = new RefCountedPtr<UnstartedCallDestination>(
+        traits->CreateCallDestination(MakeRefCounted<FinalDestination>()));
+    arena_allocator = new RefCountedPtr<CallArenaAllocator>(
+        MakeRefCounted<CallArenaAllocator>(
+            ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+                "bm-allocator"),
+            1024));
+  }
+  for (auto _ : state) {
+    ExecCtx exec_ctx;
+    auto arena = (*arena_allocator)->MakeArena();
+    arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+        event_engine.get());
+    auto call =
+        MakeCallPair(traits->MakeClientInitialMetadata(), std::move(arena));
+    call.handler.SpawnInfallible("start", [&]() {
+      (*destination)->StartCall(std::move(call.handler));
+    });
+    call.initiator.SpawnCancel();
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    ExecCtx exec_ctx;
+    delete destination;
+    delete arena_allocator;
+    delete traits;
+  }
+}
+BENCHMARK(BM_LoadBalancedCallDestinationPick)
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
 }  // namespace
 }  // namespace grpc_core
 
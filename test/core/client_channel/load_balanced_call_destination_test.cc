@@ -190,6 +190,43 @@ LOAD_BALANCED_CALL_DESTINATION_TEST(StartCall) {
   WaitForAllPendingWork();
 }
 
+LOAD_BALANCED_CALL_DESTINATION_TEST(StartCallAfterPickerUpdate) {
+  // Start a call with the first picker, so that it gets cached.
+  auto first_picker = MakeRefCounted<StrictMock<MockPicker>>();
+  EXPECT_CALL(*first_picker, Pick)
+      .WillOnce([this](LoadBalancingPolicy::PickArgs) {
+        return LoadBalancingPolicy::PickResult::Complete{subchannel()};
+      });
+  picker().Set(first_picker);
+  auto call1 = MakeCall(MakeClientInitialMetadata());
+  SpawnTestSeq(call1.initiator, "initiator1",
+               [this, handler = std::move(call1.handler)]() {
+                 destination_under_test().StartCall(handler);
+               });
+  auto handler1 = TickUntilCallStarted();
+  // Update the picker.  The next call must not be picked using the cached
+  // first picker.
+  auto second_picker = MakeRefCounted<StrictMock<MockPicker>>();
+  EXPECT_CALL(*second_picker, Pick)
+      .WillOnce([this](LoadBalancingPolicy::PickArgs) {
+        return LoadBalancingPolicy::PickResult::Complete{subchannel()};
+      });
+  picker().Set(second_picker);
+  auto call2 = MakeCall(MakeClientInitialMetadata());
+  SpawnTestSeq(call2.initiator, "initiator2",
+               [this, handler = std::move(call2.handler)]() {
+                 destination_under_test().StartCall(handler);
+               });
+  auto handler2 = TickUntilCallStarted();
+  SpawnTestSeq(
+      call1.initiator, "cancel1",
+      [call_initiator = call1.initiator]() mutable { call_initiator.Cancel(); });
+  SpawnTestSeq(
+      call2.initiator, "cancel2",
+      [call_initiator = call2.initiator]() mutable { call_initiator.Cancel(); });
+  WaitForAllPendingWork();
+}
+
 LOAD_BALANCED_CALL_DESTINATION_TEST(StartCallOnDestroyedChannel) {
   // Create a call.
   auto call = MakeCall(MakeClientInitialMetadata());
@@ -0,0 +1,268 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+
+#include <memory>
+#include <string>
+
+#include "src/core/client_channel/response_cache_interceptor.h"
+#include "src/core/client_channel/response_cache_service_config.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/service_config/service_config.h"
+#include "src/core/service_config/service_config_impl.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace grpc_core {
+namespace testing {
+
+//
+// ResponseCache tests
+//
+
+class ResponseCacheTest : public ::testing::Test {
+ protected:
+  static std::shared_ptr<const ResponseCache::Response> MakeResponse(
+      absl::string_view payload) {
+    return std::make_shared<const ResponseCache::Response>(
+        ResponseCache::Response{
+            Arena::MakePooled<ServerMetadata>(),
+            Arena::MakePooled<Message>(
+                SliceBuffer(Slice::FromCopiedString(payload)), 0),
+            Arena::MakePooled<ServerMetadata>()});
+  }
+
+  static std::string Payload(const ResponseCache::Response& response) {
+    return response.message->payload()->JoinIntoString();
+  }
+
+  RefCountedPtr<ResponseCache> MakeCache(size_t max_size_bytes) {
+    return MakeRefCounted<ResponseCache>(
+        max_size_bytes, ResourceQuota::Default()->memory_quota());
+  }
+
+  ExecCtx exec_ctx_;
+};
+
+TEST_F(ResponseCacheTest, MissThenHit) {
+  auto cache = MakeCache(1024);
+  auto lookup = cache->Lookup("key");
+  EXPECT_EQ(lookup.response, nullptr);
+  ASSERT_NE(lookup.in_flight, nullptr);
+  EXPECT_TRUE(lookup.is_leader);
+  cache->Finish("key", lookup.in_flight, MakeResponse("hello"),
+                Duration::Seconds(10));
+  lookup = cache->Lookup("key");
+  ASSERT_NE(lookup.response, nullptr);
+  EXPECT_EQ(Payload(*lookup.response), "hello");
+  EXPECT_EQ(lookup.in_flight, nullptr);
+  EXPECT_GT(cache->size_bytes(), 0);
+}
+
+TEST_F(ResponseCacheTest, ConcurrentMissesAreCoalesced) {
+  auto cache = MakeCache(1024);
+  auto leader = cache->Lookup("key");
+  ASSERT_TRUE(leader.is_leader);
+  auto follower = cache->Lookup("key");
+  EXPECT_FALSE(follower.is_leader);
+  EXPECT_EQ(follower.in_flight, leader.in_flight);
+  // A different key gets its own leader.
+  EXPECT_TRUE(cache->Lookup("other").is_leader);
+  cache->Finish("key", leader.in_flight, MakeResponse("hello"),
+                Duration::Seconds(10));
+  ASSERT_NE(follower.in_flight->response(), nullptr);
+  EXPECT_EQ(Payload(*follower.in_flight->response()), "hello");
+}
+
+TEST_F(ResponseCacheTest, UncacheableResponseReleasesFollowers) {
+  auto cache = MakeCache(1024);
+  auto leader = cache->Lookup("key");
+  auto follower = cache->Lookup("key");
+  cache->Finish("key", leader.in_flight, nullptr, Duration::Seconds(10));
+  EXPECT_EQ(follower.in_flight->response(), nullptr);
+  // Nothing was cached, so the next caller leads a new request.
+  auto next = cache->Lookup("key");
+  EXPECT_EQ(next.response, nullptr);
+  EXPECT_TRUE(next.is_leader);
+  EXPECT_NE(next.in_flight, leader.in_flight);
+  EXPECT_EQ(cache->size_bytes(), 0);
+}
+
+TEST_F(ResponseCacheTest, FinishIsIdempotent) {
+  auto cache = MakeCache(1024);
+  auto leader = cache->Lookup("key");
+  cache->Finish("key", leader.in_flight, nullptr, Duration::Seconds(10));
+  auto next = cache->Lookup("key");
+  // A stale leader must not complete the new in-flight request.
+  cache->Finish("key", leader.in_flight, MakeResponse("stale"),
+                Duration::Seconds(10));
+  EXPECT_EQ(cache->Lookup("key").in_flight, next.in_flight);
+}
+
+TEST_F(ResponseCacheTest, ExpiredEntryIsAMiss) {
+  auto cache = MakeCache(1024);
+  auto leader = cache->Lookup("key");
+  cache->Finish("key", leader.in_flight, MakeResponse("hello"),
+                Duration::Zero());
+  auto lookup = cache->Lookup("key");
+  EXPECT_EQ(lookup.response, nullptr);
+  EXPECT_TRUE(lookup.is_leader);
+  EXPECT_EQ(cache->size_bytes(), 0);
+}
+
+TEST_F(ResponseCacheTest, EvictsLeastRecentlyUsed) {
+  const std::string payload(100, 'x');
+  // Room for two entries but not three.
+  auto cache = MakeCache(250);
+  for (absl::string_view key : {"a", "b"}) {
+    auto lookup = cache->Lookup(key);
+    cache->Finish(key, lookup.in_flight, MakeResponse(payload),
+                  Duration::Seconds(10));
+  }
+  // Touch "a" so that "b" is the least recently used.
+  EXPECT_NE(cache->Lookup("a").response, nullptr);
+  auto lookup = cache->Lookup("c");
+  cache->Finish("c", lookup.in_flight, MakeResponse(payload),
+                Duration::Seconds(10));
+  EXPECT_NE(cache->Lookup("a").response, nullptr);
+  EXPECT_NE(cache->Lookup("c").response, nullptr);
+  EXPECT_EQ(cache->Lookup("b").response, nullptr);
+  EXPECT_LE(cache->size_bytes(), 250);
+}
+
+TEST_F(ResponseCacheTest, OversizedResponseIsNotCached) {
+  auto cache = MakeCache(16);
+  auto leader = cache->Lookup("key");
+  auto follower = cache->Lookup("key");
+  cache->Finish("key", leader.in_flight, MakeResponse(std::string(100, 'x')),
+                Duration::Seconds(10));
+  // Followers still get the response even though it was not cached.
+  EXPECT_NE(follower.in_flight->response(), nullptr);
+  EXPECT_EQ(cache->Lookup("key").response, nullptr);
+  EXPECT_EQ(cache->size_bytes(), 0);
+}
+
+//
+// ResponseCacheServiceConfigParser tests
+//
+
+class ResponseCacheParserTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    parser_index_ =
+        CoreConfiguration::Get().service_config_parser().GetParserIndex(
+            "response_cache");
+  }
+
+  size_t parser_index_;
+};
+
+TEST_F(ResponseCacheParserTest, ValidPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"responseCachePolicy\": {\n"
+      "      \"ttl\": \"10s\",\n"
+      "      \"keyMetadata\": [ \"x-user\" ]\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  const auto* parsed_config = static_cast<ResponseCacheMethodConfig*>(
+      ((*vector_ptr)[parser_index_]).get());
+  ASSERT_NE(parsed_config, nullptr);
+  EXPECT_EQ(parsed_config->ttl(), Duration::Seconds(10));
+  EXPECT_THAT(parsed_config->key_metadata(),
+              ::testing::ElementsAre("x-user"));
+}
+
+TEST_F(ResponseCacheParserTest, NoPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ]\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  EXPECT_EQ(((*vector_ptr)[parser_index_]).get(), nullptr);
+}
+
+TEST_F(ResponseCacheParserTest, InvalidPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"responseCachePolicy\": {\n"
+      "      \"ttl\": \"0s\",\n"
+      "      \"keyMetadata\": [ \"X-User\", \"\" ]\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].responseCachePolicy.keyMetadata[0] "
+            "error:must be lower case; "
+            "field:methodConfig[0].responseCachePolicy.keyMetadata[1] "
+            "error:must be non-empty; "
+            "field:methodConfig[0].responseCachePolicy.ttl "
+            "error:must be greater than 0]")
+      << service_config.status();
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
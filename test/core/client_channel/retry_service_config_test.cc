@@ -112,6 +112,81 @@ TEST_F(RetryParserTest, InvalidRetryThrottlingInvalidTokenRatio) {
             "could not parse as a number]");
 }
 
+TEST_F(RetryParserTest, ValidRetryBudget) {
+  const char* test_json =
+      "{\n"
+      "  \"retryBudget\": {\n"
+      "    \"budgetPercent\": 20,\n"
+      "    \"minRetriesPerSecond\": 5,\n"
+      "    \"ttl\": \"30s\"\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* parsed_config = static_cast<RetryGlobalConfig*>(
+      (*service_config)->GetGlobalParsedConfig(parser_index_));
+  ASSERT_NE(parsed_config, nullptr);
+  EXPECT_EQ(parsed_config->max_milli_tokens(), 0);
+  ASSERT_TRUE(parsed_config->retry_budget().has_value());
+  EXPECT_EQ(parsed_config->retry_budget()->budget_percent(), 20);
+  EXPECT_EQ(parsed_config->retry_budget()->min_retries_per_second(), 5);
+  EXPECT_EQ(parsed_config->retry_budget()->ttl(), Duration::Seconds(30));
+}
+
+TEST_F(RetryParserTest, RetryBudgetDefaults) {
+  const char* test_json =
+      "{\n"
+      "  \"retryBudget\": {\n"
+      "    \"budgetPercent\": 10\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* parsed_config = static_cast<RetryGlobalConfig*>(
+      (*service_config)->GetGlobalParsedConfig(parser_index_));
+  ASSERT_NE(parsed_config, nullptr);
+  ASSERT_TRUE(parsed_config->retry_budget().has_value());
+  EXPECT_EQ(parsed_config->retry_budget()->min_retries_per_second(), 10);
+  EXPECT_EQ(parsed_config->retry_budget()->ttl(), Duration::Seconds(10));
+}
+
+TEST_F(RetryParserTest, InvalidRetryBudget) {
+  const char* test_json =
+      "{\n"
+      "  \"retryBudget\": {\n"
+      "    \"budgetPercent\": 150,\n"
+      "    \"ttl\": \"0.5s\"\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:retryBudget.budgetPercent "
+            "error:must be in the range [0, 100]; "
+            "field:retryBudget.ttl error:must be in the range [1s, 60s]]")
+      << service_config.status();
+}
+
+TEST_F(RetryParserTest, RetryBudgetWithRetryThrottling) {
+  const char* test_json =
+      "{\n"
+      "  \"retryThrottling\": {\n"
+      "    \"maxTokens\": 2,\n"
+      "    \"tokenRatio\": 1.0\n"
+      "  },\n"
+      "  \"retryBudget\": {\n"
+      "    \"budgetPercent\": 20\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:retryBudget error:cannot be combined with retryThrottling]")
+      << service_config.status();
+}
+
 TEST_F(RetryParserTest, ValidRetryPolicy) {
   const char* test_json =
       "{\n"
@@ -18,6 +18,13 @@
 
 #include "src/core/client_channel/retry_throttle.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "src/core/client_channel/retry_service_config.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/json/json_reader.h"
 #include "test/core/test_util/test_config.h"
 #include "gtest/gtest.h"
 
@@ -25,6 +32,14 @@ namespace grpc_core {
 namespace internal {
 namespace {
 
+RetryGlobalConfig::RetryBudget MakeRetryBudget(absl::string_view json) {
+  auto parsed = JsonParse(json);
+  EXPECT_TRUE(parsed.ok()) << parsed.status();
+  auto budget = LoadFromJson<RetryGlobalConfig::RetryBudget>(*parsed);
+  EXPECT_TRUE(budget.ok()) << budget.status();
+  return *budget;
+}
+
 TEST(RetryThrottler, Basic) {
   // Max token count is 4, so threshold for retrying is 2.
   // Token count starts at 4.
@@ -104,6 +119,127 @@ TEST(RetryThrottler, Replacement) {
   EXPECT_FALSE(throttler->RecordFailure());
 }
 
+TEST(RetryThrottler, BudgetAllowsMinimumRetries) {
+  // 1 retry/s over a 10s window allows 10 retries with no traffic.
+  auto throttler = RetryThrottler::Create(
+      MakeRetryBudget(
+          R"json({"budgetPercent": 20, "minRetriesPerSecond": 1,)json"
+          R"json( "ttl": "10s"})json"),
+      nullptr);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(throttler->RecordFailure()) << i;
+    EXPECT_TRUE(throttler->RecordRetry()) << i;
+  }
+  EXPECT_FALSE(throttler->RecordFailure());
+}
+
+TEST(RetryThrottler, BudgetScalesWithSuccesses) {
+  auto throttler = RetryThrottler::Create(
+      MakeRetryBudget(
+          R"json({"budgetPercent": 20, "minRetriesPerSecond": 0})json"),
+      nullptr);
+  // No successes and no minimum: nothing may be retried.
+  EXPECT_FALSE(throttler->RecordFailure());
+  for (int i = 0; i < 100; ++i) throttler->RecordSuccess();
+  // 20% of 100 successes.
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_TRUE(throttler->RecordFailure()) << i;
+    EXPECT_TRUE(throttler->RecordRetry()) << i;
+  }
+  EXPECT_FALSE(throttler->RecordFailure());
+  // Each further success earns a fifth of a retry.
+  for (int i = 0; i < 5; ++i) throttler->RecordSuccess();
+  EXPECT_TRUE(throttler->RecordFailure());
+  EXPECT_TRUE(throttler->RecordRetry());
+  EXPECT_FALSE(throttler->RecordFailure());
+}
+
+TEST(RetryThrottler, BudgetOnlyChargesRetriesSent) {
+  auto throttler = RetryThrottler::Create(
+      MakeRetryBudget(
+          R"json({"budgetPercent": 20, "minRetriesPerSecond": 1,)json"
+          R"json( "ttl": "10s"})json"),
+      nullptr);
+  // Failures that are not retried, e.g. because the call has used up
+  // max_attempts, leave the budget unchanged.
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(throttler->RecordFailure()) << i;
+  }
+  // The full minimum of 10 retries is still available.
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(throttler->RecordFailure()) << i;
+    EXPECT_TRUE(throttler->RecordRetry()) << i;
+  }
+  EXPECT_FALSE(throttler->RecordFailure());
+}
+
+TEST(RetryThrottler, BudgetRechecksWhenChargingRetries) {
+  auto throttler = RetryThrottler::Create(
+      MakeRetryBudget(
+          R"json({"budgetPercent": 20, "minRetriesPerSecond": 1,)json"
+          R"json( "ttl": "1s"})json"),
+      nullptr);
+  // Both failures see the one retry the budget allows, but only the first
+  // retry charged gets it.
+  EXPECT_TRUE(throttler->RecordFailure());
+  EXPECT_TRUE(throttler->RecordFailure());
+  EXPECT_TRUE(throttler->RecordRetry());
+  EXPECT_FALSE(throttler->RecordRetry());
+  EXPECT_FALSE(throttler->RecordFailure());
+}
+
+TEST(RetryThrottler, BudgetIsNotOverdrawnByConcurrentRetries) {
+  // 1 retry/s over a 10s window allows 10 retries with no traffic.
+  auto throttler = RetryThrottler::Create(
+      MakeRetryBudget(
+          R"json({"budgetPercent": 20, "minRetriesPerSecond": 1,)json"
+          R"json( "ttl": "10s"})json"),
+      nullptr);
+  std::atomic<int> retries_sent{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < 100; ++j) {
+        if (throttler->RecordFailure() && throttler->RecordRetry()) {
+          retries_sent.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+  EXPECT_EQ(retries_sent.load(), 10);
+}
+
+TEST(RetryThrottler, TokenBucketChargesFailuresNotRetries) {
+  // Max token count is 4, so threshold for retrying is 2.
+  auto throttler = RetryThrottler::Create(4000, 1000, nullptr);
+  // Recording retries does not touch the token bucket.
+  for (int i = 0; i < 10; ++i) EXPECT_TRUE(throttler->RecordRetry());
+  EXPECT_EQ(throttler->milli_tokens(), 4000);
+  EXPECT_TRUE(throttler->RecordFailure());
+  EXPECT_EQ(throttler->milli_tokens(), 3000);
+}
+
+TEST(RetryThrottler, ReplaceTokenBucketWithBudget) {
+  auto old_throttler = RetryThrottler::Create(4000, 1000, nullptr);
+  auto budget = MakeRetryBudget(
+      R"json({"budgetPercent": 10, "minRetriesPerSecond": 0})json");
+  auto throttler = RetryThrottler::Create(budget, old_throttler);
+  EXPECT_NE(old_throttler, throttler);
+  // The same budget returns the same object.
+  EXPECT_EQ(RetryThrottler::Create(budget, throttler), throttler);
+  // The old throttler now defers to the budget, which is empty.
+  EXPECT_FALSE(old_throttler->RecordFailure());
+  for (int i = 0; i < 10; ++i) old_throttler->RecordSuccess();
+  EXPECT_TRUE(throttler->RecordFailure());
+  EXPECT_TRUE(old_throttler->RecordRetry());
+  EXPECT_FALSE(old_throttler->RecordFailure());
+  // Switching back to a token bucket starts with a full bucket.
+  auto new_throttler = RetryThrottler::Create(4000, 1000, throttler);
+  EXPECT_EQ(new_throttler->milli_tokens(), 4000);
+  EXPECT_TRUE(throttler->RecordFailure());
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc_core
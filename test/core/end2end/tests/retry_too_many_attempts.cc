@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/util/time.h"
@@ -95,5 +96,74 @@ CORE_END2END_TEST(RetryTests, RetryTooManyAttempts) {
   EXPECT_EQ(s2.method(), "/service/method");
   EXPECT_FALSE(client_close.was_cancelled());
 }
+
+// Tests that a failed attempt that is not retried because the call ran
+// out of attempts is not charged to the retry budget.
+// - the budget allows one retry per success, with no minimum
+// - each call allows 1 retry for ABORTED status
+// - two calls succeed, earning a budget of 2 retries
+// - both attempts of the next call get ABORTED, so one retry is charged
+// - the first attempt of the last call gets ABORTED and is still retried
+CORE_END2END_TEST(RetryTests, RetryTooManyAttemptsDoesNotChargeBudget) {
+  InitServer(DefaultServerArgs());
+  InitClient(ChannelArgs().Set(
+      GRPC_ARG_SERVICE_CONFIG,
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"service\", \"method\": \"method\" }\n"
+      "    ],\n"
+      "    \"retryPolicy\": {\n"
+      "      \"maxAttempts\": 2,\n"
+      "      \"initialBackoff\": \"1s\",\n"
+      "      \"maxBackoff\": \"120s\",\n"
+      "      \"backoffMultiplier\": 1.6,\n"
+      "      \"retryableStatusCodes\": [ \"ABORTED\" ]\n"
+      "    }\n"
+      "  } ],\n"
+      "  \"retryBudget\": {\n"
+      "    \"budgetPercent\": 100,\n"
+      "    \"minRetriesPerSecond\": 0,\n"
+      "    \"ttl\": \"60s\"\n"
+      "  }\n"
+      "}"));
+  // Runs a call whose attempts get the given statuses from the server.
+  auto run_call = [&](std::vector<grpc_status_code> attempt_statuses) {
+    auto c = NewClientCall("/service/method")
+                 .Timeout(Duration::Seconds(5))
+                 .Create();
+    IncomingStatusOnClient server_status;
+    IncomingMetadata server_initial_metadata;
+    IncomingMessage server_message;
+    c.NewBatch(1)
+        .SendInitialMetadata({})
+        .SendMessage("foo")
+        .RecvMessage(server_message)
+        .SendCloseFromClient()
+        .RecvInitialMetadata(server_initial_metadata)
+        .RecvStatusOnClient(server_status);
+    for (size_t i = 0; i < attempt_statuses.size(); ++i) {
+      const int tag = 100 * (i + 1);
+      auto s = RequestCall(tag + 1);
+      Expect(tag + 1, true);
+      Step();
+      IncomingCloseOnServer client_close;
+      s.NewBatch(tag + 2)
+          .SendInitialMetadata({})
+          .SendStatusFromServer(attempt_statuses[i], "xyz", {})
+          .RecvCloseOnServer(client_close);
+      Expect(tag + 2, true);
+      if (i + 1 == attempt_statuses.size()) Expect(1, true);
+      Step();
+    }
+    EXPECT_EQ(server_status.status(), attempt_statuses.back());
+  };
+  run_call({GRPC_STATUS_OK});
+  run_call({GRPC_STATUS_OK});
+  run_call({GRPC_STATUS_ABORTED, GRPC_STATUS_ABORTED});
+  // The second attempt only reaches the server if the budget still has
+  // room for a retry.
+  run_call({GRPC_STATUS_ABORTED, GRPC_STATUS_ABORTED});
+}
 }  // namespace
 }  // namespace grpc_core
@@ -0,0 +1,278 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/caching_dns_resolver.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "test/core/event_engine/util/delegating_event_engine.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace grpc_event_engine::experimental {
+namespace {
+
+using grpc_core::Duration;
+
+// An EventEngine whose DNS resolvers hold hostname lookups until the test
+// completes them.
+class FakeDNSEventEngine final : public DelegatingEventEngine {
+ public:
+  absl::StatusOr<std::unique_ptr<DNSResolver>> GetDNSResolver(
+      const DNSResolver::ResolverOptions& /*options*/) override {
+    return std::make_unique<FakeDNSResolver>(this);
+  }
+
+  int queries() {
+    grpc_core::MutexLock lock(&mu_);
+    return queries_;
+  }
+
+  // Completes the oldest pending hostname lookup.
+  void CompleteLookup(
+      absl::StatusOr<std::vector<ResolvedAddress>> addresses) {
+    DNSResolver::LookupHostnameCallback on_resolve;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      ASSERT_FALSE(pending_.empty());
+      on_resolve = std::move(pending_.front());
+      pending_.erase(pending_.begin());
+    }
+    on_resolve(std::move(addresses));
+  }
+
+ private:
+  class FakeDNSResolver final : public DNSResolver {
+   public:
+    explicit FakeDNSResolver(FakeDNSEventEngine* engine) : engine_(engine) {}
+
+    void LookupHostname(LookupHostnameCallback on_resolve,
+                        absl::string_view /*name*/,
+                        absl::string_view /*default_port*/) override {
+      grpc_core::MutexLock lock(&engine_->mu_);
+      ++engine_->queries_;
+      engine_->pending_.push_back(std::move(on_resolve));
+    }
+    void LookupSRV(LookupSRVCallback on_resolve,
+                   absl::string_view /*name*/) override {
+      engine_->Run([on_resolve = std::move(on_resolve)]() mutable {
+        on_resolve(absl::UnimplementedError("SRV"));
+      });
+    }
+    void LookupTXT(LookupTXTCallback on_resolve,
+                   absl::string_view /*name*/) override {
+      engine_->Run([on_resolve = std::move(on_resolve)]() mutable {
+        on_resolve(absl::UnimplementedError("TXT"));
+      });
+    }
+
+   private:
+    FakeDNSEventEngine* engine_;
+  };
+
+  grpc_core::Mutex mu_;
+  int queries_ ABSL_GUARDED_BY(mu_) = 0;
+  std::vector<DNSResolver::LookupHostnameCallback> pending_
+      ABSL_GUARDED_BY(mu_);
+};
+
+struct LookupResult {
+  grpc_core::Notification done;
+  absl::StatusOr<std::vector<EventEngine::ResolvedAddress>> addresses;
+};
+
+class CachingDNSResolverTest : public ::testing::Test {
+ protected:
+  void SetUp() override { CachingDNSResolver::TestOnlyClearCache(); }
+
+  std::unique_ptr<CachingDNSResolver> MakeResolver(
+      DNSCacheOptions options, std::string dns_server = "") {
+    return std::make_unique<CachingDNSResolver>(
+        engine_, EventEngine::DNSResolver::ResolverOptions{dns_server},
+        options);
+  }
+
+  static std::shared_ptr<LookupResult> Lookup(CachingDNSResolver* resolver,
+                                              absl::string_view name) {
+    auto result = std::make_shared<LookupResult>();
+    resolver->LookupHostname(
+        [result](absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
+                     addresses) {
+          result->addresses = std::move(addresses);
+          result->done.Notify();
+        },
+        name, "443");
+    return result;
+  }
+
+  static std::vector<EventEngine::ResolvedAddress> Addresses(size_t n) {
+    return std::vector<EventEngine::ResolvedAddress>(n);
+  }
+
+  std::shared_ptr<FakeDNSEventEngine> engine_ =
+      std::make_shared<FakeDNSEventEngine>();
+};
+
+TEST_F(CachingDNSResolverTest, CoalescesConcurrentLookups) {
+  auto resolver1 = MakeResolver({Duration::Hours(1)});
+  auto resolver2 = MakeResolver({Duration::Hours(1)});
+  auto result1 = Lookup(resolver1.get(), "foo");
+  auto result2 = Lookup(resolver2.get(), "foo");
+  EXPECT_EQ(engine_->queries(), 1);
+  EXPECT_FALSE(result1->done.HasBeenNotified());
+  engine_->CompleteLookup(Addresses(2));
+  result1->done.WaitForNotification();
+  result2->done.WaitForNotification();
+  ASSERT_TRUE(result1->addresses.ok());
+  EXPECT_EQ(result1->addresses->size(), 2);
+  ASSERT_TRUE(result2->addresses.ok());
+  EXPECT_EQ(result2->addresses->size(), 2);
+}
+
+TEST_F(CachingDNSResolverTest, ServesCachedResultWithinTtl) {
+  auto resolver = MakeResolver({Duration::Hours(1)});
+  auto result = Lookup(resolver.get(), "foo");
+  engine_->CompleteLookup(Addresses(2));
+  result->done.WaitForNotification();
+  auto other_resolver = MakeResolver({Duration::Hours(1)});
+  result = Lookup(other_resolver.get(), "foo");
+  result->done.WaitForNotification();
+  ASSERT_TRUE(result->addresses.ok());
+  EXPECT_EQ(result->addresses->size(), 2);
+  EXPECT_EQ(engine_->queries(), 1);
+}
+
+TEST_F(CachingDNSResolverTest, QueriesAgainAfterTtl) {
+  auto resolver = MakeResolver({Duration::Milliseconds(100)});
+  auto result = Lookup(resolver.get(), "foo");
+  engine_->CompleteLookup(Addresses(2));
+  result->done.WaitForNotification();
+  absl::SleepFor(absl::Milliseconds(200));
+  result = Lookup(resolver.get(), "foo");
+  EXPECT_EQ(engine_->queries(), 2);
+  EXPECT_FALSE(result->done.HasBeenNotified());
+  engine_->CompleteLookup(Addresses(3));
+  result->done.WaitForNotification();
+  ASSERT_TRUE(result->addresses.ok());
+  EXPECT_EQ(result->addresses->size(), 3);
+}
+
+TEST_F(CachingDNSResolverTest, CachesFailuresForNegativeTtl) {
+  auto resolver =
+      MakeResolver({Duration::Hours(1), /*negative_ttl=*/Duration::Hours(1)});
+  auto result = Lookup(resolver.get(), "foo");
+  engine_->CompleteLookup(absl::NotFoundError("foo"));
+  result->done.WaitForNotification();
+  result = Lookup(resolver.get(), "foo");
+  result->done.WaitForNotification();
+  EXPECT_EQ(result->addresses.status().code(), absl::StatusCode::kNotFound);
+  EXPECT_EQ(engine_->queries(), 1);
+}
+
+TEST_F(CachingDNSResolverTest, DoesNotCacheFailuresWithoutNegativeTtl) {
+  auto resolver = MakeResolver({Duration::Hours(1)});
+  auto result = Lookup(resolver.get(), "foo");
+  engine_->CompleteLookup(absl::NotFoundError("foo"));
+  result->done.WaitForNotification();
+  EXPECT_EQ(result->addresses.status().code(), absl::StatusCode::kNotFound);
+  result = Lookup(resolver.get(), "foo");
+  EXPECT_EQ(engine_->queries(), 2);
+  engine_->CompleteLookup(Addresses(1));
+  result->done.WaitForNotification();
+  EXPECT_TRUE(result->addresses.ok());
+}
+
+TEST_F(CachingDNSResolverTest, ServesStaleResultWhileRefreshing) {
+  auto resolver = MakeResolver({Duration::Milliseconds(100), Duration::Zero(),
+                                /*stale_ttl=*/Duration::Hours(1)});
+  auto result = Lookup(resolver.get(), "foo");
+  engine_->CompleteLookup(Addresses(2));
+  result->done.WaitForNotification();
+  absl::SleepFor(absl::Milliseconds(200));
+  // The stale result is returned at once, and a refresh is started.
+  result = Lookup(resolver.get(), "foo");
+  result->done.WaitForNotification();
+  ASSERT_TRUE(result->addresses.ok());
+  EXPECT_EQ(result->addresses->size(), 2);
+  EXPECT_EQ(engine_->queries(), 2);
+  // A failed refresh keeps the stale result.
+  engine_->CompleteLookup(absl::UnavailableError("refresh failed"));
+  result = Lookup(resolver.get(), "foo");
+  result->done.WaitForNotification();
+  ASSERT_TRUE(result->addresses.ok());
+  EXPECT_EQ(result->addresses->size(), 2);
+  EXPECT_EQ(engine_->queries(), 3);
+  engine_->CompleteLookup(Addresses(3));
+  result = Lookup(resolver.get(), "foo");
+  result->done.WaitForNotification();
+  ASSERT_TRUE(result->addresses.ok());
+  EXPECT_EQ(result->addresses->size(), 3);
+  EXPECT_EQ(engine_->queries(), 3);
+}
+
+TEST_F(CachingDNSResolverTest, DoesNotShareAcrossNamesOrServers) {
+  auto resolver = MakeResolver({Duration::Hours(1)});
+  auto other_server_resolver =
+      MakeResolver({Duration::Hours(1)}, "8.8.8.8:53");
+  auto result1 = Lookup(resolver.get(), "foo");
+  auto result2 = Lookup(resolver.get(), "bar");
+  auto result3 = Lookup(other_server_resolver.get(), "foo");
+  EXPECT_EQ(engine_->queries(), 3);
+  for (int i = 0; i < 3; ++i) engine_->CompleteLookup(Addresses(1));
+  result1->done.WaitForNotification();
+  result2->done.WaitForNotification();
+  result3->done.WaitForNotification();
+}
+
+TEST_F(CachingDNSResolverTest, CancelsWaitingLookupsOnDestruction) {
+  auto resolver = MakeResolver({Duration::Hours(1)});
+  auto result = Lookup(resolver.get(), "foo");
+  resolver.reset();
+  result->done.WaitForNotification();
+  EXPECT_EQ(result->addresses.status().code(), absl::StatusCode::kCancelled);
+  // The query still completes, and its result is cached.
+  engine_->CompleteLookup(Addresses(2));
+  resolver = MakeResolver({Duration::Hours(1)});
+  result = Lookup(resolver.get(), "foo");
+  result->done.WaitForNotification();
+  ASSERT_TRUE(result->addresses.ok());
+  EXPECT_EQ(result->addresses->size(), 2);
+  EXPECT_EQ(engine_->queries(), 1);
+}
+
+}  // namespace
+}  // namespace grpc_event_engine::experimental
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
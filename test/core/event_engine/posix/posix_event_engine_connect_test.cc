@@ -31,7 +31,10 @@
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/extensions/supports_fd.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -204,6 +207,55 @@ TEST(PosixEventEngineTest, IndefiniteConnectCancellationTest) {
   grpc_core::WaitForSingleOwner(std::move(posix_ee));
 }
 
+TEST(PosixEventEngineTest, ListenerShardsShareThePort) {
+  if (!IsSocketReusePortSupported()) {
+    GTEST_SKIP() << "SO_REUSEPORT is not supported";
+  }
+  constexpr int kShards = 4;
+  std::string target_addr = absl::StrCat(
+      "ipv6:[::1]:", std::to_string(grpc_pick_unused_port_or_die()));
+  auto resolved_addr = URIToResolvedAddress(target_addr);
+  GRPC_CHECK_OK(resolved_addr);
+  std::shared_ptr<PosixEventEngine> posix_ee =
+      PosixEventEngine::MakePosixEventEngine();
+  grpc_core::ChannelArgs args;
+  args = args.Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default())
+             .Set(GRPC_ARG_ALLOW_REUSEPORT, 1)
+             .Set(GRPC_ARG_TCP_LISTENER_SHARDS, kShards);
+  ChannelArgsEndpointConfig config(args);
+  grpc_core::Notification shutdown;
+  auto listener = posix_ee->CreatePosixListener(
+      [](int, std::unique_ptr<EventEngine::Endpoint>, bool, MemoryAllocator,
+         SliceBuffer*) {},
+      [&shutdown](absl::Status) { shutdown.Notify(); }, config,
+      std::make_unique<grpc_core::MemoryQuota>(
+          grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+              "bar")));
+  GRPC_CHECK_OK(listener);
+  auto* supports_fd =
+      QueryExtension<ListenerSupportsFdExtension>(listener->get());
+  ASSERT_NE(supports_fd, nullptr);
+  std::vector<int> listener_fds;
+  auto port = supports_fd->BindWithFd(
+      *resolved_addr, [&listener_fds](absl::StatusOr<int> listener_fd) {
+        ASSERT_TRUE(listener_fd.ok());
+        listener_fds.push_back(*listener_fd);
+      });
+  ASSERT_TRUE(port.ok()) << port.status();
+  EXPECT_EQ(listener_fds.size(), static_cast<size_t>(kShards));
+  for (int fd : listener_fds) {
+    sockaddr_storage storage;
+    socklen_t len = sizeof(storage);
+    ASSERT_EQ(getsockname(fd, reinterpret_cast<sockaddr*>(&storage), &len), 0);
+    EXPECT_EQ(ResolvedAddressGetPort(EventEngine::ResolvedAddress(
+                  reinterpret_cast<sockaddr*>(&storage), len)),
+              *port);
+  }
+  listener->reset();
+  shutdown.WaitForNotification();
+  grpc_core::WaitForSingleOwner(std::move(posix_ee));
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
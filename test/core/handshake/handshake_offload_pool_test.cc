@@ -0,0 +1,287 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/handshaker/security/handshake_offload_pool.h"
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/time.h>
+
+#include <atomic>
+#include <vector>
+
+#include "src/core/credentials/transport/fake/fake_credentials.h"
+#include "src/core/credentials/transport/security_connector.h"
+#include "src/core/handshaker/handshaker.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Records the outcome of every step run through the pool.
+class StepRecorder {
+ public:
+  HandshakeOffloadPool::Step Step(Notification* release = nullptr) {
+    return [this, release](absl::StatusOr<int64_t> queue_time) {
+      const int running = running_.fetch_add(1) + 1;
+      int max_running = max_running_.load();
+      while (running > max_running &&
+             !max_running_.compare_exchange_weak(max_running, running)) {
+      }
+      if (queue_time.ok() && release != nullptr) {
+        release->WaitForNotification();
+      }
+      running_.fetch_sub(1);
+      MutexLock lock(&mu_);
+      statuses_.push_back(queue_time.status());
+      queue_times_us_.push_back(queue_time.value_or(-1));
+      cv_.SignalAll();
+    };
+  }
+
+  std::vector<absl::Status> WaitForSteps(size_t n) {
+    MutexLock lock(&mu_);
+    while (statuses_.size() < n) cv_.Wait(&mu_);
+    return statuses_;
+  }
+
+  // Queue times in microseconds, -1 for rejected steps.
+  std::vector<int64_t> queue_times_us() {
+    MutexLock lock(&mu_);
+    return queue_times_us_;
+  }
+
+  int max_running() const { return max_running_.load(); }
+
+ private:
+  std::atomic<int> running_{0};
+  std::atomic<int> max_running_{0};
+  Mutex mu_;
+  CondVar cv_;
+  std::vector<absl::Status> statuses_ ABSL_GUARDED_BY(mu_);
+  std::vector<int64_t> queue_times_us_ ABSL_GUARDED_BY(mu_);
+};
+
+TEST(HandshakeOffloadPoolTest, DisabledByDefault) {
+  EXPECT_EQ(HandshakeOffloadPool::Get(ChannelArgs()), nullptr);
+  EXPECT_EQ(HandshakeOffloadPool::Get(ChannelArgs().Set(
+                GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_CONCURRENT, 0)),
+            nullptr);
+}
+
+TEST(HandshakeOffloadPoolTest, SharedBetweenIdenticalSettings) {
+  auto args = ChannelArgs().Set(GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_CONCURRENT, 4);
+  auto pool = HandshakeOffloadPool::Get(args);
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(HandshakeOffloadPool::Get(args), pool);
+  EXPECT_NE(HandshakeOffloadPool::Get(
+                args.Set(GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_QUEUED, 7)),
+            pool);
+}
+
+TEST(HandshakeOffloadPoolTest, LimitsConcurrency) {
+  auto pool = MakeRefCounted<HandshakeOffloadPool>(
+      HandshakeOffloadPool::Options{2, 100, Duration::Minutes(1)});
+  StepRecorder recorder;
+  Notification release;
+  for (int i = 0; i < 8; ++i) pool->Run(recorder.Step(&release));
+  absl::SleepFor(absl::Milliseconds(100));
+  release.Notify();
+  for (const absl::Status& status : recorder.WaitForSteps(8)) {
+    EXPECT_TRUE(status.ok()) << status;
+  }
+  EXPECT_LE(recorder.max_running(), 2);
+}
+
+TEST(HandshakeOffloadPoolTest, RejectsWhenQueueIsFull) {
+  auto pool = MakeRefCounted<HandshakeOffloadPool>(
+      HandshakeOffloadPool::Options{1, 1, Duration::Minutes(1)});
+  StepRecorder recorder;
+  Notification release;
+  pool->Run(recorder.Step(&release));
+  pool->Run(recorder.Step(&release));
+  pool->Run(recorder.Step(&release));
+  std::vector<absl::Status> statuses = recorder.WaitForSteps(1);
+  EXPECT_EQ(statuses[0].code(), absl::StatusCode::kResourceExhausted);
+  release.Notify();
+  statuses = recorder.WaitForSteps(3);
+  EXPECT_TRUE(statuses[1].ok()) << statuses[1];
+  EXPECT_TRUE(statuses[2].ok()) << statuses[2];
+}
+
+TEST(HandshakeOffloadPoolTest, RejectsStepsQueuedTooLong) {
+  auto pool = MakeRefCounted<HandshakeOffloadPool>(
+      HandshakeOffloadPool::Options{1, 10, Duration::Milliseconds(10)});
+  StepRecorder recorder;
+  Notification release;
+  pool->Run(recorder.Step(&release));
+  pool->Run(recorder.Step(&release));
+  absl::SleepFor(absl::Milliseconds(100));
+  release.Notify();
+  std::vector<absl::Status> statuses = recorder.WaitForSteps(2);
+  EXPECT_TRUE(statuses[0].ok()) << statuses[0];
+  EXPECT_EQ(statuses[1].code(), absl::StatusCode::kDeadlineExceeded);
+}
+
+TEST(HandshakeOffloadPoolTest, ReportsQueueTimeInMicroseconds) {
+  auto pool = MakeRefCounted<HandshakeOffloadPool>(
+      HandshakeOffloadPool::Options{1, 10, Duration::Minutes(1)});
+  StepRecorder recorder;
+  Notification release;
+  pool->Run(recorder.Step(&release));
+  pool->Run(recorder.Step());
+  absl::SleepFor(absl::Milliseconds(20));
+  release.Notify();
+  recorder.WaitForSteps(2);
+  std::vector<int64_t> queue_times_us = recorder.queue_times_us();
+  EXPECT_EQ(queue_times_us[0], 0);
+  EXPECT_GE(queue_times_us[1], 20000);
+  EXPECT_LT(queue_times_us[1], 60 * GPR_US_PER_SEC);
+}
+
+// Runs security handshakes with fake TSI handshakers over an endpoint pair,
+// with every handshake step offloaded to a pool with a single slot.
+class SecurityHandshakerOffloadTest : public ::testing::Test {
+ protected:
+  struct Handshake {
+    RefCountedPtr<HandshakeManager> manager =
+        MakeRefCounted<HandshakeManager>();
+    Notification done;
+    absl::Status status;
+  };
+
+  void SetUp() override {
+    args_ = ChannelArgs()
+                .Set(GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_CONCURRENT, 1)
+                .Set(GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_QUEUE_TIME_MS, 60000)
+                .SetObject(grpc_event_engine::experimental::
+                               GetDefaultEventEngine());
+    // The pool the handshakers get, since it is shared by settings.
+    pool_ = HandshakeOffloadPool::Get(args_);
+    channel_creds_ = grpc_fake_transport_security_credentials_create();
+    ChannelArgs channel_args = args_;
+    client_connector_ = channel_creds_->create_security_connector(
+        nullptr, "localhost", &channel_args);
+    server_creds_ = grpc_fake_transport_security_server_credentials_create();
+    server_connector_ = server_creds_->create_security_connector(args_);
+    endpoints_ = grpc_iomgr_create_endpoint_pair("offload", nullptr);
+  }
+
+  void TearDown() override {
+    ExecCtx exec_ctx;
+    client_connector_.reset();
+    server_connector_.reset();
+    grpc_channel_credentials_release(channel_creds_);
+    grpc_server_credentials_release(server_creds_);
+  }
+
+  template <typename Connector>
+  void StartHandshake(Connector* connector, grpc_endpoint* endpoint,
+                      Handshake* handshake) {
+    ExecCtx exec_ctx;
+    connector->add_handshakers(args_, nullptr, handshake->manager.get());
+    handshake->manager->DoHandshake(
+        OrphanablePtr<grpc_endpoint>(endpoint), args_,
+        Timestamp::Now() + Duration::Minutes(1), nullptr,
+        [handshake](absl::StatusOr<HandshakerArgs*> result) {
+          handshake->status = result.status();
+          handshake->done.Notify();
+        });
+  }
+
+  ChannelArgs args_;
+  RefCountedPtr<HandshakeOffloadPool> pool_;
+  grpc_channel_credentials* channel_creds_;
+  grpc_server_credentials* server_creds_;
+  RefCountedPtr<grpc_channel_security_connector> client_connector_;
+  RefCountedPtr<grpc_server_security_connector> server_connector_;
+  grpc_endpoint_pair endpoints_;
+};
+
+TEST_F(SecurityHandshakerOffloadTest, HandshakeWaitsForSlot) {
+  StepRecorder recorder;
+  Notification release;
+  pool_->Run(recorder.Step(&release));
+  Handshake client;
+  Handshake server;
+  StartHandshake(client_connector_.get(), endpoints_.client, &client);
+  StartHandshake(server_connector_.get(), endpoints_.server, &server);
+  // Neither side gets to take a step while the pool is saturated.
+  EXPECT_FALSE(client.done.WaitForNotificationWithTimeout(
+      absl::Milliseconds(200)));
+  EXPECT_FALSE(server.done.HasBeenNotified());
+  release.Notify();
+  ASSERT_TRUE(client.done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  ASSERT_TRUE(server.done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  EXPECT_TRUE(client.status.ok()) << client.status;
+  EXPECT_TRUE(server.status.ok()) << server.status;
+}
+
+TEST_F(SecurityHandshakerOffloadTest, ShutdownWhileQueuedFailsAtOnce) {
+  StepRecorder recorder;
+  Notification release;
+  pool_->Run(recorder.Step(&release));
+  Handshake client;
+  StartHandshake(client_connector_.get(), endpoints_.client, &client);
+  OrphanablePtr<grpc_endpoint> server_endpoint(endpoints_.server);
+  EXPECT_FALSE(client.done.WaitForNotificationWithTimeout(
+      absl::Milliseconds(100)));
+  {
+    ExecCtx exec_ctx;
+    client.manager->Shutdown(absl::CancelledError("test shutdown"));
+  }
+  // The handshake fails without waiting for the slot.
+  ASSERT_TRUE(client.done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  EXPECT_FALSE(client.status.ok());
+  // Once the slot frees up, the queued step finds the handshake over and
+  // gives the slot back.
+  release.Notify();
+  pool_->Run(recorder.Step());
+  for (const absl::Status& status : recorder.WaitForSteps(2)) {
+    EXPECT_TRUE(status.ok()) << status;
+  }
+  {
+    ExecCtx exec_ctx;
+    server_endpoint.reset();
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,117 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/handshaker/security/pipelining_heuristic_selector.h"
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using std::chrono::microseconds;
+using std::chrono::nanoseconds;
+
+// Feeds n reads of read_size bytes, each costing ns_per_byte to unprotect.
+void RecordReads(CostModelHeuristic& heuristic, int n, size_t read_size,
+                 int ns_per_byte) {
+  for (int i = 0; i < n; ++i) {
+    heuristic.RecordRead(read_size);
+    heuristic.RecordUnprotect(read_size, nanoseconds(read_size * ns_per_byte));
+  }
+}
+
+TEST(CostModelHeuristicTest, DisabledUntilUnprotectIsMeasured) {
+  CostModelHeuristic heuristic;
+  heuristic.RecordRead(1024 * 1024);
+  EXPECT_FALSE(heuristic.IsPipeliningEnabled());
+}
+
+TEST(CostModelHeuristicTest, EnablesWhenUnprotectOutweighsThreadHop) {
+  CostModelHeuristic heuristic;
+  heuristic.RecordThreadHop(microseconds(10));
+  // 256KiB at 1ns/byte takes ~260us to unprotect, well above the hop.
+  RecordReads(heuristic, 100, 256 * 1024, 1);
+  EXPECT_TRUE(heuristic.IsPipeliningEnabled());
+  EXPECT_NEAR(heuristic.unprotect_ns_per_byte(), 1.0, 0.01);
+}
+
+TEST(CostModelHeuristicTest, StaysDisabledForSmallReads) {
+  CostModelHeuristic heuristic;
+  // 1KiB at 1ns/byte is ~1us, far below the assumed hop latency.
+  RecordReads(heuristic, 100, 1024, 1);
+  EXPECT_FALSE(heuristic.IsPipeliningEnabled());
+}
+
+TEST(CostModelHeuristicTest, DisablesWhenThreadHopsBecomeExpensive) {
+  CostModelHeuristic heuristic;
+  RecordReads(heuristic, 100, 64 * 1024, 1);
+  ASSERT_TRUE(heuristic.IsPipeliningEnabled());
+  for (int i = 0; i < 200; ++i) {
+    heuristic.RecordThreadHop(microseconds(500));
+    RecordReads(heuristic, 1, 64 * 1024, 1);
+  }
+  EXPECT_FALSE(heuristic.IsPipeliningEnabled());
+}
+
+TEST(CostModelHeuristicTest, PeriodicallyProbesThreadHop) {
+  CostModelHeuristic heuristic;
+  int pipelined = 0;
+  for (int i = 0; i < 4096; ++i) {
+    RecordReads(heuristic, 1, 1024, 1);
+    if (heuristic.IsPipeliningEnabled()) ++pipelined;
+  }
+  EXPECT_GE(pipelined, 3);
+  EXPECT_LE(pipelined, 4);
+}
+
+TEST(PipeliningHeuristicSelectorTest, ParsesHeuristicTypeNames) {
+  using HeuristicType = PipeliningHeuristicSelector::HeuristicType;
+  for (HeuristicType type :
+       {HeuristicType::kConsecutiveSmallReads, HeuristicType::kMovingAverage,
+        HeuristicType::kAlwaysOff, HeuristicType::kAlwaysOn,
+        HeuristicType::kCostModel}) {
+    EXPECT_EQ(PipeliningHeuristicSelector::ParseHeuristicType(
+                  PipeliningHeuristicSelector::HeuristicTypeName(type)),
+              type);
+  }
+  EXPECT_EQ(PipeliningHeuristicSelector::ParseHeuristicType("bogus"),
+            std::nullopt);
+}
+
+TEST(PipeliningHeuristicSelectorTest, ExposesCostModel) {
+  PipeliningHeuristicSelector selector;
+  EXPECT_EQ(selector.cost_model(), nullptr);
+  selector.SetHeuristicType(
+      PipeliningHeuristicSelector::HeuristicType::kCostModel);
+  ASSERT_NE(selector.cost_model(), nullptr);
+  selector.RecordRead(1000);
+  selector.RecordUnprotect(1000, nanoseconds(3000));
+  EXPECT_DOUBLE_EQ(selector.cost_model()->unprotect_ns_per_byte(), 3.0);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
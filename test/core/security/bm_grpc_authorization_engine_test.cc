@@ -0,0 +1,106 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "src/core/lib/security/authorization/grpc_authorization_engine.h"
+#include "src/core/lib/security/authorization/matchers.h"
+#include "src/core/lib/security/authorization/rbac_policy.h"
+#include "src/core/util/matchers.h"
+#include "test/core/test_util/evaluate_args_test_util.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace {
+
+// One policy per method, each allowing a single exact path.  The request
+// matches the last policy.
+Rbac MakeRbac(int num_policies) {
+  std::map<std::string, Rbac::Policy> policies;
+  for (int i = 0; i < num_policies; ++i) {
+    policies[absl::StrCat("policy", 100000 + i)] = Rbac::Policy(
+        Rbac::Permission::MakePathPermission(*StringMatcher::Create(
+            StringMatcher::Type::kExact, absl::StrCat("/pkg.Service/M", i))),
+        Rbac::Principal::MakeAnyPrincipal());
+  }
+  return Rbac("authz", Rbac::Action::kAllow, std::move(policies));
+}
+
+std::string LastPath(int num_policies) {
+  return absl::StrCat("/pkg.Service/M", num_policies - 1);
+}
+
+// Evaluates the policies one after another, as the engine does without a
+// path index.
+void BM_LinearPolicyScan(benchmark::State& state) {
+  Rbac rbac = MakeRbac(state.range(0));
+  std::vector<std::unique_ptr<AuthorizationMatcher>> matchers;
+  for (const auto& [name, policy] : rbac.policies) {
+    matchers.push_back(std::make_unique<PolicyAuthorizationMatcher>(policy));
+  }
+  const std::string path = LastPath(state.range(0));
+  EvaluateArgsTestUtil util;
+  util.AddPairToMetadata(":path", path.c_str());
+  EvaluateArgs args = util.MakeEvaluateArgs();
+  for (auto _ : state) {
+    bool matches = false;
+    for (const auto& matcher : matchers) {
+      if (matcher->Matches(args)) {
+        matches = true;
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+}
+BENCHMARK(BM_LinearPolicyScan)->Range(1, 1000);
+
+void BM_AuthorizationEngineEvaluate(benchmark::State& state) {
+  GrpcAuthorizationEngine engine(MakeRbac(state.range(0)));
+  const std::string path = LastPath(state.range(0));
+  EvaluateArgsTestUtil util;
+  util.AddPairToMetadata(":path", path.c_str());
+  EvaluateArgs args = util.MakeEvaluateArgs();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(engine.Evaluate(args));
+  }
+}
+BENCHMARK(BM_AuthorizationEngineEvaluate)->Range(1, 1000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+// The main function that runs the benchmarks
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
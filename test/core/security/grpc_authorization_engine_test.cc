@@ -22,6 +22,7 @@
 
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/util/json/json.h"
+#include "src/core/util/matchers.h"
 #include "test/core/test_util/audit_logging_utils.h"
 #include "test/core/test_util/evaluate_args_test_util.h"
 #include "gmock/gmock.h"
@@ -55,6 +56,12 @@ class GrpcAuthorizationEngineTest : public ::testing::Test {
   EvaluateArgsTestUtil evaluate_args_util_;
 };
 
+Rbac::Permission MakePathPermission(StringMatcher::Type type,
+                                    absl::string_view path) {
+  return Rbac::Permission::MakePathPermission(
+      *StringMatcher::Create(type, path));
+}
+
 }  // namespace
 
 TEST_F(GrpcAuthorizationEngineTest, AllowEngineWithMatchingPolicy) {
@@ -350,6 +357,201 @@ TEST_F(GrpcAuthorizationEngineTest, MultipleAuditLoggerInvoked) {
               kPolicyName, kSpiffeId, kRpcMethod)));
 }
 
+TEST_F(GrpcAuthorizationEngineTest, PathPoliciesMatchInOrder) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] =
+      Rbac::Policy(MakePathPermission(StringMatcher::Type::kExact,
+                                      "/foo.Bar/Other"),
+                   Rbac::Principal::MakeAnyPrincipal());
+  policies["policy2"] = Rbac::Policy(
+      MakePathPermission(StringMatcher::Type::kPrefix, "/foo.Bar/"),
+      Rbac::Principal::MakeNotPrincipal(std::make_unique<Rbac::Principal>(
+          Rbac::Principal::MakeAnyPrincipal())));
+  policies["policy3"] = Rbac::Policy(Rbac::Permission::MakeAnyPermission(),
+                                     Rbac::Principal::MakeAnyPrincipal());
+  policies["policy4"] =
+      Rbac::Policy(MakePathPermission(StringMatcher::Type::kExact, kRpcMethod),
+                   Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kAllow, std::move(policies));
+  GrpcAuthorizationEngine engine(rbac);
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy3");
+}
+
+TEST_F(GrpcAuthorizationEngineTest, PathPoliciesMatchExactAndPrefix) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] =
+      Rbac::Policy(MakePathPermission(StringMatcher::Type::kPrefix, "/baz."),
+                   Rbac::Principal::MakeAnyPrincipal());
+  std::vector<std::unique_ptr<Rbac::Permission>> permissions;
+  permissions.push_back(std::make_unique<Rbac::Permission>(
+      MakePathPermission(StringMatcher::Type::kExact, "/foo.Bar/Other")));
+  permissions.push_back(std::make_unique<Rbac::Permission>(
+      MakePathPermission(StringMatcher::Type::kPrefix, "/foo.")));
+  policies["policy2"] =
+      Rbac::Policy(Rbac::Permission::MakeOrPermission(std::move(permissions)),
+                   Rbac::Principal::MakeAnyPrincipal());
+  policies["policy3"] =
+      Rbac::Policy(MakePathPermission(StringMatcher::Type::kExact, kRpcMethod),
+                   Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kDeny, std::move(policies));
+  GrpcAuthorizationEngine engine(rbac);
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kDeny);
+  EXPECT_EQ(decision.matching_policy_name, "policy2");
+}
+
+TEST_F(GrpcAuthorizationEngineTest, PathPoliciesWithNoMatchingPath) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] =
+      Rbac::Policy(MakePathPermission(StringMatcher::Type::kPrefix, "/baz."),
+                   Rbac::Principal::MakeAnyPrincipal());
+  std::vector<std::unique_ptr<Rbac::Permission>> permissions;
+  permissions.push_back(std::make_unique<Rbac::Permission>(
+      Rbac::Permission::MakeAnyPermission()));
+  permissions.push_back(std::make_unique<Rbac::Permission>(
+      MakePathPermission(StringMatcher::Type::kExact, "/foo.Bar/Other")));
+  policies["policy2"] =
+      Rbac::Policy(Rbac::Permission::MakeAndPermission(std::move(permissions)),
+                   Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kAllow, std::move(policies));
+  GrpcAuthorizationEngine engine(rbac);
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kDeny);
+  EXPECT_TRUE(decision.matching_policy_name.empty());
+}
+
+TEST_F(GrpcAuthorizationEngineTest, DestinationIpPoliciesMatchInOrder) {
+  evaluate_args_util_.SetLocalEndpoint("ipv4:10.1.2.3:443");
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakeDestIpPermission(Rbac::CidrRange("10.2.0.0", 16)),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["policy2"] = Rbac::Policy(
+      Rbac::Permission::MakeDestIpPermission(Rbac::CidrRange("10.1.2.3", 32)),
+      Rbac::Principal::MakeNotPrincipal(std::make_unique<Rbac::Principal>(
+          Rbac::Principal::MakeAnyPrincipal())));
+  policies["policy3"] = Rbac::Policy(
+      Rbac::Permission::MakeDestIpPermission(Rbac::CidrRange("10.1.0.0", 16)),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["policy4"] = Rbac::Policy(
+      Rbac::Permission::MakeDestIpPermission(Rbac::CidrRange("10.0.0.0", 8)),
+      Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kAllow, std::move(policies));
+  GrpcAuthorizationEngine engine(rbac);
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy3");
+}
+
+TEST_F(GrpcAuthorizationEngineTest, HeaderPoliciesMatchExactValues) {
+  evaluate_args_util_.AddPairToMetadata("key", "value2");
+  auto make_header_permission = [](absl::string_view value,
+                                   bool invert = false) {
+    return Rbac::Permission::MakeHeaderPermission(
+        *HeaderMatcher::Create("key", HeaderMatcher::Type::kExact, value,
+                               /*range_start=*/0, /*range_end=*/0,
+                               /*present_match=*/false, invert));
+  };
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(make_header_permission("value1"),
+                                     Rbac::Principal::MakeAnyPrincipal());
+  // Inverted matches are not indexed, but must still be evaluated.
+  policies["policy2"] =
+      Rbac::Policy(make_header_permission("value2", /*invert=*/true),
+                   Rbac::Principal::MakeAnyPrincipal());
+  policies["policy3"] = Rbac::Policy(make_header_permission("value2"),
+                                     Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kDeny, std::move(policies));
+  GrpcAuthorizationEngine engine(rbac);
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kDeny);
+  EXPECT_EQ(decision.matching_policy_name, "policy3");
+}
+
+TEST_F(GrpcAuthorizationEngineTest, ConnectionScopedPrincipalsAreMemoized) {
+  auto make_rbac = []() {
+    std::map<std::string, Rbac::Policy> policies;
+    policies["policy"] = Rbac::Policy(
+        Rbac::Permission::MakeAnyPermission(),
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            *StringMatcher::Create(StringMatcher::Type::kExact, kSpiffeId)));
+    return Rbac("authz", Rbac::Action::kAllow, std::move(policies));
+  };
+  EvaluateArgs::PerChannelArgs channel_args(nullptr, ChannelArgs());
+  channel_args.transport_security_type = GRPC_TLS_TRANSPORT_SECURITY_TYPE;
+  channel_args.uri_sans = {kSpiffeId};
+  EvaluateArgs args(nullptr, &channel_args);
+  GrpcAuthorizationEngine engine(make_rbac());
+  EXPECT_EQ(engine.Evaluate(args).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  // The connection cannot change, so the engine keeps using the result it
+  // saw first.
+  channel_args.uri_sans.clear();
+  EXPECT_EQ(engine.Evaluate(args).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  // A new engine, as created on a policy update, does not.
+  GrpcAuthorizationEngine new_engine(make_rbac());
+  EXPECT_EQ(new_engine.Evaluate(args).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+}
+
+TEST_F(GrpcAuthorizationEngineTest, OneEngineIsEvictedPerNewEngine) {
+  EvaluateArgs::PerChannelArgs channel_args(nullptr, ChannelArgs());
+  channel_args.transport_security_type = GRPC_TLS_TRANSPORT_SECURITY_TYPE;
+  channel_args.uri_sans = {kSpiffeId};
+  EvaluateArgs args(nullptr, &channel_args);
+  // One more engine than the connection memoizes the results of.
+  std::vector<GrpcAuthorizationEngine> engines;
+  for (int i = 0; i < 17; ++i) {
+    std::map<std::string, Rbac::Policy> policies;
+    policies["policy"] = Rbac::Policy(
+        Rbac::Permission::MakeAnyPermission(),
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            *StringMatcher::Create(StringMatcher::Type::kExact, kSpiffeId)));
+    engines.emplace_back(
+        Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+    EXPECT_EQ(engines.back().Evaluate(args).type,
+              AuthorizationEngine::Decision::Type::kAllow);
+  }
+  channel_args.uri_sans.clear();
+  // Only the oldest engine made room for the last one.  Its new result
+  // evicts the next oldest engine in turn.
+  EXPECT_EQ(engines.front().Evaluate(args).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+  for (size_t i = 2; i < engines.size(); ++i) {
+    EXPECT_EQ(engines[i].Evaluate(args).type,
+              AuthorizationEngine::Decision::Type::kAllow);
+  }
+}
+
+TEST_F(GrpcAuthorizationEngineTest, CallScopedPrincipalsAreNotMemoized) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy"] = Rbac::Policy(
+      Rbac::Permission::MakeAnyPermission(),
+      Rbac::Principal::MakePathPrincipal(
+          *StringMatcher::Create(StringMatcher::Type::kExact, kRpcMethod)));
+  Rbac rbac("authz", Rbac::Action::kAllow, std::move(policies));
+  GrpcAuthorizationEngine engine(rbac);
+  EvaluateArgs::PerChannelArgs channel_args(nullptr, ChannelArgs());
+  grpc_metadata_batch metadata;
+  metadata.Set(HttpPathMetadata(), Slice::FromStaticString(kRpcMethod));
+  EXPECT_EQ(engine.Evaluate(EvaluateArgs(&metadata, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kAllow);
+  grpc_metadata_batch other_metadata;
+  other_metadata.Set(HttpPathMetadata(),
+                     Slice::FromStaticString("/foo.Bar/Other"));
+  EXPECT_EQ(
+      engine.Evaluate(EvaluateArgs(&other_metadata, &channel_args)).type,
+            AuthorizationEngine::Decision::Type::kDeny);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
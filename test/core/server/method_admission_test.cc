@@ -0,0 +1,109 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/server/method_admission.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+TEST(MethodAdmissionConfigTest, LookupPrefersMostSpecificEntry) {
+  auto config = MethodAdmissionConfig::Parse(
+      R"json({"methodConfig": [
+        {"maxConcurrentCalls": 100},
+        {"name": [{"service": "pkg.Svc"}], "priority": "SHEDDABLE"},
+        {"name": [{"service": "pkg.Svc", "method": "Health"}],
+         "priority": "CRITICAL", "maxConcurrentCalls": 3}
+      ]})json");
+  ASSERT_TRUE(config.ok()) << config.status();
+  const auto* entry = config->Lookup("/pkg.Svc/Health");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->priority, MethodPriority::kCritical);
+  EXPECT_EQ(entry->max_concurrent_calls, 3);
+  entry = config->Lookup("/pkg.Svc/Batch");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->priority, MethodPriority::kSheddable);
+  EXPECT_EQ(entry->max_concurrent_calls, 0);
+  entry = config->Lookup("/other.Svc/Method");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->priority, MethodPriority::kDefault);
+  EXPECT_EQ(entry->max_concurrent_calls, 100);
+}
+
+TEST(MethodAdmissionConfigTest, NoMatchingEntry) {
+  auto config = MethodAdmissionConfig::Parse(
+      R"json({"methodConfig": [{"name": [{"service": "pkg.Svc"}]}]})json");
+  ASSERT_TRUE(config.ok()) << config.status();
+  EXPECT_EQ(config->Lookup("/other.Svc/Method"), nullptr);
+}
+
+TEST(MethodAdmissionConfigTest, InvalidPriority) {
+  auto config = MethodAdmissionConfig::Parse(
+      R"json({"methodConfig": [{"priority": "URGENT"}]})json");
+  EXPECT_EQ(config.status().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST(MethodAdmissionConfigTest, DuplicateMethod) {
+  auto config = MethodAdmissionConfig::Parse(
+      R"json({"methodConfig": [
+        {"name": [{"service": "pkg.Svc", "method": "M"}]},
+        {"name": [{"service": "pkg.Svc", "method": "M"}]}
+      ]})json");
+  EXPECT_EQ(config.status().code(), absl::StatusCode::kInvalidArgument);
+}
+
+TEST(MethodAdmissionTest, EnforcesConcurrencyLimit) {
+  MethodAdmissionConfig::Entry entry;
+  entry.max_concurrent_calls = 2;
+  auto admission =
+      MakeRefCounted<MethodAdmission>("/pkg.Svc/M", entry, ChannelArgs());
+  EXPECT_TRUE(admission->TryAdmit());
+  EXPECT_TRUE(admission->TryAdmit());
+  EXPECT_FALSE(admission->TryAdmit());
+  admission->Release();
+  EXPECT_TRUE(admission->TryAdmit());
+  admission->Release();
+  admission->Release();
+}
+
+TEST(MethodAdmissionTest, ZeroMeansUnlimited) {
+  auto admission = MakeRefCounted<MethodAdmission>(
+      "/pkg.Svc/M", MethodAdmissionConfig::Entry(), ChannelArgs());
+  for (int i = 0; i < 1000; ++i) EXPECT_TRUE(admission->TryAdmit());
+  for (int i = 0; i < 1000; ++i) admission->Release();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,105 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/service_config/service_config.h"
+#include "src/core/service_config/service_config_impl.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kNumServices = 100;
+
+// A config with a wildcard entry for each service, plus an entry for one
+// method of each.
+RefCountedPtr<ServiceConfig> MakeServiceConfig() {
+  std::vector<std::string> method_configs;
+  for (int i = 0; i < kNumServices; ++i) {
+    method_configs.push_back(absl::StrCat(
+        "{\"name\": [{\"service\": \"pkg.Service", i,
+        "\"}], \"timeout\": \"1s\"}"));
+    method_configs.push_back(absl::StrCat(
+        "{\"name\": [{\"service\": \"pkg.Service", i,
+        "\", \"method\": \"Exact\"}], \"waitForReady\": true}"));
+  }
+  auto service_config = ServiceConfigImpl::Create(
+      ChannelArgs(), absl::StrCat("{\"methodConfig\": [",
+                                  absl::StrJoin(method_configs, ","), "]}"));
+  GRPC_CHECK_OK(service_config);
+  return std::move(*service_config);
+}
+
+// Argument: whether the method matches a wildcard rather than an exact
+// entry.
+absl::string_view MethodName(benchmark::State& state) {
+  return state.range(0) ? "Wildcard" : "Exact";
+}
+
+void BM_UnregisteredMethodConfigLookup(benchmark::State& state) {
+  auto service_config = MakeServiceConfig();
+  // Unregistered calls get their own copy of the path.
+  const std::string path =
+      absl::StrCat("/pkg.Service", kNumServices / 2, "/", MethodName(state));
+  for (auto _ : state) {
+    Slice call_path = Slice::FromCopiedString(path);
+    benchmark::DoNotOptimize(
+        service_config->GetMethodParsedConfigVector(call_path.c_slice()));
+  }
+}
+BENCHMARK(BM_UnregisteredMethodConfigLookup)->Arg(0)->Arg(1);
+
+void BM_RegisteredMethodConfigLookup(benchmark::State& state) {
+  auto service_config = MakeServiceConfig();
+  // Registered once, as by grpc_channel_register_call().
+  const Slice registered_path = Slice::FromCopiedString(
+      absl::StrCat("/pkg.Service", kNumServices / 2, "/", MethodName(state)));
+  RegisteredMethodConfigCache config_cache;
+  for (auto _ : state) {
+    Slice call_path = registered_path.Ref();
+    benchmark::DoNotOptimize(config_cache.Get(*service_config, call_path));
+  }
+}
+BENCHMARK(BM_RegisteredMethodConfigLookup)->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+// The main function that runs the benchmarks
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
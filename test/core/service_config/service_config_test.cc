@@ -22,9 +22,12 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/service_config/service_config_impl.h"
 #include "src/core/service_config/service_config_parser.h"
 #include "src/core/util/json/json.h"
@@ -74,6 +77,9 @@ class TestParser1 : public ServiceConfigParser::Parser {
     return LoadFromJson<std::unique_ptr<TestParsedConfig1>>(json, JsonArgs(),
                                                             errors);
   }
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_DISABLE_PARSING};
+  }
 };
 
 class TestParsedConfig2 : public ServiceConfigParser::ParsedConfig {
@@ -105,6 +111,9 @@ class TestParser2 : public ServiceConfigParser::Parser {
     return LoadFromJson<std::unique_ptr<TestParsedConfig2>>(json, JsonArgs(),
                                                             errors);
   }
+  std::vector<absl::string_view> ChannelArgKeys() const override {
+    return {GRPC_ARG_DISABLE_PARSING};
+  }
 };
 
 class ServiceConfigTest : public ::testing::Test {
@@ -366,6 +375,147 @@ TEST_F(ServiceConfigTest, Parser2ErrorInvalidValue) {
       << service_config.status();
 }
 
+TEST_F(ServiceConfigTest, RegisteredMethodLookup) {
+  const char* test_json =
+      "{\"methodConfig\": ["
+      "  {\"name\":[{\"service\":\"TestServ\"}], \"method_param\":1},"
+      "  {\"name\":[{\"service\":\"TestServ\", \"method\":\"Exact\"}],"
+      "   \"method_param\":2},"
+      "  {\"name\":[{}], \"method_param\":3}"
+      "]}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  struct {
+    Slice path;
+    int expected_value;
+    RegisteredMethodConfigCache config_cache;
+  } cases[] = {
+      {Slice::FromCopiedString("/TestServ/Exact"), 2},
+      {Slice::FromCopiedString("/TestServ/Other"), 1},
+      {Slice::FromCopiedString("/OtherServ/Method"), 3},
+  };
+  // The second round is served from the caches.
+  for (int round = 0; round < 2; ++round) {
+    for (auto& test_case : cases) {
+      const auto* vector_ptr =
+          test_case.config_cache.Get(**service_config, test_case.path);
+      EXPECT_EQ(vector_ptr,
+                (*service_config)
+                    ->GetMethodParsedConfigVector(test_case.path.c_slice()));
+      ASSERT_NE(vector_ptr, nullptr) << test_case.path.as_string_view();
+      EXPECT_EQ(static_cast<TestParsedConfig1*>((*vector_ptr)[1].get())
+                    ->value(),
+                test_case.expected_value)
+          << test_case.path.as_string_view();
+    }
+  }
+}
+
+TEST_F(ServiceConfigTest, RegisteredMethodLookupFollowsServiceConfig) {
+  auto service_config1 = ServiceConfigImpl::Create(
+      ChannelArgs(),
+      "{\"methodConfig\": ["
+      "  {\"name\":[{\"service\":\"TestServ\"}], \"method_param\":1}"
+      "]}");
+  ASSERT_TRUE(service_config1.ok()) << service_config1.status();
+  auto service_config2 = ServiceConfigImpl::Create(
+      ChannelArgs(),
+      "{\"methodConfig\": ["
+      "  {\"name\":[{\"service\":\"TestServ\"}], \"method_param\":2}"
+      "]}");
+  ASSERT_TRUE(service_config2.ok()) << service_config2.status();
+  EXPECT_NE((*service_config1)->generation(),
+            (*service_config2)->generation());
+  const Slice path = Slice::FromCopiedString("/TestServ/Method");
+  RegisteredMethodConfigCache config_cache;
+  // Switching between configs, as a channel does when its resolver
+  // returns a new one, never returns the other config's result.
+  for (int round = 0; round < 2; ++round) {
+    for (const auto* service_config : {&service_config1, &service_config2}) {
+      const auto* vector_ptr = config_cache.Get(***service_config, path);
+      ASSERT_NE(vector_ptr, nullptr);
+      EXPECT_EQ(vector_ptr, (**service_config)
+                                ->GetMethodParsedConfigVector(path.c_slice()));
+    }
+  }
+}
+
+TEST_F(ServiceConfigTest, RegisteredMethodLookupFromManyThreads) {
+  auto service_config1 = ServiceConfigImpl::Create(
+      ChannelArgs(),
+      "{\"methodConfig\": ["
+      "  {\"name\":[{\"service\":\"TestServ\"}], \"method_param\":1}"
+      "]}");
+  ASSERT_TRUE(service_config1.ok()) << service_config1.status();
+  auto service_config2 = ServiceConfigImpl::Create(
+      ChannelArgs(),
+      "{\"methodConfig\": ["
+      "  {\"name\":[{\"service\":\"TestServ\"}], \"method_param\":2}"
+      "]}");
+  ASSERT_TRUE(service_config2.ok()) << service_config2.status();
+  const Slice path = Slice::FromCopiedString("/TestServ/Method");
+  RegisteredMethodConfigCache config_cache;
+  // Threads using different configs keep replacing each other's entry.
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    const ServiceConfig& service_config =
+        i % 2 == 0 ? **service_config1 : **service_config2;
+    const int expected_value = i % 2 == 0 ? 1 : 2;
+    threads.emplace_back([&, expected_value]() {
+      for (int j = 0; j < 10000; ++j) {
+        const auto* vector_ptr = config_cache.Get(service_config, path);
+        ASSERT_NE(vector_ptr, nullptr);
+        EXPECT_EQ(static_cast<TestParsedConfig1*>((*vector_ptr)[1].get())
+                      ->value(),
+                  expected_value);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+TEST_F(ServiceConfigTest, SharesIdenticalConfigs) {
+  EXPECT_THAT(
+      CoreConfiguration::Get().service_config_parser().channel_arg_keys(),
+      ::testing::ElementsAre(GRPC_ARG_DISABLE_PARSING));
+  const char* test_json = "{\"global_param\":5}";
+  auto service_config1 = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config1.ok()) << service_config1.status();
+  // Args that no parser depends on do not matter.
+  auto service_config2 = ServiceConfigImpl::Create(
+      ChannelArgs().Set("grpc.unrelated_arg", 1), test_json);
+  ASSERT_TRUE(service_config2.ok()) << service_config2.status();
+  EXPECT_EQ(service_config1->get(), service_config2->get());
+  // Args that a parser depends on do.
+  auto service_config3 = ServiceConfigImpl::Create(
+      ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1), test_json);
+  ASSERT_TRUE(service_config3.ok()) << service_config3.status();
+  EXPECT_NE(service_config1->get(), service_config3->get());
+  EXPECT_EQ((*service_config3)->GetGlobalParsedConfig(0), nullptr);
+  // As does the JSON.
+  auto service_config4 =
+      ServiceConfigImpl::Create(ChannelArgs(), "{\"global_param\":6}");
+  ASSERT_TRUE(service_config4.ok()) << service_config4.status();
+  EXPECT_NE(service_config1->get(), service_config4->get());
+  EXPECT_EQ(static_cast<TestParsedConfig1*>(
+                (*service_config4)->GetGlobalParsedConfig(0))
+                ->value(),
+            6);
+}
+
+TEST_F(ServiceConfigTest, ParsesAgainOnceUnused) {
+  const char* test_json = "{\"global_param\":5}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  service_config->reset();
+  service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  EXPECT_EQ(static_cast<TestParsedConfig1*>(
+                (*service_config)->GetGlobalParsedConfig(0))
+                ->value(),
+            5);
+}
+
 TEST(ServiceConfigParserDeathTest, DoubleRegistration) {
   GTEST_FLAG_SET(death_test_style, "threadsafe");
   CoreConfiguration::Reset();
@@ -24,6 +24,9 @@
 #include <stdlib.h>
 
 #include <memory>
+#include <set>
+#include <thread>
+#include <vector>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/surface/completion_queue.h"
@@ -295,6 +298,107 @@ static void test_threading(size_t producers, size_t consumers) {
   gpr_free(options);
 }
 
+// Tags each event with the producer that completed it and its index, so
+// that consumers can tell every event apart.
+static void* event_tag(size_t producer, size_t event) {
+  return reinterpret_cast<void*>((producer << 20 | event) + 1);
+}
+
+// Completes `events` operations on `cq`, tagged for `producer`.
+static void produce_events(grpc_completion_queue* cq, size_t producer,
+                           size_t events) {
+  for (size_t i = 0; i < events; i++) {
+    grpc_core::ExecCtx exec_ctx;
+    grpc_cq_end_op(cq, event_tag(producer, i), absl::OkStatus(),
+                   free_completion, nullptr,
+                   static_cast<grpc_cq_completion*>(
+                       gpr_malloc(sizeof(grpc_cq_completion))));
+  }
+}
+
+// Polls `cq` until it is shut down, recording the tags of the events seen.
+static void consume_events(grpc_completion_queue* cq,
+                           std::vector<void*>* tags) {
+  for (;;) {
+    grpc_event ev = grpc_completion_queue_next(
+        cq, gpr_inf_future(GPR_CLOCK_MONOTONIC), nullptr);
+    if (ev.type == GRPC_QUEUE_SHUTDOWN) return;
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+    ASSERT_TRUE(ev.success);
+    tags->push_back(ev.tag);
+  }
+}
+
+// Checks that `tags` holds every event of `producers` producers exactly
+// once.
+static void expect_each_event_once(const std::vector<std::vector<void*>>& tags,
+                                   size_t producers, size_t events) {
+  std::set<void*> seen;
+  for (const std::vector<void*>& consumer_tags : tags) {
+    for (void* tag : consumer_tags) {
+      EXPECT_TRUE(seen.insert(tag).second) << "duplicate event " << tag;
+    }
+  }
+  EXPECT_EQ(seen.size(), producers * events);
+  for (size_t producer = 0; producer < producers; producer++) {
+    for (size_t i = 0; i < events; i++) {
+      EXPECT_EQ(seen.count(event_tag(producer, i)), 1u)
+          << "lost event " << i << " of producer " << producer;
+    }
+  }
+}
+
+// Events are queued in per-thread shards, and pollers steal from shards
+// other than their own, so many pollers racing many producers must still
+// see every event exactly once.
+TEST(CompletionQueueThreadingTest, ManyProducersManyPollers) {
+  constexpr size_t kProducers = 16;
+  constexpr size_t kConsumers = 16;
+  constexpr size_t kEvents = 2000;
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  for (size_t i = 0; i < kProducers * kEvents; i++) {
+    ASSERT_TRUE(grpc_cq_begin_op(cq, nullptr));
+  }
+  std::vector<std::vector<void*>> tags(kConsumers);
+  std::vector<std::thread> consumers;
+  for (size_t i = 0; i < kConsumers; i++) {
+    consumers.emplace_back(consume_events, cq, &tags[i]);
+  }
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < kProducers; i++) {
+    producers.emplace_back(produce_events, cq, i, kEvents);
+  }
+  // Shut down while events are still being completed: pollers must drain
+  // them all before seeing the shutdown.
+  grpc_completion_queue_shutdown(cq);
+  for (std::thread& producer : producers) producer.join();
+  for (std::thread& consumer : consumers) consumer.join();
+  grpc_completion_queue_destroy(cq);
+  expect_each_event_once(tags, kProducers, kEvents);
+}
+
+// Events completed by threads that have exited sit in those threads' home
+// shards.  A single poller must steal all of them before shutdown completes.
+TEST(CompletionQueueThreadingTest, ShutdownDrainsEventsInOtherShards) {
+  constexpr size_t kProducers = 16;
+  constexpr size_t kEvents = 100;
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  for (size_t i = 0; i < kProducers * kEvents; i++) {
+    ASSERT_TRUE(grpc_cq_begin_op(cq, nullptr));
+  }
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < kProducers; i++) {
+    producers.emplace_back(produce_events, cq, i, kEvents);
+  }
+  for (std::thread& producer : producers) producer.join();
+  grpc_completion_queue_shutdown(cq);
+  std::vector<std::vector<void*>> tags(1);
+  std::thread consumer(consume_events, cq, &tags[0]);
+  consumer.join();
+  grpc_completion_queue_destroy(cq);
+  expect_each_event_once(tags, kProducers, kEvents);
+}
+
 TEST(CompletionQueueThreadingTest, MainTest) {
   grpc_init();
   test_too_many_plucks();
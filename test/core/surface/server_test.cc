@@ -26,17 +26,21 @@
 #include <stddef.h>
 
 #include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "src/core/credentials/transport/fake/fake_credentials.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/shim.h"
 #include "src/core/lib/event_engine/utils.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/telemetry/metrics.h"
 #include "src/core/util/host_port.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/port.h"
 #include "test/core/test_util/test_config.h"
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "absl/log/log.h"
 #include "absl/strings/str_cat.h"
@@ -277,6 +281,215 @@ TEST(ServerTest, RejectBacklogMatchOrQueue) {
   grpc_shutdown();
 }
 
+namespace {
+
+// Waits for `tag` to complete on `cq`.  Completions for other tags that
+// arrive first are remembered in `seen`, so they can be waited for later.
+void WaitForTag(grpc_completion_queue* cq, intptr_t tag,
+                std::set<intptr_t>* seen) {
+  while (seen->erase(tag) == 0) {
+    grpc_event ev = grpc_completion_queue_next(
+        cq, grpc_timeout_seconds_to_deadline(10), nullptr);
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+    ASSERT_TRUE(ev.success);
+    seen->insert(reinterpret_cast<intptr_t>(ev.tag));
+  }
+}
+
+// A client call that sends initial metadata and waits for its status.
+struct PendingTestCall {
+  PendingTestCall(grpc_channel* client, grpc_completion_queue* cq,
+                  const char* method, intptr_t tag)
+      : tag(tag) {
+    grpc_slice host = grpc_slice_from_static_string("localhost");
+    call = grpc_channel_create_call(
+        client, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+        grpc_slice_from_static_string(method), &host,
+        grpc_timeout_seconds_to_deadline(10), nullptr);
+    grpc_metadata_array_init(&trailing_metadata);
+    grpc_op ops[2];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[1].data.recv_status_on_client.trailing_metadata = &trailing_metadata;
+    ops[1].data.recv_status_on_client.status = &status;
+    ops[1].data.recv_status_on_client.status_details = &details;
+    EXPECT_EQ(GRPC_CALL_OK,
+              grpc_call_start_batch(call, ops, 2,
+                                    reinterpret_cast<void*>(tag), nullptr));
+  }
+  ~PendingTestCall() {
+    grpc_call_unref(call);
+    grpc_metadata_array_destroy(&trailing_metadata);
+    grpc_slice_unref(details);
+  }
+
+  const intptr_t tag;
+  grpc_call* call;
+  grpc_metadata_array trailing_metadata;
+  grpc_status_code status = GRPC_STATUS_OK;
+  grpc_slice details = grpc_empty_slice();
+};
+
+// Requests a call on the server and returns the method it was matched with.
+std::string RequestCall(grpc_server* server, grpc_completion_queue* cq,
+                        intptr_t tag, std::set<intptr_t>* seen,
+                        std::vector<grpc_call*>* server_calls) {
+  grpc_call* call = nullptr;
+  grpc_call_details call_details;
+  grpc_call_details_init(&call_details);
+  grpc_metadata_array request_metadata;
+  grpc_metadata_array_init(&request_metadata);
+  EXPECT_EQ(GRPC_CALL_OK,
+            grpc_server_request_call(server, &call, &call_details,
+                                     &request_metadata, cq, cq,
+                                     reinterpret_cast<void*>(tag)));
+  WaitForTag(cq, tag, seen);
+  std::string method(grpc_core::StringViewFromSlice(call_details.method));
+  server_calls->push_back(call);
+  grpc_call_details_destroy(&call_details);
+  grpc_metadata_array_destroy(&request_metadata);
+  return method;
+}
+
+}  // namespace
+
+TEST(ServerTest, PendingQueueCodelShedsAndServesNewestFirst) {
+  grpc_init();
+  // Overloaded once the requests dequeued over a 100ms interval have all
+  // waited more than 200ms; requests queued for over 400ms are then shed.
+  grpc_arg args_list[3];
+  args_list[0] = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_TARGET_MS), 200);
+  args_list[1] = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_SERVER_PENDING_QUEUE_CODEL_INTERVAL_MS), 100);
+  args_list[2] = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_SERVER_PENDING_QUEUE_ADAPTIVE_LIFO), 1);
+  grpc_channel_args channel_args = {3, args_list};
+
+  grpc_server* server = grpc_server_create(&channel_args, nullptr);
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server_register_completion_queue(server, cq, nullptr);
+  int port = grpc_pick_unused_port_or_die();
+  std::string addr = grpc_core::JoinHostPort("localhost", port);
+  grpc_server_credentials* insecure_creds =
+      grpc_insecure_server_credentials_create();
+  ASSERT_TRUE(grpc_server_add_http2_port(server, addr.c_str(), insecure_creds));
+  grpc_server_credentials_release(insecure_creds);
+  grpc_server_start(server);
+  grpc_channel_credentials* client_creds = grpc_insecure_credentials_create();
+  grpc_channel* client =
+      grpc_channel_create(addr.c_str(), client_creds, nullptr);
+  grpc_channel_credentials_release(client_creds);
+
+  std::set<intptr_t> seen;
+  std::vector<grpc_call*> server_calls;
+  {
+    // With no requested calls, the first three calls wait in the pending
+    // queue for longer than the target.
+    PendingTestCall x1(client, cq, "/X1", 101);
+    PendingTestCall x2(client, cq, "/X2", 102);
+    PendingTestCall x3(client, cq, "/X3", 103);
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(500));
+    // Not yet overloaded: calls are served oldest first.  The second
+    // dequeue ends an interval whose minimum sojourn was above the target.
+    EXPECT_EQ(RequestCall(server, cq, 201, &seen, &server_calls), "/X1");
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(200));
+    EXPECT_EQ(RequestCall(server, cq, 202, &seen, &server_calls), "/X2");
+    // Now overloaded.  The next arrival sheds X3, which has been queued for
+    // longer than the shed threshold, and the client is told why.
+    PendingTestCall y1(client, cq, "/Y1", 104);
+    PendingTestCall y2(client, cq, "/Y2", 105);
+    PendingTestCall y3(client, cq, "/Y3", 106);
+    WaitForTag(cq, x3.tag, &seen);
+    EXPECT_EQ(x3.status, GRPC_STATUS_RESOURCE_EXHAUSTED);
+    EXPECT_THAT(std::string(grpc_core::StringViewFromSlice(x3.details)),
+                ::testing::HasSubstr("request shed from pending queue"));
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(100));
+    // Adaptive LIFO serves the newest queued call first.
+    EXPECT_EQ(RequestCall(server, cq, 203, &seen, &server_calls), "/Y3");
+    for (PendingTestCall* c : {&x1, &x2, &y1, &y2, &y3}) {
+      grpc_call_cancel(c->call, nullptr);
+      WaitForTag(cq, c->tag, &seen);
+    }
+  }
+  for (grpc_call* call : server_calls) grpc_call_unref(call);
+
+  grpc_server_shutdown_and_notify(server, cq, reinterpret_cast<void*>(1000));
+  grpc_server_cancel_all_calls(server);
+  WaitForTag(cq, 1000, &seen);
+  grpc_server_destroy(server);
+  grpc_channel_destroy(client);
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(cq);
+  grpc_shutdown();
+}
+
+TEST(ServerTest, MethodAdmissionRejectsWithResourceExhausted) {
+  grpc_init();
+  grpc_arg arg = grpc_channel_arg_string_create(
+      const_cast<char*>(GRPC_ARG_SERVER_METHOD_ADMISSION_CONFIG),
+      const_cast<char*>(
+          "{\"methodConfig\": [{"
+          "\"name\": [{\"service\": \"svc\", \"method\": \"Method\"}],"
+          "\"maxConcurrentCalls\": 1}]}"));
+  grpc_channel_args channel_args = {1, &arg};
+
+  grpc_server* server = grpc_server_create(&channel_args, nullptr);
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server_register_completion_queue(server, cq, nullptr);
+  ASSERT_NE(grpc_server_register_method(server, "/svc/Method", nullptr,
+                                        GRPC_SRM_PAYLOAD_NONE, 0),
+            nullptr);
+  int port = grpc_pick_unused_port_or_die();
+  std::string addr = grpc_core::JoinHostPort("localhost", port);
+  grpc_server_credentials* insecure_creds =
+      grpc_insecure_server_credentials_create();
+  ASSERT_TRUE(grpc_server_add_http2_port(server, addr.c_str(), insecure_creds));
+  grpc_server_credentials_release(insecure_creds);
+  grpc_server_start(server);
+  grpc_channel_credentials* client_creds = grpc_insecure_credentials_create();
+  grpc_channel* client =
+      grpc_channel_create(addr.c_str(), client_creds, nullptr);
+  grpc_channel_credentials_release(client_creds);
+
+  std::set<intptr_t> seen;
+  {
+    // Neither call is requested by the server, so the one admitted holds
+    // the method's only slot while it waits in the pending queue, and the
+    // other is rejected.
+    PendingTestCall c1(client, cq, "/svc/Method", 101);
+    PendingTestCall c2(client, cq, "/svc/Method", 102);
+    grpc_event ev = grpc_completion_queue_next(
+        cq, grpc_timeout_seconds_to_deadline(10), nullptr);
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+    PendingTestCall* rejected =
+        reinterpret_cast<intptr_t>(ev.tag) == c1.tag ? &c1 : &c2;
+    PendingTestCall* admitted = rejected == &c1 ? &c2 : &c1;
+    ASSERT_EQ(reinterpret_cast<intptr_t>(ev.tag), rejected->tag);
+    EXPECT_EQ(rejected->status, GRPC_STATUS_RESOURCE_EXHAUSTED);
+    grpc_call_cancel(admitted->call, nullptr);
+    WaitForTag(cq, admitted->tag, &seen);
+  }
+
+  grpc_server_shutdown_and_notify(server, cq, reinterpret_cast<void*>(1000));
+  grpc_server_cancel_all_calls(server);
+  WaitForTag(cq, 1000, &seen);
+  grpc_server_destroy(server);
+  grpc_channel_destroy(client);
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(cq);
+  grpc_shutdown();
+}
+
 TEST(ServerTest, MainTest) {
   grpc_init();
   test_register_method_fail();
@@ -19,6 +19,7 @@
 #include <grpc/support/alloc.h>
 
 #include <memory>
+#include <vector>
 
 #include "src/core/tsi/alts/crypt/gsec.h"
 #include "test/core/test_util/test_config.h"
@@ -428,6 +429,93 @@ static void gsec_test_multiple_encrypt_decrypt(gsec_aead_crypter* crypter) {
   gpr_free(message_lengths);
 }
 
+static void gsec_test_batch_encrypt_decrypt(gsec_aead_crypter* crypter) {
+  ASSERT_NE(crypter, nullptr);
+  size_t nonce_length, tag_length;
+  gsec_aead_crypter_nonce_length(crypter, &nonce_length,
+                                 /*error_details=*/nullptr);
+  gsec_aead_crypter_tag_length(crypter, &tag_length, /*error_details=*/nullptr);
+  const size_t count = kTestNumEncryptions;
+  std::vector<std::vector<uint8_t>> nonces(count), messages(count),
+      ciphertexts(count), plaintexts(count);
+  std::vector<struct iovec> message_vecs(count), ciphertext_vecs(count);
+  std::vector<gsec_aead_frame> frames(count);
+  for (size_t ind = 0; ind < count; ind++) {
+    nonces[ind].resize(nonce_length);
+    gsec_test_random_bytes(nonces[ind].data(), nonce_length);
+    messages[ind].resize(gsec_test_bias_random_uint32(kTestMaxLength) + 1);
+    gsec_test_random_bytes(messages[ind].data(), messages[ind].size());
+    ciphertexts[ind].resize(messages[ind].size() + tag_length);
+    plaintexts[ind].resize(messages[ind].size());
+    message_vecs[ind] = {messages[ind].data(), messages[ind].size()};
+    frames[ind] = {nonces[ind].data(),
+                   &message_vecs[ind],
+                   1,
+                   {ciphertexts[ind].data(), ciphertexts[ind].size()},
+                   0};
+  }
+  // Every frame of the batch must match its own single-frame encryption.
+  char* error_details = nullptr;
+  gsec_assert_ok(
+      gsec_aead_crypter_encrypt_batch(crypter, nonce_length, frames.data(),
+                                      count, &error_details),
+      error_details);
+  for (size_t ind = 0; ind < count; ind++) {
+    ASSERT_EQ(frames[ind].bytes_written, ciphertexts[ind].size());
+    std::vector<uint8_t> ciphertext(ciphertexts[ind].size());
+    size_t ciphertext_bytes_written = 0;
+    gsec_assert_ok(
+        gsec_aead_crypter_encrypt(
+            crypter, nonces[ind].data(), nonce_length, /*aad=*/nullptr,
+            /*aad_length=*/0, messages[ind].data(), messages[ind].size(),
+            ciphertext.data(), ciphertext.size(), &ciphertext_bytes_written,
+            &error_details),
+        error_details);
+    ASSERT_EQ(ciphertext, ciphertexts[ind]);
+  }
+  // Decrypts the batch back.
+  for (size_t ind = 0; ind < count; ind++) {
+    ciphertext_vecs[ind] = {ciphertexts[ind].data(), ciphertexts[ind].size()};
+    frames[ind] = {nonces[ind].data(),
+                   &ciphertext_vecs[ind],
+                   1,
+                   {plaintexts[ind].data(), plaintexts[ind].size()},
+                   0};
+  }
+  gsec_assert_ok(
+      gsec_aead_crypter_decrypt_batch(crypter, nonce_length, frames.data(),
+                                      count, &error_details),
+      error_details);
+  for (size_t ind = 0; ind < count; ind++) {
+    ASSERT_EQ(frames[ind].bytes_written, messages[ind].size());
+    ASSERT_EQ(plaintexts[ind], messages[ind]);
+  }
+  // A corrupted frame fails the batch.
+  ciphertexts[count / 2][0] ^= 1;
+  grpc_status_code status = gsec_aead_crypter_decrypt_batch(
+      crypter, nonce_length, frames.data(), count, &error_details);
+  ASSERT_TRUE(gsec_test_expect_compare_code_and_substr(
+      status, GRPC_STATUS_FAILED_PRECONDITION, error_details,
+      "Checking tag failed."));
+  gpr_free(error_details);
+  // Bad batches are rejected up front.
+  error_details = nullptr;
+  status = gsec_aead_crypter_encrypt_batch(crypter, nonce_length, nullptr,
+                                           count, &error_details);
+  ASSERT_TRUE(gsec_test_expect_compare_code_and_substr(
+      status, GRPC_STATUS_INVALID_ARGUMENT, error_details,
+      "Non-zero num_frames but frames is nullptr."));
+  gpr_free(error_details);
+  error_details = nullptr;
+  status = gsec_aead_crypter_decrypt_batch(crypter, nonce_length + 1,
+                                           frames.data(), count,
+                                           &error_details);
+  ASSERT_TRUE(gsec_test_expect_compare_code_and_substr(
+      status, GRPC_STATUS_INVALID_ARGUMENT, error_details,
+      "Nonce buffer has the wrong length."));
+  gpr_free(error_details);
+}
+
 static void gsec_test_encryption_failure(gsec_aead_crypter* crypter) {
   ASSERT_NE(crypter, nullptr);
   size_t aad_length = kTestMaxLength;
@@ -869,6 +957,7 @@ TEST(AltsCryptTest, GsecTestDoGenericCrypterTests) {
   for (ind = 0; ind < kTestNumCrypters; ind++) {
     gsec_test_encrypt_decrypt(crypters[ind]);
     gsec_test_multiple_encrypt_decrypt(crypters[ind]);
+    gsec_test_batch_encrypt_decrypt(crypters[ind]);
     gsec_test_encryption_failure(crypters[ind]);
     gsec_test_decryption_failure(crypters[ind]);
   }
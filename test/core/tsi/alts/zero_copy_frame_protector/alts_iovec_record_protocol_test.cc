@@ -522,6 +522,93 @@ static void privacy_integrity_unsync_seal_unseal(
   alts_iovec_record_protocol_test_var_destroy(var);
 }
 
+static void privacy_integrity_batched_seal_unseal(
+    alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
+  alts_iovec_record_protocol_test_var* vars[kSealRepeatTimes];
+  alts_iovec_protect_frame protect_frames[kSealRepeatTimes];
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    vars[i] = alts_iovec_record_protocol_test_var_create();
+    protect_frames[i] = {vars[i]->data_iovec, vars[i]->data_iovec_length,
+                         vars[i]->protected_iovec};
+  }
+  // Seals the first frames as a batch and the last one on its own, which
+  // must continue from the counter the batch left off at.
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_protect_frames(
+          sender, protect_frames, kSealRepeatTimes - 1, nullptr);
+  ASSERT_EQ(status, GRPC_STATUS_OK);
+  alts_iovec_record_protocol_test_var* last = vars[kSealRepeatTimes - 1];
+  status = alts_iovec_record_protocol_privacy_integrity_protect(
+      sender, last->data_iovec, last->data_iovec_length, last->protected_iovec,
+      nullptr);
+  ASSERT_EQ(status, GRPC_STATUS_OK);
+  // Unseals the first frame on its own and the rest as a batch.
+  alts_iovec_unprotect_frame unprotect_frames[kSealRepeatTimes];
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_iovec_record_protocol_test_var* var = vars[i];
+    gpr_free(var->data_iovec);
+    randomly_slice(var->protected_buf + var->header_length,
+                   var->data_length + var->tag_length, &var->data_iovec,
+                   &var->data_iovec_length);
+    unprotect_frames[i] = {{var->protected_buf, var->header_length},
+                           var->data_iovec,
+                           var->data_iovec_length,
+                           var->unprotected_iovec};
+  }
+  status = alts_iovec_record_protocol_privacy_integrity_unprotect(
+      receiver, unprotect_frames[0].header, unprotect_frames[0].protected_vec,
+      unprotect_frames[0].protected_vec_length,
+      unprotect_frames[0].unprotected_data, nullptr);
+  ASSERT_EQ(status, GRPC_STATUS_OK);
+  status = alts_iovec_record_protocol_privacy_integrity_unprotect_frames(
+      receiver, unprotect_frames + 1, kSealRepeatTimes - 1, nullptr);
+  ASSERT_EQ(status, GRPC_STATUS_OK);
+  // Makes sure unprotected data are the same as the original.
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    ASSERT_EQ(memcmp(vars[i]->data_buf, vars[i]->dup_buf, vars[i]->data_length),
+              0);
+    alts_iovec_record_protocol_test_var_destroy(vars[i]);
+  }
+}
+
+static void privacy_integrity_batched_corrupted_data(
+    alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
+  alts_iovec_record_protocol_test_var* vars[kSealRepeatTimes];
+  alts_iovec_protect_frame protect_frames[kSealRepeatTimes];
+  alts_iovec_unprotect_frame unprotect_frames[kSealRepeatTimes];
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    vars[i] = alts_iovec_record_protocol_test_var_create();
+    protect_frames[i] = {vars[i]->data_iovec, vars[i]->data_iovec_length,
+                         vars[i]->protected_iovec};
+  }
+  grpc_status_code status =
+      alts_iovec_record_protocol_privacy_integrity_protect_frames(
+          sender, protect_frames, kSealRepeatTimes, nullptr);
+  ASSERT_EQ(status, GRPC_STATUS_OK);
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_iovec_record_protocol_test_var* var = vars[i];
+    var->protected_iovec.iov_base = var->protected_buf + var->header_length;
+    var->protected_iovec.iov_len = var->data_length + var->tag_length;
+    unprotect_frames[i] = {{var->protected_buf, var->header_length},
+                           &var->protected_iovec,
+                           1,
+                           var->unprotected_iovec};
+  }
+  // Corrupts a frame in the middle of the batch.
+  alts_iovec_record_protocol_test_var* corrupted = vars[kSealRepeatTimes / 2];
+  alter_random_byte(corrupted->protected_buf + corrupted->header_length,
+                    corrupted->data_length + corrupted->tag_length);
+  char* error_message = nullptr;
+  status = alts_iovec_record_protocol_privacy_integrity_unprotect_frames(
+      receiver, unprotect_frames, kSealRepeatTimes, &error_message);
+  ASSERT_TRUE(gsec_test_expect_compare_code_and_substr(
+      status, GRPC_STATUS_INTERNAL, error_message, "Frame decryption failed."));
+  gpr_free(error_message);
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_iovec_record_protocol_test_var_destroy(vars[i]);
+  }
+}
+
 static void privacy_integrity_corrupted_data(
     alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
   // Seals the data first.
@@ -918,6 +1005,26 @@ TEST(AltsIovecRecordProtocolTest, AltsIovecRecordProtocolInputCheckTests) {
   alts_iovec_record_protocol_test_fixture_destroy(fixture);
 }
 
+TEST(AltsIovecRecordProtocolTest,
+     AltsIovecRecordProtocolBatchedSealUnsealTests) {
+  for (bool rekey : {false, true}) {
+    alts_iovec_record_protocol_test_fixture* fixture =
+        alts_iovec_record_protocol_test_fixture_create(
+            rekey, /*integrity_only=*/false);
+    privacy_integrity_batched_seal_unseal(fixture->client_protect,
+                                          fixture->server_unprotect);
+    privacy_integrity_batched_seal_unseal(fixture->server_protect,
+                                          fixture->client_unprotect);
+    alts_iovec_record_protocol_test_fixture_destroy(fixture);
+
+    fixture = alts_iovec_record_protocol_test_fixture_create(
+        rekey, /*integrity_only=*/false);
+    privacy_integrity_batched_corrupted_data(fixture->client_protect,
+                                             fixture->server_unprotect);
+    alts_iovec_record_protocol_test_fixture_destroy(fixture);
+  }
+}
+
 TEST(AltsIovecRecordProtocolTest, AltsIovecRecordProtocolMixOperationsTests) {
   alts_iovec_record_protocol_test_fixture* fixture_1 =
       alts_iovec_record_protocol_test_fixture_create(
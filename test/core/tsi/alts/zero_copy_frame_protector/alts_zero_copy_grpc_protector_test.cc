@@ -21,12 +21,16 @@
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 
+#include <thread>
+#include <vector>
+
 #include "src/core/tsi/alts/crypt/gsec.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_iovec_record_protocol.h"
 #include "src/core/tsi/transport_security_grpc.h"
 #include "test/core/test_util/test_config.h"
 #include "test/core/tsi/alts/crypt/gsec_test_util.h"
 #include "gtest/gtest.h"
+#include "absl/functional/function_ref.h"
 #include "absl/types/span.h"
 
 // TODO(unknown): tests zero_copy_grpc_protector under TSI test library, which
@@ -398,6 +402,119 @@ TEST(AltsZeroCopyFrameProtectorTest, ReadFrameSizeHeaderIsSplit) {
   alts_zero_copy_grpc_protector_test_fixture_destroy(fixture);
 }
 
+// Unprotects many frames received at once, which are opened in batches, and
+// checks that a frame left incomplete is opened once the rest arrives.
+static void seal_unseal_batched(tsi_zero_copy_grpc_protector* sender,
+                                tsi_zero_copy_grpc_protector* receiver) {
+  constexpr size_t kBatchedBufferSize = 100 * kMaxProtectedFrameSize;
+  alts_zero_copy_grpc_protector_test_var* var =
+      alts_zero_copy_grpc_protector_test_var_create();
+  create_random_slice_buffer(&var->original_sb, &var->duplicate_sb,
+                             kBatchedBufferSize);
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(sender, &var->original_sb,
+                                                 &var->protected_sb),
+            TSI_OK);
+  EXPECT_EQ(var->original_sb.length, 0u);
+  grpc_slice_buffer_move_first(&var->protected_sb,
+                               var->protected_sb.length - kSmallBufferSize,
+                               &var->staging_sb);
+  int min_progress_size;
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_unprotect(receiver, &var->staging_sb,
+                                                   &var->unprotected_sb,
+                                                   &min_progress_size),
+            TSI_OK);
+  EXPECT_EQ(min_progress_size, static_cast<int>(kSmallBufferSize));
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                receiver, &var->protected_sb, &var->unprotected_sb, nullptr),
+            TSI_OK);
+  ASSERT_TRUE(
+      are_slice_buffers_equal(&var->unprotected_sb, &var->duplicate_sb));
+  alts_zero_copy_grpc_protector_test_var_destroy(var);
+}
+
+// Corrupts a frame in the middle of frames received at once.
+static void seal_unseal_batched_corrupted(
+    tsi_zero_copy_grpc_protector* sender,
+    tsi_zero_copy_grpc_protector* receiver) {
+  constexpr size_t kBatchedBufferSize = 8 * kMaxProtectedFrameSize;
+  alts_zero_copy_grpc_protector_test_var* var =
+      alts_zero_copy_grpc_protector_test_var_create();
+  create_random_slice_buffer(&var->original_sb, &var->duplicate_sb,
+                             kBatchedBufferSize);
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(sender, &var->original_sb,
+                                                 &var->protected_sb),
+            TSI_OK);
+  *pointer_to_nth_byte(&var->protected_sb, var->protected_sb.length / 2) ^= 1;
+  EXPECT_NE(tsi_zero_copy_grpc_protector_unprotect(
+                receiver, &var->protected_sb, &var->unprotected_sb, nullptr),
+            TSI_OK);
+  alts_zero_copy_grpc_protector_test_var_destroy(var);
+}
+
+TEST(AltsZeroCopyGrpcProtectorTest, BatchedProtectUnprotect) {
+  for (bool rekey : {false, true}) {
+    for (bool integrity_only : {false, true}) {
+      alts_zero_copy_grpc_protector_test_fixture* fixture =
+          alts_zero_copy_grpc_protector_test_fixture_create(
+              rekey, integrity_only, /*enable_extra_copy=*/false);
+      seal_unseal_batched(fixture->client, fixture->server);
+      seal_unseal_batched(fixture->server, fixture->client);
+      // Frames unprotected one at a time continue the same sequence.
+      seal_unseal_small_buffer(fixture->client, fixture->server);
+      seal_unseal_batched_corrupted(fixture->client, fixture->server);
+      alts_zero_copy_grpc_protector_test_fixture_destroy(fixture);
+    }
+  }
+}
+
+// Seals frames of a large buffer concurrently and out of order, and checks
+// that the receiver unprotects them as if they had been sealed in order.
+static void seal_parallel_unseal(tsi_zero_copy_grpc_protector* sender,
+                                 tsi_zero_copy_grpc_protector* receiver) {
+  constexpr size_t kParallelBufferSize = 64 * kMaxProtectedFrameSize;
+  for (size_t max_parallelism : {2, 3, 16}) {
+    alts_zero_copy_grpc_protector_test_var* var =
+        alts_zero_copy_grpc_protector_test_var_create();
+    create_random_slice_buffer(&var->original_sb, &var->duplicate_sb,
+                               kParallelBufferSize);
+    size_t lanes_sealed = 0;
+    ASSERT_EQ(tsi_zero_copy_grpc_protector_protect_parallel(
+                  sender, &var->original_sb, &var->protected_sb,
+                  max_parallelism,
+                  [&](size_t n, absl::FunctionRef<void(size_t)> seal) {
+                    EXPECT_LE(n, max_parallelism);
+                    std::vector<std::thread> threads;
+                    for (size_t i = n; i > 0; --i) {
+                      threads.emplace_back([seal, i]() { seal(i - 1); });
+                    }
+                    for (auto& thread : threads) thread.join();
+                    lanes_sealed += n;
+                  }),
+              TSI_OK);
+    EXPECT_GT(lanes_sealed, 1u);
+    EXPECT_EQ(var->original_sb.length, 0u);
+    ASSERT_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                  receiver, &var->protected_sb, &var->unprotected_sb, nullptr),
+              TSI_OK);
+    ASSERT_TRUE(
+        are_slice_buffers_equal(&var->unprotected_sb, &var->duplicate_sb));
+    // Frames protected sequentially afterwards continue the same sequence.
+    seal_unseal_small_buffer(sender, receiver);
+    alts_zero_copy_grpc_protector_test_var_destroy(var);
+  }
+}
+
+TEST(AltsZeroCopyGrpcProtectorTest, ParallelProtect) {
+  for (bool rekey : {false, true}) {
+    alts_zero_copy_grpc_protector_test_fixture* fixture =
+        alts_zero_copy_grpc_protector_test_fixture_create(
+            rekey, /*integrity_only=*/false, /*enable_extra_copy=*/false);
+    seal_parallel_unseal(fixture->client, fixture->server);
+    seal_parallel_unseal(fixture->server, fixture->client);
+    alts_zero_copy_grpc_protector_test_fixture_destroy(fixture);
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -146,6 +146,15 @@ TEST(FakeTransportSecurityTest, FakeTsiTestDoRoundTripOddBufferSize) {
   }
 }
 
+TEST(FakeTransportSecurityTest, FakeProtectorCannotOffloadToKernel) {
+  tsi_frame_protector* protector = tsi_create_fake_frame_protector(nullptr);
+  EXPECT_EQ(tsi_frame_protector_offload_protect_to_kernel(protector, -1),
+            TSI_INVALID_ARGUMENT);
+  EXPECT_EQ(tsi_frame_protector_offload_protect_to_kernel(protector, 0),
+            TSI_UNIMPLEMENTED);
+  tsi_frame_protector_destroy(protector);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -19,13 +19,30 @@
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 
 #include <grpc/grpc.h>
+#include <grpc/support/port_platform.h>
 
+#ifndef GPR_WINDOWS
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <string.h>
+
+#include <map>
 #include <string>
 #include <unordered_set>
 
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_store.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 #include "test/core/test_util/test_config.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "gtest/gtest.h"
 
 namespace grpc_core {
@@ -182,6 +199,250 @@ TEST(SslSessionCacheTest, CapacityZeroCache) {
   SSL_CTX_free(ssl_ctx);
 }
 
+class FakeSessionStore final : public tsi::SslSessionStore {
+ public:
+  void PutSession(absl::string_view key, absl::string_view session) override {
+    MutexLock lock(&mu_);
+    sessions_[std::string(key)] = std::string(session);
+  }
+  std::map<std::string, std::string> GetSessions() override {
+    MutexLock lock(&mu_);
+    ++get_sessions_calls_;
+    return sessions_;
+  }
+  absl::StatusOr<TicketKeys> GetTicketKeys(size_t size,
+                                           absl::Time time) override {
+    MutexLock lock(&mu_);
+    ++get_ticket_keys_calls_;
+    return TicketKeys{std::string(size, 'k'), "", time + absl::Hours(1)};
+  }
+
+  // Waits up to 10s for a session to be stored for \a key.
+  bool WaitForSession(absl::string_view key) {
+    const absl::Time deadline = absl::Now() + absl::Seconds(10);
+    while (absl::Now() < deadline) {
+      {
+        MutexLock lock(&mu_);
+        if (sessions_.count(std::string(key)) != 0) return true;
+      }
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    return false;
+  }
+
+  int get_sessions_calls() {
+    MutexLock lock(&mu_);
+    return get_sessions_calls_;
+  }
+
+  int get_ticket_keys_calls() {
+    MutexLock lock(&mu_);
+    return get_ticket_keys_calls_;
+  }
+
+ private:
+  Mutex mu_;
+  std::map<std::string, std::string> sessions_ ABSL_GUARDED_BY(mu_);
+  int get_sessions_calls_ ABSL_GUARDED_BY(mu_) = 0;
+  int get_ticket_keys_calls_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+std::string SerializeSession(SSL_SESSION* session) {
+  std::string serialized(i2d_SSL_SESSION(session, nullptr), '\0');
+  unsigned char* out = reinterpret_cast<unsigned char*>(&serialized[0]);
+  i2d_SSL_SESSION(session, &out);
+  return serialized;
+}
+
+TEST(SslSessionCacheTest, WritesBehindToStore) {
+  SSL_CTX* ssl_ctx = SSL_CTX_new(TLS_method());
+  auto store = MakeRefCounted<FakeSessionStore>();
+  RefCountedPtr<tsi::SslSessionLRUCache> cache =
+      tsi::SslSessionLRUCache::Create(1, store);
+  cache->Put("foo.domain", tsi::SslSessionPtr(SSL_SESSION_new(ssl_ctx)));
+  EXPECT_NE(cache->Get("foo.domain"), nullptr);
+  EXPECT_TRUE(store->WaitForSession("foo.domain"));
+  SSL_CTX_free(ssl_ctx);
+}
+
+TEST(SslSessionCacheTest, LoadsStoredSessionsOnCreation) {
+  SSL_CTX* ssl_ctx = SSL_CTX_new(TLS_method());
+  tsi::SslSessionPtr session(SSL_SESSION_new(ssl_ctx));
+  auto store = MakeRefCounted<FakeSessionStore>();
+  store->PutSession("foo.domain", SerializeSession(session.get()));
+  store->PutSession("bar.domain", SerializeSession(session.get()));
+  RefCountedPtr<tsi::SslSessionLRUCache> cache =
+      tsi::SslSessionLRUCache::Create(1, store);
+  // Only as many sessions as fit are loaded.
+  EXPECT_EQ(cache->Size(), 1);
+  EXPECT_NE(cache->Get("foo.domain") != nullptr,
+            cache->Get("bar.domain") != nullptr);
+  EXPECT_EQ(cache->Get("baz.domain"), nullptr);
+  // Lookups, hits or misses, never go to the store.
+  EXPECT_EQ(store->get_sessions_calls(), 1);
+  SSL_CTX_free(ssl_ctx);
+}
+
+TEST(SslSessionCacheTest, IgnoresInvalidStoredSession) {
+  auto store = MakeRefCounted<FakeSessionStore>();
+  store->PutSession("foo.domain", "not a session");
+  RefCountedPtr<tsi::SslSessionLRUCache> cache =
+      tsi::SslSessionLRUCache::Create(1, store);
+  EXPECT_EQ(cache->Get("foo.domain"), nullptr);
+  EXPECT_EQ(cache->Get("bar.domain"), nullptr);
+  EXPECT_EQ(cache->Size(), 0);
+}
+
+TEST(SslTicketKeyRingTest, HandshakesDoNotGoToTheStore) {
+  auto store = MakeRefCounted<FakeSessionStore>();
+  auto ring = tsi::SslTicketKeyRing::Create(
+      store, grpc_event_engine::experimental::GetDefaultEventEngine());
+  ASSERT_TRUE(ring.ok()) << ring.status();
+  for (int i = 0; i < 100; ++i) {
+    tsi::SslTicketKeyRing::Keys keys;
+    (*ring)->Get(&keys);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(keys.current),
+                          sizeof(keys.current)),
+              std::string(tsi::SslTicketKeyRing::kKeysSize, 'k'));
+    EXPECT_FALSE(keys.has_previous);
+  }
+  EXPECT_EQ(store->get_ticket_keys_calls(), 1);
+}
+
+std::string UniqueKey(absl::string_view prefix) {
+  return absl::StrCat(prefix, ".", absl::ToUnixNanos(absl::Now()), ".domain");
+}
+
+#ifndef GPR_WINDOWS
+
+// Returns a new directory for a store, so that tests don't see each other's
+// files.
+std::string MakeStoreDirectory() {
+  std::string directory =
+      absl::StrCat(::testing::TempDir(), "/", UniqueKey("store"));
+  GRPC_CHECK_EQ(mkdir(directory.c_str(), 0700), 0);
+  return directory;
+}
+
+// Creates \a path with \a mode, regardless of the umask.
+void WriteFileWithMode(const std::string& path, absl::string_view contents,
+                       mode_t mode) {
+  int fd = open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, mode);
+  GRPC_CHECK_GE(fd, 0);
+  GRPC_CHECK_EQ(fchmod(fd, mode), 0);
+  GRPC_CHECK_EQ(write(fd, contents.data(), contents.size()),
+                static_cast<ssize_t>(contents.size()));
+  close(fd);
+}
+
+// Ticket keys rotate so rarely with this period that every test run falls
+// into period 0.
+constexpr Duration kNoRotation = Duration::Hours(24 * 365 * 1000);
+
+TEST(FileSslSessionStoreTest, SessionsSurviveStoreRecreation) {
+  const std::string directory = MakeStoreDirectory();
+  auto store = tsi::CreateFileSslSessionStore(directory);
+  EXPECT_TRUE(store->GetSessions().empty());
+  store->PutSession("foo.domain", "session1");
+  store->PutSession("foo.domain", "session2");
+  store->PutSession("bar.domain", "session3");
+  std::map<std::string, std::string> expected = {{"foo.domain", "session2"},
+                                                 {"bar.domain", "session3"}};
+  EXPECT_EQ(store->GetSessions(), expected);
+  // Another instance, as in a restarted or sibling process, sees them too.
+  auto other_store = tsi::CreateFileSslSessionStore(directory);
+  EXPECT_EQ(other_store->GetSessions(), expected);
+}
+
+TEST(FileSslSessionStoreTest, TicketKeysAreShared) {
+  const std::string directory = MakeStoreDirectory();
+  auto store = tsi::CreateFileSslSessionStore(directory, kNoRotation);
+  auto keys = store->GetTicketKeys(48, absl::Now());
+  ASSERT_TRUE(keys.ok()) << keys.status();
+  EXPECT_EQ(keys->current.size(), 48u);
+  EXPECT_EQ(keys->previous, "");
+  EXPECT_EQ(store->GetTicketKeys(48, absl::Now())->current, keys->current);
+  auto other_store = tsi::CreateFileSslSessionStore(directory, kNoRotation);
+  EXPECT_EQ(other_store->GetTicketKeys(48, absl::Now())->current,
+            keys->current);
+}
+
+TEST(FileSslSessionStoreTest, TicketKeysRotateAndKeepPreviousKeys) {
+  const std::string directory = MakeStoreDirectory();
+  auto store = tsi::CreateFileSslSessionStore(directory, Duration::Seconds(1));
+  auto first = store->GetTicketKeys(48, absl::Now());
+  ASSERT_TRUE(first.ok()) << first.status();
+  // The next period's keys can be fetched ahead of time.
+  auto next = store->GetTicketKeys(48, first->rotation_time);
+  ASSERT_TRUE(next.ok()) << next.status();
+  EXPECT_NE(next->current, first->current);
+  EXPECT_EQ(next->previous, first->current);
+  EXPECT_EQ(next->rotation_time, first->rotation_time + absl::Seconds(1));
+  // A process that did not see either period reads their keys back.
+  auto other_store =
+      tsi::CreateFileSslSessionStore(directory, Duration::Seconds(1));
+  auto other = other_store->GetTicketKeys(48, first->rotation_time);
+  ASSERT_TRUE(other.ok()) << other.status();
+  EXPECT_EQ(other->current, next->current);
+  EXPECT_EQ(other->previous, first->current);
+}
+
+TEST(FileSslSessionStoreTest, TicketKeyRingRotates) {
+  const std::string directory = MakeStoreDirectory();
+  auto ring = tsi::SslTicketKeyRing::Create(
+      tsi::CreateFileSslSessionStore(directory, Duration::Seconds(1)),
+      grpc_event_engine::experimental::GetDefaultEventEngine());
+  ASSERT_TRUE(ring.ok()) << ring.status();
+  tsi::SslTicketKeyRing::Keys first;
+  (*ring)->Get(&first);
+  tsi::SslTicketKeyRing::Keys rotated = first;
+  const absl::Time deadline = absl::Now() + absl::Seconds(10);
+  while (memcmp(rotated.current, first.current, sizeof(first.current)) == 0 &&
+         absl::Now() < deadline) {
+    absl::SleepFor(absl::Milliseconds(10));
+    (*ring)->Get(&rotated);
+  }
+  ASSERT_NE(memcmp(rotated.current, first.current, sizeof(first.current)), 0);
+  ASSERT_TRUE(rotated.has_previous);
+  EXPECT_EQ(memcmp(rotated.previous, first.current, sizeof(first.current)), 0);
+}
+
+TEST(FileSslSessionStoreTest, CreatesFilesReadableByOwnerOnly) {
+  const std::string directory = MakeStoreDirectory();
+  auto store = tsi::CreateFileSslSessionStore(directory, kNoRotation);
+  ASSERT_TRUE(store->GetTicketKeys(48, absl::Now()).ok());
+  store->PutSession("foo.domain", "session");
+  for (const char* name : {"ticket_keys_0", "session_666f6f2e646f6d61696e"}) {
+    struct stat st;
+    ASSERT_EQ(stat(absl::StrCat(directory, "/", name).c_str(), &st), 0)
+        << name;
+    EXPECT_EQ(st.st_mode & 0777, 0600) << name;
+  }
+}
+
+TEST(FileSslSessionStoreTest, IgnoresFilesOthersCanRead) {
+  const std::string directory = MakeStoreDirectory();
+  WriteFileWithMode(absl::StrCat(directory, "/ticket_keys_0"),
+                    std::string(48, 'k'), 0644);
+  WriteFileWithMode(absl::StrCat(directory, "/session_666f6f2e646f6d61696e"),
+                    "session", 0640);
+  auto store = tsi::CreateFileSslSessionStore(directory, kNoRotation);
+  auto keys = store->GetTicketKeys(48, absl::Now());
+  EXPECT_EQ(keys.status().code(), absl::StatusCode::kPermissionDenied)
+      << keys.status();
+  EXPECT_TRUE(store->GetSessions().empty());
+}
+
+TEST(FileSslSessionStoreTest, MissingDirectory) {
+  auto store = tsi::CreateFileSslSessionStore(
+      absl::StrCat(::testing::TempDir(), "/", UniqueKey("missing")));
+  EXPECT_FALSE(store->GetTicketKeys(48, absl::Now()).ok());
+  store->PutSession("foo.domain", "session");
+  EXPECT_TRUE(store->GetSessions().empty());
+}
+
+#endif  // GPR_WINDOWS
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -51,6 +51,20 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
+// Mirrors the conditions under which ssl_transport_security.cc can offload
+// record protection to kernel TLS.
+#if defined(GPR_LINUX) && defined(OPENSSL_IS_BORINGSSL) && \
+    defined(__has_include)
+#if __has_include(<linux/tls.h>)
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <openssl/aead.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#define SSL_TSI_TEST_KERNEL_TLS_SUPPORTED
+#endif
+#endif
+
 #define SSL_TSI_TEST_WRONG_SNI "test.google.cn"
 #define SSL_TSI_TEST_INVALID_SNI "1.2.3.4"
 
@@ -1187,6 +1201,229 @@ TEST_P(SslTransportSecurityTest, ConcurrentlyProtectAndUnprotectOnServer) {
   tsi_frame_protector_destroy(client_protector);
   tsi_frame_protector_destroy(server_protector);
 }
+
+#ifdef SSL_TSI_TEST_KERNEL_TLS_SUPPORTED
+
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+
+// Creates a connected pair of loopback TCP sockets.
+bool MakeTcpSocketPair(int fds[2]) {
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addr_len = sizeof(addr);
+  bool ok = listener >= 0 &&
+            bind(listener, reinterpret_cast<sockaddr*>(&addr), addr_len) ==
+                0 &&
+            listen(listener, 1) == 0 &&
+            getsockname(listener, reinterpret_cast<sockaddr*>(&addr),
+                        &addr_len) == 0;
+  int client = ok ? socket(AF_INET, SOCK_STREAM, 0) : -1;
+  ok = ok && client >= 0 &&
+       connect(client, reinterpret_cast<sockaddr*>(&addr), addr_len) == 0;
+  int server = ok ? accept(listener, nullptr, nullptr) : -1;
+  if (listener >= 0) close(listener);
+  if (server < 0) {
+    if (client >= 0) close(client);
+    return false;
+  }
+  fds[0] = client;
+  fds[1] = server;
+  return true;
+}
+
+// Returns true if the kernel can attach the tls ULP to a TCP socket.
+bool KernelTlsAvailable() {
+  int fds[2];
+  if (!MakeTcpSocketPair(fds)) return false;
+  const bool available =
+      setsockopt(fds[0], IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) == 0;
+  close(fds[0]);
+  close(fds[1]);
+  return available;
+}
+
+// Checks that `client_protector` still protects in userspace, after a
+// failed offload.
+void ExpectUserspaceProtection(tsi_frame_protector* client_protector,
+                               tsi_frame_protector* server_protector) {
+  std::string buffer(1024, 'a');
+  std::string protected_bytes = Protect(client_protector, buffer);
+  EXPECT_FALSE(protected_bytes.empty());
+  EXPECT_EQ(Unprotect(server_protector, protected_bytes), buffer);
+}
+
+TEST_P(SslTransportSecurityTest, KernelTlsOffloadTls13) {
+  // BoringSSL only negotiates AES-GCM, the cipher offloaded, when the CPU
+  // accelerates it.
+  if (!EVP_has_aes_hardware()) GTEST_SKIP() << "no AES hardware";
+  if (!KernelTlsAvailable()) GTEST_SKIP() << "kernel TLS unavailable";
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_frame_protector* client_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  tsi_frame_protector* server_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  int fds[2];
+  ASSERT_TRUE(MakeTcpSocketPair(fds));
+  ASSERT_EQ(tsi_frame_protector_offload_protect_to_kernel(client_protector,
+                                                          fds[0]),
+            TSI_OK);
+  // The protector no longer protects outgoing data itself.
+  unsigned char frame[64];
+  size_t frame_size = sizeof(frame);
+  size_t plaintext_size = 1;
+  EXPECT_EQ(tsi_frame_protector_protect(
+                client_protector, reinterpret_cast<const unsigned char*>("a"),
+                &plaintext_size, frame, &frame_size),
+            TSI_FAILED_PRECONDITION);
+  // Plaintext written to the socket arrives as a record the peer's
+  // protector can unprotect.
+  std::string buffer(1024, 'a');
+  ASSERT_EQ(write(fds[0], buffer.data(), buffer.size()),
+            static_cast<ssize_t>(buffer.size()));
+  std::string protected_bytes;
+  while (protected_bytes.size() < buffer.size() + kTls13FrameOverhead) {
+    char chunk[4096];
+    ssize_t n = read(fds[1], chunk, sizeof(chunk));
+    ASSERT_GT(n, 0);
+    protected_bytes.append(chunk, n);
+  }
+  EXPECT_EQ(protected_bytes.size(), buffer.size() + kTls13FrameOverhead);
+  EXPECT_EQ(Unprotect(server_protector, protected_bytes), buffer);
+  close(fds[0]);
+  close(fds[1]);
+  tsi_frame_protector_destroy(client_protector);
+  tsi_frame_protector_destroy(server_protector);
+}
+
+TEST_P(SslTransportSecurityTest, KernelTlsOffloadUnsupportedTlsVersion) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_2, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_frame_protector* client_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  tsi_frame_protector* server_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  int fds[2];
+  ASSERT_TRUE(MakeTcpSocketPair(fds));
+  EXPECT_EQ(tsi_frame_protector_offload_protect_to_kernel(client_protector,
+                                                          fds[0]),
+            TSI_UNIMPLEMENTED);
+  ExpectUserspaceProtection(client_protector, server_protector);
+  close(fds[0]);
+  close(fds[1]);
+  tsi_frame_protector_destroy(client_protector);
+  tsi_frame_protector_destroy(server_protector);
+}
+
+TEST_P(SslTransportSecurityTest, KernelTlsOffloadUnsupportedCipher) {
+  // Without AES hardware BoringSSL negotiates ChaCha20-Poly1305, which is
+  // not offloaded.  There is no way to force that cipher otherwise.
+  if (EVP_has_aes_hardware()) GTEST_SKIP() << "AES-GCM is negotiated";
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_frame_protector* client_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  tsi_frame_protector* server_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  int fds[2];
+  ASSERT_TRUE(MakeTcpSocketPair(fds));
+  EXPECT_EQ(tsi_frame_protector_offload_protect_to_kernel(client_protector,
+                                                          fds[0]),
+            TSI_UNIMPLEMENTED);
+  ExpectUserspaceProtection(client_protector, server_protector);
+  close(fds[0]);
+  close(fds[1]);
+  tsi_frame_protector_destroy(client_protector);
+  tsi_frame_protector_destroy(server_protector);
+}
+
+TEST_P(SslTransportSecurityTest, KernelTlsOffloadNonSocketFd) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_frame_protector* client_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  tsi_frame_protector* server_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  int pipe_fds[2];
+  ASSERT_EQ(pipe(pipe_fds), 0);
+  EXPECT_EQ(tsi_frame_protector_offload_protect_to_kernel(client_protector,
+                                                          pipe_fds[1]),
+            TSI_UNIMPLEMENTED);
+  ExpectUserspaceProtection(client_protector, server_protector);
+  close(pipe_fds[0]);
+  close(pipe_fds[1]);
+  tsi_frame_protector_destroy(client_protector);
+  tsi_frame_protector_destroy(server_protector);
+}
+
+TEST_P(SslTransportSecurityTest, KernelTlsOffloadWithoutTlsUlp) {
+  SetUpSslFixture(tsi_tls_version::TSI_TLS1_3, /*send_client_ca_list=*/false);
+  DoHandshake();
+  tsi_frame_protector* client_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->client_result,
+                /*max_output_protected_frame_size=*/nullptr, &client_protector),
+            TSI_OK);
+  tsi_frame_protector* server_protector;
+  ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                ssl_tsi_test_fixture_->server_result,
+                /*max_output_protected_frame_size=*/nullptr, &server_protector),
+            TSI_OK);
+  // On a kernel without the tls ULP any TCP socket works; elsewhere, the
+  // kernel refuses to attach the ULP to a socket that is not connected.
+  int fds[2];
+  int fd;
+  if (KernelTlsAvailable()) {
+    fd = socket(AF_INET, SOCK_STREAM, 0);
+    fds[0] = fds[1] = -1;
+  } else {
+    ASSERT_TRUE(MakeTcpSocketPair(fds));
+    fd = fds[0];
+  }
+  ASSERT_GE(fd, 0);
+  EXPECT_EQ(tsi_frame_protector_offload_protect_to_kernel(client_protector, fd),
+            TSI_UNIMPLEMENTED);
+  ExpectUserspaceProtection(client_protector, server_protector);
+  if (fds[0] >= 0) {
+    close(fds[0]);
+    close(fds[1]);
+  } else {
+    close(fd);
+  }
+  tsi_frame_protector_destroy(client_protector);
+  tsi_frame_protector_destroy(server_protector);
+}
+
+#endif  // SSL_TSI_TEST_KERNEL_TLS_SUPPORTED
 #endif  // defined(OPENSSL_IS_BORINGSSL)
 
 const tsi_ssl_handshaker_factory_vtable* original_vtable;
@@ -0,0 +1,83 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/controlled_delay.h"
+
+#include "gtest/gtest.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace {
+
+const Duration kTarget = Duration::Milliseconds(5);
+const Duration kInterval = Duration::Milliseconds(100);
+
+Timestamp At(int64_t millis) {
+  return Timestamp::FromMillisecondsAfterProcessEpoch(1000 + millis);
+}
+
+TEST(ControlledDelayTest, NoOp) {
+  ControlledDelay codel(kTarget, kInterval);
+  EXPECT_EQ(codel.target(), kTarget);
+  EXPECT_EQ(codel.interval(), kInterval);
+  EXPECT_EQ(codel.shed_threshold(), Duration::Milliseconds(10));
+  EXPECT_FALSE(codel.overloaded());
+}
+
+TEST(ControlledDelayTest, FirstIntervalIsNeverOverloaded) {
+  ControlledDelay codel(kTarget, kInterval);
+  EXPECT_FALSE(codel.OnDequeue(Duration::Seconds(1), At(0)));
+  EXPECT_FALSE(codel.OnDequeue(Duration::Seconds(1), At(50)));
+  EXPECT_FALSE(codel.overloaded());
+}
+
+TEST(ControlledDelayTest, SustainedDelayIsOverload) {
+  ControlledDelay codel(kTarget, kInterval);
+  codel.OnDequeue(Duration::Milliseconds(20), At(0));
+  codel.OnDequeue(Duration::Milliseconds(30), At(50));
+  // The next interval begins: every sojourn in the last one was above target.
+  EXPECT_TRUE(codel.OnDequeue(Duration::Milliseconds(20), At(100)));
+  EXPECT_TRUE(codel.overloaded());
+  EXPECT_TRUE(codel.ShouldShed(Duration::Milliseconds(11)));
+  EXPECT_FALSE(codel.ShouldShed(Duration::Milliseconds(10)));
+}
+
+TEST(ControlledDelayTest, BurstIsNotOverload) {
+  ControlledDelay codel(kTarget, kInterval);
+  codel.OnDequeue(Duration::Milliseconds(50), At(0));
+  // The queue drained once during the interval, so the delay was transient.
+  codel.OnDequeue(Duration::Milliseconds(1), At(50));
+  EXPECT_FALSE(codel.OnDequeue(Duration::Milliseconds(50), At(100)));
+  EXPECT_FALSE(codel.overloaded());
+}
+
+TEST(ControlledDelayTest, EmptyQueueClearsOverload) {
+  ControlledDelay codel(kTarget, kInterval);
+  codel.OnDequeue(Duration::Milliseconds(20), At(0));
+  codel.OnDequeue(Duration::Milliseconds(20), At(100));
+  EXPECT_TRUE(codel.overloaded());
+  codel.OnQueueEmpty(At(150));
+  // Still overloaded until the interval in which the queue emptied ends.
+  EXPECT_TRUE(codel.overloaded());
+  codel.OnDequeue(Duration::Milliseconds(20), At(200));
+  EXPECT_FALSE(codel.overloaded());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
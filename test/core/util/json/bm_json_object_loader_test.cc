@@ -0,0 +1,164 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/json/json_reader.h"
+#include "src/core/util/time.h"
+#include "src/core/util/validation_errors.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace {
+
+// A service config-like structure, with a per-method config list.
+struct MethodConfig {
+  struct Name {
+    std::string service;
+    std::optional<std::string> method;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader = JsonObjectLoader<Name>()
+                                      .Field("service", &Name::service)
+                                      .OptionalField("method", &Name::method)
+                                      .Finish();
+      return loader;
+    }
+  };
+
+  struct RetryPolicy {
+    uint32_t max_attempts = 0;
+    Duration initial_backoff;
+    Duration max_backoff;
+    float backoff_multiplier = 0;
+    std::vector<std::string> retryable_status_codes;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader =
+          JsonObjectLoader<RetryPolicy>()
+              .Field("maxAttempts", &RetryPolicy::max_attempts)
+              .Field("initialBackoff", &RetryPolicy::initial_backoff)
+              .Field("maxBackoff", &RetryPolicy::max_backoff)
+              .Field("backoffMultiplier", &RetryPolicy::backoff_multiplier)
+              .Field("retryableStatusCodes",
+                     &RetryPolicy::retryable_status_codes)
+              .Finish();
+      return loader;
+    }
+  };
+
+  std::vector<Name> names;
+  std::optional<Duration> timeout;
+  std::optional<bool> wait_for_ready;
+  std::optional<RetryPolicy> retry_policy;
+  std::map<std::string, std::string> labels;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<MethodConfig>()
+            .Field("name", &MethodConfig::names)
+            .OptionalField("timeout", &MethodConfig::timeout)
+            .OptionalField("waitForReady", &MethodConfig::wait_for_ready)
+            .OptionalField("retryPolicy", &MethodConfig::retry_policy)
+            .OptionalField("labels", &MethodConfig::labels)
+            .Finish();
+    return loader;
+  }
+};
+
+struct ServiceConfig {
+  std::vector<MethodConfig> method_configs;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<ServiceConfig>()
+            .Field("methodConfig", &ServiceConfig::method_configs)
+            .Finish();
+    return loader;
+  }
+};
+
+// Returns a config of a few megabytes, with some fields the loader ignores.
+std::string MakeServiceConfig() {
+  std::string json = "{\"loadBalancingConfig\": [{\"round_robin\": {}}], "
+                     "\"methodConfig\": [";
+  for (int i = 0; i < 10000; ++i) {
+    if (i > 0) json.append(", ");
+    absl::StrAppend(
+        &json, "{\"name\": [{\"service\": \"pkg.Service", i,
+        "\", \"method\": \"Method\"}, {\"service\": \"pkg.Other", i,
+        "\"}], \"timeout\": \"", i % 60, ".5s\", \"waitForReady\": true, ",
+        "\"retryPolicy\": {\"maxAttempts\": 3, \"initialBackoff\": \"0.1s\", ",
+        "\"maxBackoff\": \"10s\", \"backoffMultiplier\": 1.5, ",
+        "\"retryableStatusCodes\": [\"UNAVAILABLE\", \"ABORTED\"]}, ",
+        "\"labels\": {\"team\": \"team", i % 7, "\", \"tier\": \"gold\"}, ",
+        "\"comment\": {\"owner\": \"owner", i,
+        "\", \"notes\": [\"unused\", 1, 2.5, null, false]}}");
+  }
+  json.append("]}");
+  return json;
+}
+
+void BM_LoadFromJson(benchmark::State& state) {
+  const std::string json = MakeServiceConfig();
+  for (auto _ : state) {
+    auto parsed = JsonParse(json);
+    GRPC_CHECK_OK(parsed);
+    auto config = LoadFromJson<ServiceConfig>(*parsed);
+    GRPC_CHECK_OK(config);
+    benchmark::DoNotOptimize(config);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_LoadFromJson);
+
+void BM_LoadFromJsonString(benchmark::State& state) {
+  const std::string json = MakeServiceConfig();
+  for (auto _ : state) {
+    auto config = LoadFromJsonString<ServiceConfig>(json);
+    GRPC_CHECK_OK(config);
+    benchmark::DoNotOptimize(config);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_LoadFromJsonString);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+// The main function that runs the benchmarks
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -29,12 +29,19 @@
 namespace grpc_core {
 namespace {
 
+// Also checks that LoadFromJsonString() gives the same status.
 template <typename T>
 absl::StatusOr<T> Parse(absl::string_view json,
                         const JsonArgs& args = JsonArgs()) {
+  auto streamed = LoadFromJsonString<T>(json, args);
   auto parsed = JsonParse(json);
-  if (!parsed.ok()) return parsed.status();
-  return LoadFromJson<T>(*parsed, args);
+  if (!parsed.ok()) {
+    EXPECT_EQ(streamed.status(), parsed.status());
+    return parsed.status();
+  }
+  auto result = LoadFromJson<T>(*parsed, args);
+  EXPECT_EQ(streamed.status(), result.status());
+  return result;
 }
 
 //
@@ -1290,6 +1297,39 @@ TEST(JsonObjectLoader, PostLoadHook) {
   EXPECT_EQ(test_struct->a, 1);
 }
 
+TEST(JsonObjectLoader, PostLoadHookWithoutSource) {
+  struct TestStruct {
+    int32_t a = 0;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader = JsonObjectLoader<TestStruct>()
+                                      .OptionalField("a", &TestStruct::a)
+                                      .Finish();
+      return loader;
+    }
+
+    void JsonPostLoad(const JsonArgs& /*args*/, ValidationErrors* errors) {
+      ++a;
+      if (a > 5) errors->AddError("too big");
+    }
+  };
+  auto test_struct = Parse<TestStruct>("{\"a\": 1}");
+  ASSERT_TRUE(test_struct.ok()) << test_struct.status();
+  EXPECT_EQ(test_struct->a, 2);
+  auto streamed = LoadFromJsonString<TestStruct>("{\"a\": 1}");
+  ASSERT_TRUE(streamed.ok()) << streamed.status();
+  EXPECT_EQ(streamed->a, 2);
+  test_struct = Parse<TestStruct>("{\"a\": 5}");
+  EXPECT_EQ(test_struct.status().message(),
+            "errors validating JSON: [field: error:too big]")
+      << test_struct.status();
+  // Not called if the value is not an object.
+  test_struct = Parse<TestStruct>("[]");
+  EXPECT_EQ(test_struct.status().message(),
+            "errors validating JSON: [field: error:is not an object]")
+      << test_struct.status();
+}
+
 TEST(JsonObjectLoader, CustomValidationInPostLoadHook) {
   struct TestStruct {
     int32_t a = 0;
@@ -1417,6 +1457,109 @@ TEST(JsonObjectLoader, LoadJsonObjectField) {
   }
 }
 
+TEST(JsonObjectLoader, LoadFromJsonString) {
+  struct Inner {
+    std::string name;
+    std::vector<int32_t> values;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader = JsonObjectLoader<Inner>()
+                                      .Field("name", &Inner::name)
+                                      .OptionalField("values", &Inner::values)
+                                      .Finish();
+      return loader;
+    }
+  };
+  struct TestStruct {
+    std::vector<Inner> inners;
+    std::map<std::string, Inner> inner_map;
+    std::optional<Inner> optional_inner;
+    Json::Object unprocessed;
+    bool flag = false;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader =
+          JsonObjectLoader<TestStruct>()
+              .Field("inners", &TestStruct::inners)
+              .OptionalField("inner_map", &TestStruct::inner_map)
+              .OptionalField("optional_inner", &TestStruct::optional_inner)
+              .OptionalField("unprocessed", &TestStruct::unprocessed)
+              .OptionalField("flag", &TestStruct::flag)
+              .Finish();
+      return loader;
+    }
+  };
+  auto test_struct = LoadFromJsonString<TestStruct>(
+      "{\"unknown\": {\"inners\": [1, {\"x\": []}]},"
+      " \"inners\": [{\"name\": \"a\", \"values\": [1, \"2\"]},"
+      "              {\"name\": \"b\", \"values\": null}],"
+      " \"inner_map\": {\"k\": {\"name\": \"c\"}},"
+      " \"optional_inner\": null,"
+      " \"unprocessed\": {\"x\": [true]},"
+      " \"flag\": true}");
+  ASSERT_TRUE(test_struct.ok()) << test_struct.status();
+  ASSERT_EQ(test_struct->inners.size(), 2);
+  EXPECT_EQ(test_struct->inners[0].name, "a");
+  EXPECT_THAT(test_struct->inners[0].values, ::testing::ElementsAre(1, 2));
+  EXPECT_EQ(test_struct->inners[1].name, "b");
+  EXPECT_THAT(test_struct->inners[1].values, ::testing::ElementsAre());
+  ASSERT_EQ(test_struct->inner_map.size(), 1);
+  EXPECT_EQ(test_struct->inner_map["k"].name, "c");
+  EXPECT_FALSE(test_struct->optional_inner.has_value());
+  EXPECT_EQ(JsonDump(Json::FromObject(test_struct->unprocessed)),
+            "{\"x\":[true]}");
+  EXPECT_TRUE(test_struct->flag);
+  // Errors in nested values are reported with the same fields as
+  // LoadFromJson().
+  test_struct = Parse<TestStruct>(
+      "{\"inners\": [{\"values\": [\"x\"]}],"
+      " \"inner_map\": {\"k\": []}, \"optional_inner\": {},"
+      " \"flag\": 1}");
+  EXPECT_EQ(test_struct.status().message(),
+            "errors validating JSON: ["
+            "field:flag error:is not a boolean; "
+            "field:inner_map[\"k\"] error:is not an object; "
+            "field:inners[0].name error:field not present; "
+            "field:inners[0].values[0] error:failed to parse number; "
+            "field:optional_inner.name error:field not present]")
+      << test_struct.status();
+}
+
+TEST(JsonObjectLoader, LoadFromJsonStringParseErrors) {
+  struct TestStruct {
+    std::vector<int32_t> values;
+    std::map<std::string, int32_t> map;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader =
+          JsonObjectLoader<TestStruct>()
+              .OptionalField("values", &TestStruct::values)
+              .OptionalField("map", &TestStruct::map)
+              .Finish();
+      return loader;
+    }
+  };
+  for (absl::string_view json_str : {
+           "",
+           "{\"values\": [1, 2",
+           "{\"values\": [1, 2]} x",
+           "[1, 2, 3}",
+           // Duplicate keys, including in skipped values.
+           "{\"values\": [1], \"values\": [2]}",
+           "{\"values\": null, \"values\": [2], \"values\": []}",
+           "{\"other\": 1, \"values\": [], \"other\": 2}",
+           "{\"map\": {\"a\": 1, \"b\": 2, \"a\": 3}}",
+           "{\"values\": {\"a\": 1, \"a\": 2}}",
+           "{\"other\": [{\"a\": 1, \"a\": 2}]}",
+       }) {
+    auto parsed = JsonParse(json_str);
+    ASSERT_FALSE(parsed.ok()) << json_str;
+    EXPECT_EQ(LoadFromJsonString<TestStruct>(json_str).status(),
+              parsed.status())
+        << json_str;
+  }
+}
+
 }  // namespace
 }  // namespace grpc_core
 
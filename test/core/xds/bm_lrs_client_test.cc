@@ -0,0 +1,136 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/xds/grpc/xds_bootstrap_grpc.h"
+#include "src/core/xds/grpc/xds_bootstrap_grpc_builder.h"
+#include "src/core/xds/xds_client/lrs_client.h"
+#include "src/core/xds/xds_client/xds_backend_metric_propagation.h"
+#include "src/core/xds/xds_client/xds_locality.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.h"
+#include "test/core/xds/xds_transport_fake.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::FuzzingEventEngine;
+
+// An LrsClient reporting to a fake server, with one cluster's stats.
+class LrsFixture {
+ public:
+  LrsFixture() {
+    auto bootstrap = GrpcXdsBootstrapBuilder::Build(
+        "{\"xds_servers\": [{\"server_uri\": \"xds.example.com\", "
+        "\"channel_creds\": [{\"type\": \"insecure\"}]}]}");
+    GRPC_CHECK_OK(bootstrap);
+    std::shared_ptr<GrpcXdsBootstrap> shared_bootstrap = std::move(*bootstrap);
+    auto lrs_server = shared_bootstrap->servers().front()->target();
+    lrs_client_ = MakeRefCounted<LrsClient>(
+        shared_bootstrap, "bm_lrs_client", "1",
+        MakeRefCounted<FakeXdsTransportFactory>([]() {}, event_engine_),
+        event_engine_);
+    auto propagation = MakeRefCounted<BackendMetricPropagation>();
+    propagation->propagation_bits = BackendMetricPropagation::kCpuUtilization |
+                                    BackendMetricPropagation::kMemUtilization;
+    locality_stats_ = lrs_client_->AddClusterLocalityStats(
+        lrs_server, "cluster", "eds_service",
+        MakeRefCounted<XdsLocalityName>("region", "zone", "sub_zone"),
+        std::move(propagation));
+    drop_stats_ =
+        lrs_client_->AddClusterDropStats(lrs_server, "cluster", "eds_service");
+  }
+
+  ~LrsFixture() {
+    drop_stats_.reset();
+    locality_stats_.reset();
+    lrs_client_.reset();
+    event_engine_->FuzzingDone();
+    event_engine_->TickUntilIdle();
+    event_engine_->UnsetGlobalHooks();
+  }
+
+  LrsClient::ClusterLocalityStats* locality_stats() const {
+    return locality_stats_.get();
+  }
+  LrsClient::ClusterDropStats* drop_stats() const { return drop_stats_.get(); }
+
+ private:
+  std::shared_ptr<FuzzingEventEngine> event_engine_ =
+      std::make_shared<FuzzingEventEngine>(FuzzingEventEngine::Options(),
+                                           fuzzing_event_engine::Actions());
+  RefCountedPtr<LrsClient> lrs_client_;
+  RefCountedPtr<LrsClient::ClusterLocalityStats> locality_stats_;
+  RefCountedPtr<LrsClient::ClusterDropStats> drop_stats_;
+};
+
+LrsFixture* g_fixture = nullptr;
+
+// Records one call through the locality, as the xds_cluster_impl LB policy
+// does for every pick.
+void BM_LrsRecordCall(benchmark::State& state) {
+  LrsClient::ClusterLocalityStats* stats = g_fixture->locality_stats();
+  BackendMetricData backend_metrics;
+  backend_metrics.cpu_utilization = 0.5;
+  backend_metrics.mem_utilization = 0.25;
+  for (auto _ : state) {
+    stats->AddCallStarted();
+    stats->AddCallFinished(&backend_metrics);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LrsRecordCall)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_LrsRecordDrop(benchmark::State& state) {
+  LrsClient::ClusterDropStats* stats = g_fixture->drop_stats();
+  const std::string category = "throttle";
+  for (auto _ : state) {
+    stats->AddCallDropped(category);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LrsRecordDrop)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+// The main function that runs the benchmarks
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  {
+    grpc_core::LrsFixture fixture;
+    grpc_core::g_fixture = &fixture;
+    benchmark::RunTheBenchmarksNamespaced();
+    grpc_core::g_fixture = nullptr;
+  }
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,172 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/util/matchers.h"
+#include "src/core/xds/grpc/xds_route_config.h"
+#include "src/core/xds/grpc/xds_routing.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace {
+
+class RouteListIterator final : public XdsRouting::RouteListIterator {
+ public:
+  explicit RouteListIterator(
+      const std::vector<XdsRouteConfigResource::Route::Matchers>& routes)
+      : routes_(routes) {}
+
+  size_t Size() const override { return routes_.size(); }
+
+  const XdsRouteConfigResource::Route::Matchers& GetMatchersForRoute(
+      size_t index) const override {
+    return routes_[index];
+  }
+
+ private:
+  const std::vector<XdsRouteConfigResource::Route::Matchers>& routes_;
+};
+
+class VirtualHostListIterator final
+    : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostListIterator(
+      const std::vector<std::vector<std::string>>& domains)
+      : domains_(domains) {}
+
+  size_t Size() const override { return domains_.size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  const std::vector<std::vector<std::string>>& domains_;
+};
+
+// Alternates exact and prefix path matchers, one service per route.
+std::vector<XdsRouteConfigResource::Route::Matchers> MakeRoutes(int count) {
+  std::vector<XdsRouteConfigResource::Route::Matchers> routes(count);
+  for (int i = 0; i < count; ++i) {
+    routes[i].path_matcher =
+        i % 2 == 0 ? *StringMatcher::Create(StringMatcher::Type::kExact,
+                                            absl::StrCat("/pkg.Svc", i, "/Get"))
+                   : *StringMatcher::Create(StringMatcher::Type::kPrefix,
+                                            absl::StrCat("/pkg.Svc", i, "/"));
+  }
+  return routes;
+}
+
+// Argument 0: The number of routes. The request matches the last one.
+void BM_XdsRoutingLinearScan(benchmark::State& state) {
+  const int route_count = state.range(0);
+  auto routes = MakeRoutes(route_count);
+  const std::string path = absl::StrCat("/pkg.Svc", route_count - 1, "/Get");
+  grpc_metadata_batch metadata;
+  for (auto _ : state) {
+    auto index = XdsRouting::GetRouteForRequest(RouteListIterator(routes),
+                                                path, &metadata);
+    benchmark::DoNotOptimize(index);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_XdsRoutingLinearScan)->RangeMultiplier(4)->Range(1, 4096);
+
+void BM_XdsRoutingRouteTable(benchmark::State& state) {
+  const int route_count = state.range(0);
+  auto routes = MakeRoutes(route_count);
+  XdsRouting::RouteTable table{RouteListIterator(routes)};
+  const std::string path = absl::StrCat("/pkg.Svc", route_count - 1, "/Get");
+  grpc_metadata_batch metadata;
+  for (auto _ : state) {
+    auto index = table.GetRouteForRequest(path, &metadata);
+    benchmark::DoNotOptimize(index);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_XdsRoutingRouteTable)->RangeMultiplier(4)->Range(1, 4096);
+
+// One virtual host per domain, cycling through exact, suffix and prefix
+// patterns, followed by a universe one. The host used below only matches the
+// suffix pattern of the second virtual host, so a linear scan has to check
+// every pattern.
+std::vector<std::vector<std::string>> MakeVirtualHostDomains(int count) {
+  std::vector<std::vector<std::string>> domains(count);
+  for (int i = 0; i < count; ++i) {
+    switch (i % 3) {
+      case 0:
+        domains[i].push_back(absl::StrCat("host", i, ".example.com"));
+        break;
+      case 1:
+        domains[i].push_back(absl::StrCat("*.svc", i, ".example.com"));
+        break;
+      default:
+        domains[i].push_back(absl::StrCat("host", i, ".*"));
+        break;
+    }
+  }
+  domains.push_back({"*"});
+  return domains;
+}
+
+// Argument 0: The number of virtual hosts.
+void BM_XdsRoutingFindVirtualHostLinearScan(benchmark::State& state) {
+  auto domains = MakeVirtualHostDomains(state.range(0));
+  const std::string host = "foo.svc1.example.com";
+  for (auto _ : state) {
+    auto index = XdsRouting::FindVirtualHostForDomain(
+        VirtualHostListIterator(domains), host);
+    benchmark::DoNotOptimize(index);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_XdsRoutingFindVirtualHostLinearScan)
+    ->RangeMultiplier(4)
+    ->Range(4, 4096);
+
+void BM_XdsRoutingVirtualHostTable(benchmark::State& state) {
+  auto domains = MakeVirtualHostDomains(state.range(0));
+  XdsRouting::VirtualHostTable table{VirtualHostListIterator(domains)};
+  const std::string host = "foo.svc1.example.com";
+  for (auto _ : state) {
+    auto index = table.Find(host);
+    benchmark::DoNotOptimize(index);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_XdsRoutingVirtualHostTable)->RangeMultiplier(4)->Range(4, 4096);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+// The main function that runs the benchmarks
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
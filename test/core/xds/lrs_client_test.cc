@@ -0,0 +1,171 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/xds/xds_client/lrs_client.h"
+
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/xds/grpc/xds_bootstrap_grpc.h"
+#include "src/core/xds/grpc/xds_bootstrap_grpc_builder.h"
+#include "src/core/xds/xds_client/xds_backend_metric_propagation.h"
+#include "src/core/xds/xds_client/xds_locality.h"
+#include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.h"
+#include "test/core/test_util/test_config.h"
+#include "test/core/xds/xds_transport_fake.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using grpc_event_engine::experimental::FuzzingEventEngine;
+
+// Enough threads to spread over several shards on most machines. The
+// stats are sharded by CPU, so which shards get used is up to the
+// scheduler, but the totals must not depend on it.
+constexpr size_t kNumThreads = 16;
+constexpr size_t kCallsPerThread = 1000;
+
+class LrsClientStatsTest : public ::testing::Test {
+ protected:
+  LrsClientStatsTest() {
+    auto bootstrap = GrpcXdsBootstrapBuilder::Build(
+        "{\"xds_servers\": [{\"server_uri\": \"xds.example.com\", "
+        "\"channel_creds\": [{\"type\": \"insecure\"}]}]}");
+    EXPECT_TRUE(bootstrap.ok()) << bootstrap.status();
+    std::shared_ptr<GrpcXdsBootstrap> shared_bootstrap = std::move(*bootstrap);
+    lrs_server_ = shared_bootstrap->servers().front()->target();
+    lrs_client_ = MakeRefCounted<LrsClient>(
+        shared_bootstrap, "lrs_client_test", "1",
+        MakeRefCounted<FakeXdsTransportFactory>([]() {}, event_engine_),
+        event_engine_);
+  }
+
+  ~LrsClientStatsTest() override {
+    lrs_client_.reset();
+    event_engine_->FuzzingDone();
+    event_engine_->TickUntilIdle();
+    event_engine_->UnsetGlobalHooks();
+  }
+
+  // Runs fn(thread_index) on kNumThreads threads at once.
+  template <typename F>
+  static void RunOnThreads(F fn) {
+    std::vector<std::thread> threads;
+    threads.reserve(kNumThreads);
+    for (size_t i = 0; i < kNumThreads; ++i) threads.emplace_back(fn, i);
+    for (auto& thread : threads) thread.join();
+  }
+
+  std::shared_ptr<FuzzingEventEngine> event_engine_ =
+      std::make_shared<FuzzingEventEngine>(FuzzingEventEngine::Options(),
+                                           fuzzing_event_engine::Actions());
+  std::shared_ptr<const XdsBootstrap::XdsServerTarget> lrs_server_;
+  RefCountedPtr<LrsClient> lrs_client_;
+};
+
+TEST_F(LrsClientStatsTest, LocalityStatsMergeShardsAndResetOnReport) {
+  auto propagation = MakeRefCounted<BackendMetricPropagation>();
+  propagation->propagation_bits = BackendMetricPropagation::kCpuUtilization |
+                                  BackendMetricPropagation::kNamedMetricsAll;
+  auto stats = lrs_client_->AddClusterLocalityStats(
+      lrs_server_, "cluster", "eds_service",
+      MakeRefCounted<XdsLocalityName>("region", "zone", "sub_zone"),
+      std::move(propagation));
+  ASSERT_NE(stats, nullptr);
+  BackendMetricData backend_metrics;
+  backend_metrics.cpu_utilization = 0.5;
+  backend_metrics.named_metrics["foo"] = 2;
+  RunOnThreads([&](size_t) {
+    for (size_t i = 0; i < kCallsPerThread; ++i) {
+      stats->AddCallStarted();
+      stats->AddCallFinished(&backend_metrics, /*fail=*/i % 4 == 0);
+    }
+    // Left in progress across the report.
+    stats->AddCallStarted();
+  });
+  constexpr uint64_t kCalls = kNumThreads * kCallsPerThread;
+  auto snapshot = stats->GetSnapshotAndReset();
+  EXPECT_EQ(snapshot.total_issued_requests, kCalls + kNumThreads);
+  EXPECT_EQ(snapshot.total_successful_requests, kCalls / 4 * 3);
+  EXPECT_EQ(snapshot.total_error_requests, kCalls / 4);
+  EXPECT_EQ(snapshot.total_requests_in_progress, kNumThreads);
+  EXPECT_EQ(snapshot.cpu_utilization.num_requests_finished_with_metric,
+            kCalls);
+  EXPECT_DOUBLE_EQ(snapshot.cpu_utilization.total_metric_value, kCalls * 0.5);
+  EXPECT_TRUE(snapshot.mem_utilization.IsZero());
+  ASSERT_EQ(snapshot.backend_metrics.size(), 1u);
+  EXPECT_EQ(snapshot.backend_metrics["named_metrics.foo"]
+                .num_requests_finished_with_metric,
+            kCalls);
+  EXPECT_DOUBLE_EQ(
+      snapshot.backend_metrics["named_metrics.foo"].total_metric_value,
+      kCalls * 2.0);
+  // Everything but the calls still in progress was reset by the report.
+  snapshot = stats->GetSnapshotAndReset();
+  EXPECT_EQ(snapshot.total_requests_in_progress, kNumThreads);
+  snapshot.total_requests_in_progress = 0;
+  EXPECT_TRUE(snapshot.IsZero());
+  // Calls finishing on other threads than they started on still balance.
+  RunOnThreads([&](size_t) { stats->AddCallFinished(nullptr); });
+  snapshot = stats->GetSnapshotAndReset();
+  EXPECT_EQ(snapshot.total_successful_requests, kNumThreads);
+  EXPECT_EQ(snapshot.total_requests_in_progress, 0u);
+}
+
+TEST_F(LrsClientStatsTest, DropStatsMergeShardsAndResetOnReport) {
+  auto stats =
+      lrs_client_->AddClusterDropStats(lrs_server_, "cluster", "eds_service");
+  ASSERT_NE(stats, nullptr);
+  RunOnThreads([&](size_t thread_index) {
+    const std::string category = thread_index % 2 == 0 ? "even" : "odd";
+    for (size_t i = 0; i < kCallsPerThread; ++i) {
+      stats->AddUncategorizedDrops();
+      stats->AddCallDropped(category);
+      stats->AddCallDropped("all");
+    }
+  });
+  constexpr uint64_t kCalls = kNumThreads * kCallsPerThread;
+  auto snapshot = stats->GetSnapshotAndReset();
+  EXPECT_EQ(snapshot.uncategorized_drops, kCalls);
+  LrsClient::ClusterDropStats::CategorizedDropsMap expected = {
+      {"all", kCalls}, {"even", kCalls / 2}, {"odd", kCalls / 2}};
+  EXPECT_EQ(snapshot.categorized_drops, expected);
+  snapshot = stats->GetSnapshotAndReset();
+  EXPECT_TRUE(snapshot.IsZero());
+  EXPECT_TRUE(snapshot.categorized_drops.empty());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
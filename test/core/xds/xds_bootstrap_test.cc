@@ -248,6 +248,29 @@ TEST(XdsBootstrapTest, ValidWithoutNode) {
   EXPECT_EQ(bootstrap->node(), nullptr);
 }
 
+TEST(XdsBootstrapTest, DeltaProtocolServerFeature) {
+  const char* json_str =
+      "{"
+      "  \"xds_servers\": ["
+      "    {"
+      "      \"server_uri\": \"fake:///lb1\","
+      "      \"channel_creds\": [{\"type\": \"fake\"}],"
+      "      \"server_features\": [\"xds_delta_protocol\"]"
+      "    },"
+      "    {"
+      "      \"server_uri\": \"fake:///lb2\","
+      "      \"channel_creds\": [{\"type\": \"fake\"}]"
+      "    }"
+      "  ]"
+      "}";
+  auto bootstrap_or = GrpcXdsBootstrapBuilder::Build(json_str);
+  ASSERT_TRUE(bootstrap_or.ok()) << bootstrap_or.status();
+  auto bootstrap = std::move(*bootstrap_or);
+  ASSERT_EQ(bootstrap->servers().size(), 2);
+  EXPECT_TRUE(bootstrap->servers()[0]->DeltaProtocol());
+  EXPECT_FALSE(bootstrap->servers()[1]->DeltaProtocol());
+}
+
 TEST(XdsBootstrapTest, InsecureCreds) {
   const char* json_str =
       "{"
@@ -71,6 +71,8 @@
 // IWYU pragma: no_include "google/protobuf/util/json_util.h"
 
 using envoy::admin::v3::ClientResourceStatus;
+using envoy::service::discovery::v3::DeltaDiscoveryRequest;
+using envoy::service::discovery::v3::DeltaDiscoveryResponse;
 using envoy::service::discovery::v3::DiscoveryRequest;
 using envoy::service::discovery::v3::DiscoveryResponse;
 using envoy::service::status::v3::ClientConfig;
@@ -155,12 +157,14 @@ class XdsClientTest : public ::testing::Test {
       explicit FakeXdsServer(
           absl::string_view server_uri = kDefaultXdsServerUrl,
           bool fail_on_data_errors = false,
-          bool resource_timer_is_transient_failure = false)
+          bool resource_timer_is_transient_failure = false,
+          bool delta_protocol = false)
           : server_target_(
                 std::make_shared<FakeXdsServerTarget>(std::string(server_uri))),
             fail_on_data_errors_(fail_on_data_errors),
             resource_timer_is_transient_failure_(
-                resource_timer_is_transient_failure) {}
+                resource_timer_is_transient_failure),
+            delta_protocol_(delta_protocol) {}
       bool IgnoreResourceDeletion() const override {
         return !fail_on_data_errors_;
       }
@@ -168,14 +172,16 @@ class XdsClientTest : public ::testing::Test {
       bool ResourceTimerIsTransientFailure() const override {
         return resource_timer_is_transient_failure_;
       }
+      bool DeltaProtocol() const override { return delta_protocol_; }
       bool Equals(const XdsServer& other) const override {
         const auto& o = static_cast<const FakeXdsServer&>(other);
         return *server_target_ == *o.server_target_ &&
-               fail_on_data_errors_ == o.fail_on_data_errors_;
+               fail_on_data_errors_ == o.fail_on_data_errors_ &&
+               delta_protocol_ == o.delta_protocol_;
       }
       std::string Key() const override {
         return absl::StrCat(server_target_->server_uri(), "#",
-                            fail_on_data_errors_);
+                            fail_on_data_errors_, "#", delta_protocol_);
       }
       std::shared_ptr<const XdsServerTarget> target() const override {
         return server_target_;
@@ -185,6 +191,7 @@ class XdsClientTest : public ::testing::Test {
       std::shared_ptr<FakeXdsServerTarget> server_target_;
       bool fail_on_data_errors_ = false;
       bool resource_timer_is_transient_failure_ = false;
+      bool delta_protocol_ = false;
     };
 
     class FakeAuthority : public Authority {
@@ -693,6 +700,47 @@ class XdsClientTest : public ::testing::Test {
     DiscoveryResponse response_;
   };
 
+  // A helper class to build and serialize a DeltaDiscoveryResponse.
+  class DeltaResponseBuilder {
+   public:
+    explicit DeltaResponseBuilder(absl::string_view type_url) {
+      response_.set_type_url(absl::StrCat("type.googleapis.com/", type_url));
+    }
+
+    DeltaResponseBuilder& set_system_version_info(
+        absl::string_view system_version_info) {
+      response_.set_system_version_info(std::string(system_version_info));
+      return *this;
+    }
+    DeltaResponseBuilder& set_nonce(absl::string_view nonce) {
+      response_.set_nonce(std::string(nonce));
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddFooResource(const XdsFooResource& resource,
+                                         absl::string_view version) {
+      auto* res = response_.add_resources();
+      res->set_name(resource.name);
+      res->set_version(std::string(version));
+      *res->mutable_resource() = XdsFooResourceType::EncodeAsAny(resource);
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddRemovedResource(absl::string_view name) {
+      response_.add_removed_resources(std::string(name));
+      return *this;
+    }
+
+    std::string Serialize() {
+      std::string serialized_response;
+      EXPECT_TRUE(response_.SerializeToString(&serialized_response));
+      return serialized_response;
+    }
+
+   private:
+    DeltaDiscoveryResponse response_;
+  };
+
   class MetricsReporter : public XdsMetricsReporter {
    public:
     using ResourceUpdateMap = std::map<
@@ -711,6 +759,10 @@ class XdsClientTest : public ::testing::Test {
       MutexLock lock(&mu_);
       return resource_updates_invalid_;
     }
+    ResourceUpdateMap resource_decodes_skipped() const {
+      MutexLock lock(&mu_);
+      return resource_decodes_skipped_;
+    }
     const ServerFailureMap& server_failures() const { return server_failures_; }
 
     // Returns true if matchers return true before the timeout.
@@ -768,12 +820,22 @@ class XdsClientTest : public ::testing::Test {
       cond_.SignalAll();
     }
 
+    void ReportResourceDecodesSkipped(absl::string_view xds_server,
+                                      absl::string_view resource_type,
+                                      uint64_t num_skipped) override {
+      MutexLock lock(&mu_);
+      resource_decodes_skipped_[std::pair(std::string(xds_server),
+                                          std::string(resource_type))] +=
+          num_skipped;
+    }
+
     std::shared_ptr<FuzzingEventEngine> event_engine_;
 
     mutable Mutex mu_;
     ResourceUpdateMap resource_updates_valid_ ABSL_GUARDED_BY(mu_);
     ResourceUpdateMap resource_updates_invalid_ ABSL_GUARDED_BY(mu_);
     ServerFailureMap server_failures_ ABSL_GUARDED_BY(mu_);
+    ResourceUpdateMap resource_decodes_skipped_ ABSL_GUARDED_BY(mu_);
     CondVar cond_;
   };
 
@@ -889,6 +951,13 @@ class XdsClientTest : public ::testing::Test {
     return WaitForAdsStream(*xds_client_->bootstrap().servers().front());
   }
 
+  RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall>
+  WaitForDeltaAdsStream() {
+    return transport_factory_->WaitForStream(
+        *xds_client_->bootstrap().servers().front()->target(),
+        FakeXdsTransportFactory::kDeltaAdsMethod);
+  }
+
   void TriggerConnectionFailure(const XdsBootstrap::XdsServer& xds_server,
                                 absl::Status status) {
     transport_factory_->TriggerConnectionFailure(*xds_server.target(),
@@ -938,6 +1007,51 @@ class XdsClientTest : public ::testing::Test {
         << location.file() << ":" << location.line();
   }
 
+  // Gets the latest delta request sent to the fake xDS server.
+  std::optional<DeltaDiscoveryRequest> WaitForDeltaRequest(
+      FakeXdsTransportFactory::FakeStreamingCall* stream,
+      SourceLocation location = SourceLocation()) {
+    auto message = stream->WaitForMessageFromClient();
+    if (!message.has_value()) return std::nullopt;
+    DeltaDiscoveryRequest request;
+    bool success = request.ParseFromString(*message);
+    EXPECT_TRUE(success) << "Failed to deserialize DeltaDiscoveryRequest at "
+                         << location.file() << ":" << location.line();
+    if (!success) return std::nullopt;
+    return std::move(request);
+  }
+
+  // Helper function to check the fields of a DeltaDiscoveryRequest.
+  void CheckDeltaRequest(const DeltaDiscoveryRequest& request,
+                         absl::string_view type_url,
+                         absl::string_view response_nonce,
+                         const absl::Status& error_detail,
+                         const std::set<absl::string_view>& subscribe,
+                         const std::set<absl::string_view>& unsubscribe,
+                         SourceLocation location = SourceLocation()) {
+    EXPECT_EQ(request.type_url(),
+              absl::StrCat("type.googleapis.com/", type_url))
+        << location.file() << ":" << location.line();
+    EXPECT_EQ(request.response_nonce(), response_nonce)
+        << location.file() << ":" << location.line();
+    if (error_detail.ok()) {
+      EXPECT_FALSE(request.has_error_detail())
+          << location.file() << ":" << location.line();
+    } else {
+      EXPECT_EQ(request.error_detail().code(),
+                static_cast<int>(error_detail.code()))
+          << location.file() << ":" << location.line();
+      EXPECT_EQ(request.error_detail().message(), error_detail.message())
+          << location.file() << ":" << location.line();
+    }
+    EXPECT_THAT(request.resource_names_subscribe(),
+                ::testing::UnorderedElementsAreArray(subscribe))
+        << location.file() << ":" << location.line();
+    EXPECT_THAT(request.resource_names_unsubscribe(),
+                ::testing::UnorderedElementsAreArray(unsubscribe))
+        << location.file() << ":" << location.line();
+  }
+
   // Helper function to check the contents of the node message in a
   // request against the client's node info.
   void CheckRequestNode(const DiscoveryRequest& request,
@@ -1242,6 +1356,70 @@ TEST_F(XdsClientTest, BasicWatch) {
   EXPECT_THAT(csds.generic_xds_configs(), ::testing::ElementsAre());
 }
 
+TEST_F(XdsClientTest, DecodeSkippedForUnchangedResource) {
+  InitXdsClient();
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Send a response.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(metrics_reporter_->resource_decodes_skipped(),
+              ::testing::ElementsAre());
+  // The server resends the same bytes under a new version.  The resource
+  // should not be decoded again, and the watcher should not be notified.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("2")
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo1", 6),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"2", /*response_nonce=*/"B",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  EXPECT_FALSE(watcher->HasEvent());
+  EXPECT_THAT(metrics_reporter_->resource_decodes_skipped(),
+              ::testing::ElementsAre(::testing::Pair(
+                  ::testing::Pair(kDefaultXdsServerUrl,
+                                  XdsFooResourceType::Get()->type_url()),
+                  1)));
+  // A changed resource is decoded and delivered as usual.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("3")
+          .set_nonce("C")
+          .AddFooResource(XdsFooResource("foo1", 7),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 7);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(metrics_reporter_->resource_decodes_skipped(),
+              ::testing::ElementsAre(::testing::Pair(::testing::_, 1)));
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
 TEST_F(XdsClientTest, UpdateFromServer) {
   InitXdsClient();
   // Start a watch for "foo1".
@@ -6520,6 +6698,178 @@ TEST_F(XdsClientTest, FallbackOnReachabilityOnlyNotEnabled) {
   EXPECT_TRUE(stream->IsOrphaned());
 }
 
+TEST_F(XdsClientTest, DeltaProtocolBasicWatch) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(kDefaultXdsServerUrl, false, false,
+                                       /*delta_protocol=*/true)}));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created a delta ADS stream.
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient should have sent a subscription request on the stream.
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  CheckNode(request->node());  // Should be present on the first request.
+  EXPECT_THAT(request->initial_resource_versions(), ::testing::IsEmpty());
+  // Send a response.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_system_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v1")
+          .Serialize());
+  // XdsClient should have delivered the response to the watcher.
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // CSDS should show the per-resource version.
+  ClientConfig csds = DumpCsds();
+  EXPECT_THAT(csds.generic_xds_configs(),
+              ::testing::ElementsAre(CsdsResourceAcked(
+                  XdsFooResourceType::Get()->type_url(), "foo1",
+                  resource->AsJsonString(), "v1", TimestampProtoEq(kTime0))));
+  // XdsClient should have sent an ACK without re-subscribing.
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  EXPECT_FALSE(request->has_node());
+  // Start a watch for "foo2".  Only the new name should be subscribed.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo2"}, /*unsubscribe=*/{});
+  // The server sends only the new resource.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_system_version_info("2")
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo2", 7), "v1")
+          .Serialize());
+  resource = watcher2->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->name, "foo2");
+  EXPECT_EQ(resource->value, 7);
+  // The first watcher should not see any change.
+  EXPECT_FALSE(watcher->HasEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  // Cancel the watch for "foo2".  Only that name should be unsubscribed.
+  CancelFooWatch(watcher2.get(), "foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{"foo2"});
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
+TEST_F(XdsClientTest, DeltaProtocolRemovedResource) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(kDefaultXdsServerUrl, false, false,
+                                       /*delta_protocol=*/true)}));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  // Send a response.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_system_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  // The server explicitly removes the resource.  Since resource deletions
+  // are ignored by default, the watcher should see an ambient error.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_system_version_info("2")
+          .set_nonce("B")
+          .AddRemovedResource("foo1")
+          .Serialize());
+  auto error = watcher->WaitForNextAmbientError();
+  ASSERT_TRUE(error.has_value());
+  EXPECT_EQ(*error,
+            absl::NotFoundError("does not exist (node ID:xds_client_test)"));
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
+TEST_F(XdsClientTest, DeltaProtocolSendsInitialResourceVersionsOnNewStream) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(kDefaultXdsServerUrl, false, false,
+                                       /*delta_protocol=*/true)}));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Send a response.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_system_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Server closes the stream.
+  stream->MaybeSendStatusToClient(absl::OkStatus());
+  EXPECT_TRUE(stream->IsOrphaned());
+  // XdsClient should create a new stream and re-subscribe, reporting the
+  // version it already has so that the server need not resend it.
+  stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  CheckNode(request->node());
+  EXPECT_THAT(request->initial_resource_versions(),
+              ::testing::ElementsAre(::testing::Pair("foo1", "v1")));
+  // Watcher should not see any change.
+  EXPECT_FALSE(watcher->HasEvent());
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->IsOrphaned());
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
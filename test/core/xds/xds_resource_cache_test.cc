@@ -0,0 +1,165 @@
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/xds/xds_client/xds_resource_cache.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/xds/xds_client/xds_bootstrap.h"
+#include "src/core/xds/xds_client/xds_resource_type.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class FakeXdsServer final : public XdsBootstrap::XdsServer {
+ public:
+  explicit FakeXdsServer(std::string key) : key_(std::move(key)) {}
+
+  std::shared_ptr<const XdsBootstrap::XdsServerTarget> target()
+      const override {
+    return nullptr;
+  }
+  bool IgnoreResourceDeletion() const override { return false; }
+  bool FailOnDataErrors() const override { return false; }
+  bool ResourceTimerIsTransientFailure() const override { return false; }
+  bool DeltaProtocol() const override { return false; }
+  bool Equals(const XdsServer& other) const override {
+    return key_ == other.Key();
+  }
+  std::string Key() const override { return key_; }
+
+ private:
+  std::string key_;
+};
+
+class FakeXdsBootstrap final : public XdsBootstrap {
+ public:
+  std::string ToString() const override { return "fake"; }
+  std::vector<const XdsServer*> servers() const override { return {}; }
+  const Node* node() const override { return nullptr; }
+  const Authority* LookupAuthority(const std::string&) const override {
+    return nullptr;
+  }
+};
+
+class FakeResourceType final : public XdsResourceType {
+ public:
+  absl::string_view type_url() const override { return "fake.Resource"; }
+  DecodeResult Decode(const DecodeContext&, absl::string_view) const override {
+    return {std::nullopt, absl::UnimplementedError("not used")};
+  }
+  bool ResourcesEqual(const ResourceData*,
+                      const ResourceData*) const override {
+    return false;
+  }
+};
+
+struct FakeResource : public XdsResourceType::ResourceData {};
+
+class XdsResourceCacheTest : public ::testing::Test {
+ protected:
+  XdsResourceCache& cache_ = XdsResourceCache::Get();
+  FakeResourceType type_;
+  std::shared_ptr<XdsBootstrap> bootstrap_ =
+      std::make_shared<FakeXdsBootstrap>();
+  FakeXdsServer server_{"server"};
+};
+
+TEST_F(XdsResourceCacheTest, LookupReturnsInsertedResource) {
+  auto resource = std::make_shared<FakeResource>();
+  cache_.Insert(XdsResourceCache::Key(&type_, bootstrap_, server_, "bytes"),
+                "foo", resource);
+  auto cached = cache_.Lookup(
+      XdsResourceCache::Key(&type_, bootstrap_, server_, "bytes"));
+  ASSERT_TRUE(cached.has_value());
+  EXPECT_EQ(cached->name, "foo");
+  EXPECT_EQ(cached->resource, resource);
+}
+
+TEST_F(XdsResourceCacheTest, KeyIncludesDecodeInputs) {
+  auto resource = std::make_shared<FakeResource>();
+  cache_.Insert(XdsResourceCache::Key(&type_, bootstrap_, server_, "bytes"),
+                "foo", resource);
+  // Different bytes.
+  EXPECT_FALSE(cache_
+                   .Lookup(XdsResourceCache::Key(&type_, bootstrap_, server_,
+                                                 "other bytes"))
+                   .has_value());
+  // Different server.
+  FakeXdsServer other_server("other_server");
+  EXPECT_FALSE(cache_
+                   .Lookup(XdsResourceCache::Key(&type_, bootstrap_,
+                                                 other_server, "bytes"))
+                   .has_value());
+  // Different bootstrap config.
+  std::shared_ptr<XdsBootstrap> other_bootstrap =
+      std::make_shared<FakeXdsBootstrap>();
+  EXPECT_FALSE(cache_
+                   .Lookup(XdsResourceCache::Key(&type_, other_bootstrap,
+                                                 server_, "bytes"))
+                   .has_value());
+  // Different resource type.
+  FakeResourceType other_type;
+  EXPECT_FALSE(cache_
+                   .Lookup(XdsResourceCache::Key(&other_type, bootstrap_,
+                                                 server_, "bytes"))
+                   .has_value());
+}
+
+TEST_F(XdsResourceCacheTest, EntryExpiresWithResource) {
+  auto resource = std::make_shared<FakeResource>();
+  XdsResourceCache::Key key(&type_, bootstrap_, server_, "expiring bytes");
+  cache_.Insert(key, "foo", resource);
+  resource.reset();
+  EXPECT_FALSE(cache_.Lookup(key).has_value());
+}
+
+TEST_F(XdsResourceCacheTest, EntryExpiresWithBootstrap) {
+  auto resource = std::make_shared<FakeResource>();
+  XdsResourceCache::Key key(&type_, bootstrap_, server_, "bytes");
+  cache_.Insert(key, "foo", resource);
+  bootstrap_.reset();
+  EXPECT_FALSE(cache_.Lookup(key).has_value());
+}
+
+TEST_F(XdsResourceCacheTest, PrunesExpiredEntries) {
+  const size_t initial_size = cache_.TestOnlySize();
+  for (int i = 0; i < 1000; ++i) {
+    auto resource = std::make_shared<FakeResource>();
+    cache_.Insert(XdsResourceCache::Key(&type_, bootstrap_, server_,
+                                        std::to_string(i)),
+                  "foo", resource);
+  }
+  EXPECT_LT(cache_.TestOnlySize(), initial_size + 200);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
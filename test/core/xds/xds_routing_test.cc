@@ -19,11 +19,18 @@
 #include <grpc/grpc.h>
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
+#include "src/core/call/metadata_batch.h"
 #include "src/core/filter/filter_chain.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/matchers.h"
 #include "src/core/util/unique_type_name.h"
 #include "src/core/xds/grpc/blackboard.h"
 #include "src/core/xds/grpc/xds_http_filter_registry.h"
@@ -740,6 +747,158 @@ TEST_F(XdsRouteConfigFilterChainBuilderTest,
   EXPECT_EQ(GetBlackboardEntry("hcm+vhost+route+cw"), "hcm+vhost+route+cw");
 }
 
+//
+// XdsRouting::VirtualHostTable tests
+//
+
+class TestVirtualHostListIterator final
+    : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit TestVirtualHostListIterator(
+      const std::vector<std::vector<std::string>>& domains)
+      : domains_(domains) {}
+
+  size_t Size() const override { return domains_.size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  const std::vector<std::vector<std::string>>& domains_;
+};
+
+TEST(XdsVirtualHostTableTest, MatchesFindVirtualHostForDomain) {
+  const std::vector<std::vector<std::string>> domains = {
+      {"foo.example.com", "*.example.com"},
+      {"*.bar.example.com", "Foo.Example.COM"},
+      {"foo.*", "foo.bar.*"},
+      {"*"},
+      {"*.example.com", "exact.test"},
+  };
+  TestVirtualHostListIterator iterator(domains);
+  XdsRouting::VirtualHostTable table(iterator);
+  for (absl::string_view host :
+       {"foo.example.com", "FOO.example.com", "baz.example.com",
+        "x.bar.example.com", ".bar.example.com", "bar.example.com",
+        "example.com", "foo.bar.test", "foo.test", "foo.", "exact.test",
+        "other.test", ""}) {
+    EXPECT_EQ(table.Find(host),
+              XdsRouting::FindVirtualHostForDomain(iterator, host))
+        << host;
+  }
+  EXPECT_EQ(table.Find("foo.example.com"), 0);
+  EXPECT_EQ(table.Find("x.bar.example.com"), 1);
+  EXPECT_EQ(table.Find("foo.bar.test"), 2);
+  EXPECT_EQ(table.Find("other.test"), 3);
+  EXPECT_EQ(table.Find("exact.test"), 4);
+}
+
+TEST(XdsVirtualHostTableTest, NoMatch) {
+  const std::vector<std::vector<std::string>> domains = {
+      {"foo.example.com", "*.bar.test"}};
+  XdsRouting::VirtualHostTable table{TestVirtualHostListIterator(domains)};
+  EXPECT_EQ(table.Find("bar.test"), std::nullopt);
+  EXPECT_EQ(table.Find("foo.example.org"), std::nullopt);
+  EXPECT_EQ(XdsRouting::VirtualHostTable().Find("foo"), std::nullopt);
+}
+
+//
+// XdsRouting::RouteTable tests
+//
+
+class TestRouteListIterator final : public XdsRouting::RouteListIterator {
+ public:
+  explicit TestRouteListIterator(
+      const std::vector<XdsRouteConfigResource::Route::Matchers>& routes)
+      : routes_(routes) {}
+
+  size_t Size() const override { return routes_.size(); }
+
+  const XdsRouteConfigResource::Route::Matchers& GetMatchersForRoute(
+      size_t index) const override {
+    return routes_[index];
+  }
+
+ private:
+  const std::vector<XdsRouteConfigResource::Route::Matchers>& routes_;
+};
+
+XdsRouteConfigResource::Route::Matchers MakeMatchers(
+    StringMatcher::Type type, absl::string_view path,
+    bool case_sensitive = true, std::vector<HeaderMatcher> headers = {}) {
+  XdsRouteConfigResource::Route::Matchers matchers;
+  auto path_matcher = StringMatcher::Create(type, path, case_sensitive);
+  GRPC_CHECK(path_matcher.ok());
+  matchers.path_matcher = std::move(*path_matcher);
+  matchers.header_matchers = std::move(headers);
+  return matchers;
+}
+
+HeaderMatcher MakeHeaderMatcher(absl::string_view name,
+                                absl::string_view value) {
+  auto header_matcher =
+      HeaderMatcher::Create(name, HeaderMatcher::Type::kExact, value);
+  GRPC_CHECK(header_matcher.ok());
+  return std::move(*header_matcher);
+}
+
+TEST(XdsRouteTableTest, MatchesGetRouteForRequest) {
+  using Type = StringMatcher::Type;
+  std::vector<XdsRouteConfigResource::Route::Matchers> routes;
+  routes.push_back(MakeMatchers(Type::kExact, "/pkg.Svc/Exact"));
+  routes.push_back(MakeMatchers(Type::kPrefix, "/pkg.Svc/",
+                                /*case_sensitive=*/true,
+                                {MakeHeaderMatcher("x-route", "a"),
+                                 MakeHeaderMatcher("x-route", "a")}));
+  routes.push_back(MakeMatchers(Type::kPrefix, "/pkg.other/",
+                                /*case_sensitive=*/false));
+  routes.push_back(MakeMatchers(Type::kExact, "/pkg.Svc/Method"));
+  routes.push_back(MakeMatchers(Type::kPrefix, "/pkg."));
+  routes.push_back(MakeMatchers(Type::kSafeRegex, "/regex/.*"));
+  routes.push_back(MakeMatchers(Type::kExact, "/pkg.Svc/Exact"));
+  routes.push_back(MakeMatchers(Type::kPrefix, ""));
+  TestRouteListIterator iterator(routes);
+  XdsRouting::RouteTable table(iterator);
+  for (bool with_header : {false, true}) {
+    grpc_metadata_batch metadata;
+    if (with_header) {
+      metadata.Append("x-route", Slice::FromCopiedString("a"),
+                      [](absl::string_view, const Slice&) {});
+    }
+    for (absl::string_view path :
+         {"/pkg.Svc/Exact", "/pkg.Svc/Method", "/pkg.Svc/Other",
+          "/PKG.OTHER/Method", "/pkg.unknown/Method", "/regex/foo",
+          "/unknown/Method", ""}) {
+      EXPECT_EQ(table.GetRouteForRequest(path, &metadata),
+                XdsRouting::GetRouteForRequest(iterator, path, &metadata))
+          << path << " with_header=" << with_header;
+    }
+  }
+  grpc_metadata_batch metadata;
+  EXPECT_EQ(table.GetRouteForRequest("/pkg.Svc/Exact", &metadata), 0);
+  EXPECT_EQ(table.GetRouteForRequest("/pkg.Svc/Method", &metadata), 3);
+  EXPECT_EQ(table.GetRouteForRequest("/PKG.OTHER/Method", &metadata), 2);
+  EXPECT_EQ(table.GetRouteForRequest("/pkg.Svc/Other", &metadata), 4);
+  EXPECT_EQ(table.GetRouteForRequest("/regex/foo", &metadata), 5);
+  EXPECT_EQ(table.GetRouteForRequest("/unknown", &metadata), 7);
+  metadata.Append("x-route", Slice::FromCopiedString("a"),
+                  [](absl::string_view, const Slice&) {});
+  EXPECT_EQ(table.GetRouteForRequest("/pkg.Svc/Method", &metadata), 1);
+}
+
+TEST(XdsRouteTableTest, NoMatch) {
+  std::vector<XdsRouteConfigResource::Route::Matchers> routes;
+  routes.push_back(MakeMatchers(StringMatcher::Type::kPrefix, "/pkg.Svc/"));
+  XdsRouting::RouteTable table{TestRouteListIterator(routes)};
+  grpc_metadata_batch metadata;
+  EXPECT_EQ(table.GetRouteForRequest("/pkg.Other/Method", &metadata),
+            std::nullopt);
+  EXPECT_EQ(XdsRouting::RouteTable().GetRouteForRequest("/", &metadata),
+            std::nullopt);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -291,6 +291,7 @@ FakeXdsTransportFactory::FakeXdsTransport::CreateStreamingCall(
 //
 
 constexpr char FakeXdsTransportFactory::kAdsMethod[];
+constexpr char FakeXdsTransportFactory::kDeltaAdsMethod[];
 constexpr char FakeXdsTransportFactory::kLrsMethod[];
 
 RefCountedPtr<XdsTransportFactory::XdsTransport>
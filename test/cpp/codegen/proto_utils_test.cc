@@ -16,6 +16,7 @@
 //
 //
 
+#include <google/protobuf/wrappers.pb.h>
 #include <grpc/byte_buffer.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/grpc_library.h>
@@ -179,6 +180,38 @@ TEST_F(WriterTest, LargeBlockLargeBackup) {
   BufferWriterTest(4096, 8192, 4095);
 }
 
+void SerializeRoundTripTest(size_t value_size, bool expect_single_slice) {
+  google::protobuf::StringValue msg;
+  msg.set_value(std::string(value_size, 'x'));
+  ByteBuffer bb;
+  bool own_buffer;
+  ASSERT_TRUE(SerializationTraits<google::protobuf::StringValue>::Serialize(
+                  msg, &bb, &own_buffer)
+                  .ok());
+  EXPECT_EQ(bb.Length(), msg.ByteSizeLong());
+  if (expect_single_slice) {
+    GrpcByteBufferPeer peer(&bb);
+    const grpc_slice_buffer& slices = peer.c_buffer()->data.raw.slice_buffer;
+    ASSERT_EQ(slices.count, 1u);
+    EXPECT_EQ(GRPC_SLICE_LENGTH(slices.slices[0]), msg.ByteSizeLong());
+  }
+  google::protobuf::StringValue parsed;
+  ASSERT_TRUE(SerializationTraits<google::protobuf::StringValue>::Deserialize(
+                  &bb, &parsed)
+                  .ok());
+  EXPECT_EQ(parsed.value(), msg.value());
+}
+
+TEST_F(WriterTest, MediumMessageSerializesToSingleSlice) {
+  SerializeRoundTripTest(1024, true);
+  SerializeRoundTripTest(kProtoBufferMaxContiguousSerializeLength - 16, true);
+}
+
+TEST_F(WriterTest, LargeMessageRoundTrip) {
+  SerializeRoundTripTest(kProtoBufferMaxContiguousSerializeLength * 4, false);
+  SerializeRoundTripTest(kProtoBufferWriterMaxBufferLength * 2, false);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc
@@ -23,15 +23,18 @@
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/arena_message_allocator.h>
 #include <grpcpp/support/client_callback.h>
 #include <grpcpp/support/message_allocator.h>
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <sstream>
 #include <thread>
 
@@ -46,6 +49,22 @@
 
 namespace grpc {
 namespace testing {
+
+class ArenaMessageAllocatorTestPeer {
+ public:
+  template <typename RequestT, typename ResponseT>
+  static size_t arenas_created(
+      const ArenaMessageAllocator<RequestT, ResponseT>* allocator) {
+    return allocator->arenas_created();
+  }
+
+  template <typename RequestT, typename ResponseT>
+  static size_t pooled_arenas(
+      ArenaMessageAllocator<RequestT, ResponseT>* allocator) {
+    return allocator->pooled_arenas();
+  }
+};
+
 namespace {
 
 class CallbackTestServiceImpl : public EchoTestService::CallbackService {
@@ -107,8 +126,12 @@ class MessageAllocatorEnd2endTestBase
 
   ~MessageAllocatorEnd2endTestBase() override = default;
 
-  void CreateServer(MessageAllocator<EchoRequest, EchoResponse>* allocator) {
+  void CreateServer(MessageAllocator<EchoRequest, EchoResponse>* allocator,
+                    bool arena_message_allocation = false) {
     ServerBuilder builder;
+    if (arena_message_allocation) {
+      builder.experimental().EnableArenaMessageAllocation();
+    }
 
     auto server_creds = GetCredentialsProvider()->GetServerCredentials(
         GetParam().credentials_type);
@@ -339,6 +362,18 @@ class ArenaAllocatorTest : public MessageAllocatorEnd2endTestBase {
     }
     int allocation_count = 0;
   };
+
+  // Waits until `allocator` has at least `count` arenas in its pool.
+  static void WaitForPooledArenas(
+      ArenaMessageAllocator<EchoRequest, EchoResponse>* allocator,
+      size_t count) {
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (ArenaMessageAllocatorTestPeer::pooled_arenas(allocator) < count) {
+      ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
 };
 
 TEST_P(ArenaAllocatorTest, SimpleRpc) {
@@ -350,6 +385,70 @@ TEST_P(ArenaAllocatorTest, SimpleRpc) {
   EXPECT_EQ(kRpcCount, allocator->allocation_count);
 }
 
+TEST_P(ArenaAllocatorTest, PooledArenaAllocator) {
+  const int kRpcCount = 10;
+  ArenaMessageAllocator<EchoRequest, EchoResponse> allocator(
+      /*initial_block_size=*/256, /*max_pooled_arenas=*/1);
+  std::set<google::protobuf::Arena*> arenas;
+  auto mutator = [&arenas](RpcAllocatorState* /*allocator_state*/,
+                           const EchoRequest* req, EchoResponse* resp) {
+    EXPECT_NE(nullptr, req->GetArena());
+    EXPECT_EQ(req->GetArena(), resp->GetArena());
+    arenas.insert(req->GetArena());
+  };
+  callback_service_.SetAllocatorMutator(mutator);
+  CreateServer(&allocator);
+  ResetStub();
+  for (int i = 0; i < kRpcCount; i++) {
+    SendRpcs(1);
+    // The arena is returned to the pool once the server is done with the
+    // RPC, so that the next one reuses it.
+    WaitForPooledArenas(&allocator, 1);
+  }
+  EXPECT_EQ(1u, ArenaMessageAllocatorTestPeer::arenas_created(&allocator));
+  EXPECT_EQ(1u, arenas.size());
+  DestroyServer();
+}
+
+TEST_P(ArenaAllocatorTest, EnabledByServerBuilder) {
+  const int kRpcCount = 10;
+  // The allocator is shared by every server, so other tests may have used
+  // it already.
+  auto* allocator =
+      static_cast<ArenaMessageAllocator<EchoRequest, EchoResponse>*>(
+          grpc::internal::DefaultArenaMessageAllocator<EchoRequest,
+                                                       EchoResponse>::Get());
+  const size_t arenas_created_before =
+      ArenaMessageAllocatorTestPeer::arenas_created(allocator);
+  std::atomic_int arena_rpcs{0};
+  auto mutator = [&arena_rpcs](RpcAllocatorState* /*allocator_state*/,
+                               const EchoRequest* req, EchoResponse* resp) {
+    if (req->GetArena() != nullptr && req->GetArena() == resp->GetArena()) {
+      arena_rpcs++;
+    }
+  };
+  callback_service_.SetAllocatorMutator(mutator);
+  CreateServer(nullptr, /*arena_message_allocation=*/true);
+  ResetStub();
+  SendRpcs(kRpcCount);
+  EXPECT_EQ(kRpcCount, arena_rpcs);
+  const size_t arenas_created =
+      ArenaMessageAllocatorTestPeer::arenas_created(allocator);
+  EXPECT_GE(arenas_created, 1u);
+  // Arenas are pooled for reuse, so sequential RPCs need only a few.
+  EXPECT_LT(arenas_created - arenas_created_before,
+            static_cast<size_t>(kRpcCount));
+}
+
+TEST_P(ArenaAllocatorTest, ServerBuilderKeepsCustomAllocator) {
+  const int kRpcCount = 10;
+  std::unique_ptr<ArenaAllocator> allocator(new ArenaAllocator);
+  CreateServer(allocator.get(), /*arena_message_allocation=*/true);
+  ResetStub();
+  SendRpcs(kRpcCount);
+  EXPECT_EQ(kRpcCount, allocator->allocation_count);
+}
+
 std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
   std::vector<TestScenario> scenarios;
   std::vector<std::string> credentials_types{
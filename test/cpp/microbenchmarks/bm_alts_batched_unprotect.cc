@@ -0,0 +1,115 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark ALTS decryption throughput when a read holds many frames, opened
+// in batches, against the same frames arriving one read at a time
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "src/core/tsi/alts/crypt/gsec.h"
+#include "src/core/tsi/alts/zero_copy_frame_protector/alts_zero_copy_grpc_protector.h"
+#include "src/core/tsi/transport_security_grpc.h"
+#include "src/core/util/grpc_check.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+void BM_AltsUnprotect(benchmark::State& state) {
+  const size_t read_size = static_cast<size_t>(state.range(0)) * 1024;
+  const bool whole_read = state.range(1) != 0;
+  std::vector<uint8_t> key(kAes128GcmKeyLength, 0x42);
+  size_t max_frame_size = 16 * 1024;
+  tsi_zero_copy_grpc_protector* client = nullptr;
+  tsi_zero_copy_grpc_protector* server = nullptr;
+  for (tsi_zero_copy_grpc_protector** protector : {&client, &server}) {
+    GRPC_CHECK_EQ(alts_zero_copy_grpc_protector_create(
+                      GsecKeyFactory(key, /*is_rekey=*/false),
+                      /*is_client=*/protector == &client,
+                      /*is_integrity_only=*/false,
+                      /*enable_extra_copy=*/false, &max_frame_size, protector),
+                  TSI_OK);
+  }
+  grpc_slice payload = grpc_slice_malloc(read_size);
+  memset(GRPC_SLICE_START_PTR(payload), 'a', read_size);
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer frame;
+  grpc_slice_buffer_init(&unprotected);
+  grpc_slice_buffer_init(&protected_slices);
+  grpc_slice_buffer_init(&frame);
+  for (auto _ : state) {
+    state.PauseTiming();
+    grpc_slice_buffer_add(&unprotected, grpc_slice_ref(payload));
+    GRPC_CHECK_EQ(tsi_zero_copy_grpc_protector_protect(client, &unprotected,
+                                                       &protected_slices),
+                  TSI_OK);
+    state.ResumeTiming();
+    if (whole_read) {
+      GRPC_CHECK_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                        server, &protected_slices, &unprotected, nullptr),
+                    TSI_OK);
+    } else {
+      uint32_t frame_size;
+      while (tsi_zero_copy_grpc_protector_read_frame_size(
+          server, &protected_slices, &frame_size)) {
+        grpc_slice_buffer_move_first(&protected_slices, frame_size, &frame);
+        GRPC_CHECK_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                          server, &frame, &unprotected, nullptr),
+                      TSI_OK);
+      }
+    }
+    GRPC_CHECK_EQ(unprotected.length, read_size);
+    grpc_slice_buffer_reset_and_unref(&unprotected);
+  }
+  state.SetBytesProcessed(state.iterations() * read_size);
+  grpc_slice_buffer_destroy(&unprotected);
+  grpc_slice_buffer_destroy(&protected_slices);
+  grpc_slice_buffer_destroy(&frame);
+  grpc_slice_unref(payload);
+  tsi_zero_copy_grpc_protector_destroy(client);
+  tsi_zero_copy_grpc_protector_destroy(server);
+}
+BENCHMARK(BM_AltsUnprotect)
+    ->ArgsProduct({{64, 256, 1024, 4096}, {0, 1}})
+    ->ArgNames({"read_kib", "whole_read"});
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
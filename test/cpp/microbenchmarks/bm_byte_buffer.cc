@@ -19,14 +19,18 @@
 // This benchmark exists to show that byte-buffer copy is size-independent
 
 #include <benchmark/benchmark.h>
+#include <google/protobuf/wrappers.pb.h>
 #include <grpc/byte_buffer.h>
 #include <grpc/byte_buffer_reader.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/grpc_library.h>
+#include <grpcpp/impl/proto_utils.h>
 #include <grpcpp/support/byte_buffer.h>
 
 #include <memory>
+#include <string>
 
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/grpc_check.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
@@ -108,6 +112,26 @@ static void BM_ByteBufferReader_Peek(benchmark::State& state) {
 }
 BENCHMARK(BM_ByteBufferReader_Peek)->Ranges({{64 * 1024, 1024 * 1024}});
 
+// Serializes a protobuf message into a byte buffer charged to a memory
+// allocator, as a call does when sending it.
+static void BM_ProtoSerialize(benchmark::State& state) {
+  const size_t message_size = state.range(0);
+  google::protobuf::StringValue msg;
+  msg.set_value(std::string(message_size, 'x'));
+  auto allocator = grpc_core::ResourceQuota::Default()
+                       ->memory_quota()
+                       ->CreateMemoryAllocator("bm_proto_serialize");
+  for (auto _ : state) {
+    grpc::ByteBuffer bb;
+    bool own_buffer;
+    GRPC_CHECK(SerializationTraits<google::protobuf::StringValue>::Serialize(
+                   &allocator, msg, &bb, &own_buffer)
+                   .ok());
+  }
+  state.SetBytesProcessed(message_size * state.iterations());
+}
+BENCHMARK(BM_ProtoSerialize)->RangeMultiplier(4)->Range(256, 1024 * 1024);
+
 }  // namespace testing
 }  // namespace grpc
 
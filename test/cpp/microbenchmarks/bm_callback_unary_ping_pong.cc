@@ -48,6 +48,12 @@ BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, MinInProcess, NoOpMutator,
                    NoOpMutator)
     ->Apply(SweepSizesArgs);
 
+// Unary ping pong with the server allocating request and response on pooled
+// protobuf arenas
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, ArenaInProcess, NoOpMutator,
+                   NoOpMutator)
+    ->Apply(SweepSizesArgs);
+
 // Client context with different metadata
 BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InProcess,
                    Client_AddMetadata<RandomBinaryMetadata<10>, 1>, NoOpMutator)
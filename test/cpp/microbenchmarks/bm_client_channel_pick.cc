@@ -0,0 +1,144 @@
+//
+//
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark channel-level LB picks across thread counts
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/client_channel/client_channel.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class QueuePicker final : public LoadBalancingPolicy::SubchannelPicker {
+ public:
+  LoadBalancingPolicy::PickResult Pick(
+      LoadBalancingPolicy::PickArgs) override {
+    return LoadBalancingPolicy::PickResult::Queue();
+  }
+};
+
+// Shared between benchmark threads.
+ClientChannel::PickerObservable* g_picker_observable;
+struct SharedPicker {
+  Mutex mu;
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker
+      ABSL_GUARDED_BY(mu);
+};
+SharedPicker* g_shared_picker;
+
+// Baseline: each pick takes a ref to the current picker under a shared lock,
+// as a pick through an Observable<> does.
+void BM_PickWithSharedPickerRef(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    g_shared_picker = new SharedPicker;
+    MutexLock lock(&g_shared_picker->mu);
+    g_shared_picker->picker = MakeRefCounted<QueuePicker>();
+  }
+  LoadBalancingPolicy::PickArgs args{};
+  for (auto _ : state) {
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    {
+      MutexLock lock(&g_shared_picker->mu);
+      picker = g_shared_picker->picker;
+    }
+    benchmark::DoNotOptimize(picker->Pick(args));
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) delete g_shared_picker;
+}
+BENCHMARK(BM_PickWithSharedPickerRef)->ThreadRange(1, 64)->UseRealTime();
+
+// Baseline: each pick takes a ref to the current picker under a per-CPU
+// lock.  This avoids the shared lock, but not the refcount updates on the
+// shared picker.
+struct alignas(GPR_CACHELINE_SIZE) PickerShard {
+  Mutex mu;
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker
+      ABSL_GUARDED_BY(mu);
+};
+PerCpu<PickerShard>* g_picker_shards;
+
+void BM_PickWithPerCpuPickerRef(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    g_picker_shards = new PerCpu<PickerShard>(
+        PerCpuOptions().SetCpusPerShard(1).SetMaxShards(32));
+    auto picker = MakeRefCounted<QueuePicker>();
+    for (PickerShard& shard : *g_picker_shards) {
+      MutexLock lock(&shard.mu);
+      shard.picker = picker;
+    }
+  }
+  LoadBalancingPolicy::PickArgs args{};
+  for (auto _ : state) {
+    PickerShard& shard = g_picker_shards->this_cpu();
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    {
+      MutexLock lock(&shard.mu);
+      picker = shard.picker;
+    }
+    benchmark::DoNotOptimize(picker->Pick(args));
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) delete g_picker_shards;
+}
+BENCHMARK(BM_PickWithPerCpuPickerRef)->ThreadRange(1, 64)->UseRealTime();
+
+// Picks through the per-CPU picker cache used by LoadBalancedCallDestination,
+// which borrows the picker without touching its refcount.
+void BM_PickWithCachedPicker(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    g_picker_observable =
+        new ClientChannel::PickerObservable(MakeRefCounted<QueuePicker>());
+  }
+  LoadBalancingPolicy::PickArgs args{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(g_picker_observable->WithCachedPicker(
+        [&](LoadBalancingPolicy::SubchannelPicker& picker) {
+          return picker.Pick(args);
+        }));
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) delete g_picker_observable;
+}
+BENCHMARK(BM_PickWithCachedPicker)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -198,7 +198,7 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
 }
 
-BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 64)->UseRealTime();
 
 namespace {
 const grpc_event_engine_vtable g_none_vtable =
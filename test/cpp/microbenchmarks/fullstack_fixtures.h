@@ -286,6 +286,25 @@ typedef MinStackize<UDS> MinUDS;
 typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
 
+////////////////////////////////////////////////////////////////////////////////
+// Arena message allocation fixtures
+
+class ArenaAllocationConfiguration : public FixtureConfiguration {
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->experimental().EnableArenaMessageAllocation();
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <class Base>
+class ArenaAllocationize : public Base {
+ public:
+  explicit ArenaAllocationize(Service* service)
+      : Base(service, ArenaAllocationConfiguration()) {}
+};
+
+typedef ArenaAllocationize<InProcess> ArenaInProcess;
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -86,6 +86,22 @@ TEST_F(ServerBuilderTest, CreateServerRepeatedPortWithDisallowedReusePort) {
             nullptr);
 }
 
+TEST_F(ServerBuilderTest, InvalidMethodAdmissionConfig) {
+  ServerBuilder builder;
+  builder.experimental().SetMethodAdmissionConfig(
+      "{\"methodConfig\": [{\"maxConcurrentCalls\": \"lots\"}]}");
+  EXPECT_EQ(builder.RegisterService(&g_service).BuildAndStart(), nullptr);
+}
+
+TEST_F(ServerBuilderTest, ValidMethodAdmissionConfig) {
+  ServerBuilder builder;
+  builder.experimental().SetMethodAdmissionConfig(
+      "{\"methodConfig\": [{\"maxConcurrentCalls\": 10}]}");
+  auto server = builder.RegisterService(&g_service).BuildAndStart();
+  ASSERT_NE(server, nullptr);
+  server->Shutdown();
+}
+
 TEST_F(ServerBuilderTest, AddPassiveListener) {
   std::unique_ptr<experimental::PassiveListener> passive_listener;
   auto server =
@@ -484,6 +484,27 @@ class CXXLanguage(Language):
                 warmup_seconds=CXX_WARMUP_SECONDS,
             )
 
+            # Unary QPS with one SO_REUSEPORT listener shard per server core,
+            # so connections are accepted on the cores that receive them.
+            scenario = _ping_pong_scenario(
+                "cpp_protobuf_async_unary_qps_unconstrained_listener_shard_per_core_%s"
+                % secstr,
+                rpc_type="UNARY",
+                client_type="ASYNC_CLIENT",
+                server_type="ASYNC_SERVER",
+                unconstrained_client="async",
+                secure=secure,
+                minimal_stack=not secure,
+                categories=[SWEEP],
+                warmup_seconds=CXX_WARMUP_SECONDS,
+            )
+            _add_channel_arg(
+                scenario["server_config"],
+                "grpc.experimental.tcp_listener_shards",
+                0,
+            )
+            yield scenario
+
             yield _ping_pong_scenario(
                 "cpp_generic_async_streaming_qps_one_server_core_%s" % secstr,
                 rpc_type="STREAMING",